@@ -36,19 +36,16 @@
 namespace am {
 
 AbstractModel::AbstractModel(const AbstractModel& other) {
-  if (!other.regions_.empty()) {
-    for (const auto& it : other.regions_)
-       regions_.emplace(it.first, std::shared_ptr<Region>(new Region(*it.second)));
-  }
-  if (!other.links_.empty()) {
-    for (const auto& it : other.links_)
-       links_.emplace(it.first, std::shared_ptr<Link>(new Link(*it.second, regions_)));
-  }
-  if (!other.global_.empty()) {
-	  //DEBUG std::cout << "\t***DEBUG AbstractModel CopyC'Tor: found global in other " << std::endl;
-    for (const auto& it : other.global_)
-       global_.emplace(it.first, std::shared_ptr<Global>(new Global(*it.second)));
-  }
+  //the maps are copied and their components cloned in place, so the copy iterates in the same order as other
+  regions_ = other.regions_;
+  for (auto& it : regions_)
+    it.second = std::shared_ptr<Region>(new Region(*it.second));
+  links_ = other.links_;
+  for (auto& it : links_)
+    it.second = std::shared_ptr<Link>(new Link(*it.second, regions_));
+  global_ = other.global_;
+  for (auto& it : global_)
+    it.second = std::shared_ptr<Global>(new Global(*it.second));
 }
 
 AbstractModel::AbstractModel(const std::unordered_map<std::string, std::unique_ptr<
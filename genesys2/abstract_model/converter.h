@@ -60,22 +60,18 @@ class Converter : public virtual builder::ConverterPrototype, public virtual Sys
             aux::SimulationClock::time_point start_installation,
             aux::SimulationClock::time_point end_installation,
             aux::SimulationClock::duration interval_installation,
-            std::unique_ptr<aux::TimeBasedData> line_length)
+            std::shared_ptr<const aux::TimeBasedData> line_length)
       : builder::SysCompActPrototype(origin), // virtual inheritance and deleted default c'tor
         builder::ConverterPrototype(origin.code(),
                                     origin.name(),
                                     origin.input(),
                                     origin.output(),
                                     origin.bidirectional(),
-                                    std::move(std::move(origin.efficiency_new()) -
-                                              std::move(std::move(origin.length_dep_loss_TBD() *
-                                                                  std::move(line_length->clone())))),
-                                    std::move(std::move(origin.cost()) +
-                                              std::move(std::move((origin.length_dep_cost_TBD()) *
-                                                                  std::move(line_length->clone())))),
-                                    std::move(origin.lifetime()),
-                                    std::move(origin.internal_rate_of_return()),
-                                    std::move(origin.OaM_rate())),
+                                    origin.efficiency_new() - (origin.length_dep_loss_TBD() * line_length),
+                                    origin.cost() + (origin.length_dep_cost_TBD() * line_length),
+                                    origin.lifetime(),
+                                    origin.internal_rate_of_return(),
+                                    origin.OaM_rate()),
         SysComponentActive(origin, std::move(installation), start_installation, end_installation,
                            interval_installation) {}
 };
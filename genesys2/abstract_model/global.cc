@@ -39,16 +39,12 @@
 namespace am {
 
 Global::Global(const Global& other) : GlobalProto(other) {
-  if (!other.primary_energy_ptrs_.empty()) {
-    for (const auto &it : other.primary_energy_ptrs_)
-      primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(
-          new PrimaryEnergy(*it.second)));
-  }
-  if (!other.storage_ptrs_.empty()) {
-    for (const auto &it : other.storage_ptrs_)
-      storage_ptrs_.emplace(it.first, std::shared_ptr<SysComponentActive>(
-          new SysComponentActive(*it.second)));
-  }
+  primary_energy_ptrs_ = other.primary_energy_ptrs_;
+  for (auto& it : primary_energy_ptrs_)
+    it.second = std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(*it.second));
+  storage_ptrs_ = other.storage_ptrs_;
+  for (auto& it : storage_ptrs_)
+    it.second = std::shared_ptr<SysComponentActive>(new SysComponentActive(*it.second));
 }
 
 Global::Global(const builder::GlobalProto& origin,
@@ -58,20 +58,17 @@ Link::Link(const LinkPrototype& origin,
 Link::Link(const Link& other,
            const std::unordered_map<std::string, std::shared_ptr<Region> >& region)
   : LinkPrototype(other) {
-  if (!other.converter_ptrs_.empty()) {
-    for (const auto &it : other.converter_ptrs_)
-      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(
-          new Converter(*it.second)));
-  }
+  converter_ptrs_ = other.converter_ptrs_;
+  for (auto& it : converter_ptrs_)
+    it.second = std::shared_ptr<Converter>(new Converter(*it.second));
   RegisterRegions(region);
 }
 
 Link::Link(const Link& other)
     : LinkPrototype(other) {
-  if (!other.converter_ptrs_.empty()) {
-    for (const auto &it : other.converter_ptrs_)
-      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>( new Converter(*it.second)));
-  }
+  converter_ptrs_ = other.converter_ptrs_;
+  for (auto& it : converter_ptrs_)
+    it.second = std::shared_ptr<Converter>(new Converter(*it.second));
 }
 
 void Link::RegisterRegions(const std::unordered_map<std::string, std::shared_ptr<Region> >& region) {
@@ -56,6 +56,11 @@ class PrimaryEnergy : public builder::PrimEnergyPrototype {
   double potential(aux::SimulationClock::time_point tp,
                    double query,
                    double offset = 0.0) const {return potential_.lookup(tp, query, offset);}
+  void potential(aux::SimulationClock::time_point tp_start,
+                 aux::SimulationClock::duration interval,
+                 std::size_t count,
+                 const double* query,
+                 double* values) const {potential_.lookup_series(tp_start, interval, count, query, values);}
 
  private:
   const aux::TBDLookupTable potential_;
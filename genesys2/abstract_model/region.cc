@@ -39,26 +39,18 @@ namespace am {
 
 Region::Region(const Region& other)
     : RegionPrototype(other) {
-  if (!other.primary_energy_ptrs_.empty()) {
-    for (const auto &it : other.primary_energy_ptrs_)
-      primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(
-          new PrimaryEnergy(*it.second)));
-  }
-  if (!other.converter_ptrs_.empty()) {
-    for (const auto &it : other.converter_ptrs_)
-      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(
-          new Converter(*it.second)));
-  }
-  if (!other.multi_converter_ptrs_.empty()) {
-    for (const auto &it : other.multi_converter_ptrs_)
-      multi_converter_ptrs_.emplace(it.first, std::shared_ptr<MultiConverter>(
-          new MultiConverter(*it.second)));
-  }
-  if (!other.storage_ptrs_.empty()) {
-    for (const auto &it : other.storage_ptrs_)
-      storage_ptrs_.emplace(it.first, std::shared_ptr<SysComponentActive>(
-          new SysComponentActive(*it.second)));
-  }
+  primary_energy_ptrs_ = other.primary_energy_ptrs_;
+  for (auto& it : primary_energy_ptrs_)
+    it.second = std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(*it.second));
+  converter_ptrs_ = other.converter_ptrs_;
+  for (auto& it : converter_ptrs_)
+    it.second = std::shared_ptr<Converter>(new Converter(*it.second));
+  multi_converter_ptrs_ = other.multi_converter_ptrs_;
+  for (auto& it : multi_converter_ptrs_)
+    it.second = std::shared_ptr<MultiConverter>(new MultiConverter(*it.second));
+  storage_ptrs_ = other.storage_ptrs_;
+  for (auto& it : storage_ptrs_)
+    it.second = std::shared_ptr<SysComponentActive>(new SysComponentActive(*it.second));
 }
 
 Region::Region(const builder::RegionPrototype& origin,
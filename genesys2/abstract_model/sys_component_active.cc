@@ -128,6 +128,14 @@ void SysComponentActive::MapInstallation(std::unique_ptr<aux::TimeBasedData> ins
   } while ((start_installation += interval_installation) < end_installation);
 }
 
+void SysComponentActive::ResetInstallation(const SysComponentActive& origin) {
+  //restore the installed units of origin, additional units have to be mapped again by MapInstallation
+  capacity_ = origin.capacity_;
+  capex_ = origin.capex_;
+  efficiency_ = origin.efficiency_;
+  mean_efficiency_ = origin.mean_efficiency_;
+}
+
 aux::TimeSeriesConst SysComponentActive::capex(aux::SimulationClock::time_point tp_start,
                                                aux::SimulationClock::time_point tp_end) const {
     aux::SimulationClock sub_clock(tp_start, aux::years(1));
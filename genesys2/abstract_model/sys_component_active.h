@@ -50,7 +50,7 @@ class SysComponentActive : public virtual builder::SysCompActPrototype {
         capacity_(other.capacity_),
         capex_(other.capex_),
         efficiency_(other.efficiency_),
-		mean_efficiency_(0.){}
+		mean_efficiency_(other.mean_efficiency_){}
   SysComponentActive(SysComponentActive&&) = default;
   SysComponentActive& operator=(const SysComponentActive&) = delete;
   SysComponentActive& operator=(SysComponentActive&&) = delete;
@@ -68,6 +68,7 @@ class SysComponentActive : public virtual builder::SysCompActPrototype {
                        aux::SimulationClock::time_point start_installation,
                        aux::SimulationClock::time_point end_installation,
                        aux::SimulationClock::duration interval_installation = aux::years(1));
+  void ResetInstallation(const SysComponentActive& origin);
   double capacity(aux::SimulationClock::time_point tp) const {return (capacity_[tp]);}
   double capex(aux::SimulationClock::time_point tp) const {return (capex_[tp]);}
   aux::TimeSeriesConst capex(aux::SimulationClock::time_point tp_start,
@@ -78,6 +79,9 @@ class SysComponentActive : public virtual builder::SysCompActPrototype {
   const aux::TimeSeriesConstAddable& get_capacity_() const { return capacity_;}
   const aux::TimeSeriesConstAddable& get_capex_() const { return capex_;}
   void set_mean_efficiency(const aux::SimulationClock& clock) {mean_efficiency_ = efficiency_[clock.now()];}
+  double mean_efficiency() const {return mean_efficiency_;}
+  void BakeEfficiency(aux::SimulationClock::time_point tp_start,
+                      aux::SimulationClock::time_point tp_end) {efficiency_.bake(tp_start, tp_end);}
 
  private:
   aux::TimeSeriesConstAddable capacity_;
@@ -35,23 +35,23 @@
 
 namespace analysis_hsm {
 
-AnalysedModel::AnalysedModel(const DynamicModel& origin)
-    : dm_hsm::DynamicModel(origin) {
+AnalysedModel::AnalysedModel(DynamicModel&& origin)
+    : dm_hsm::DynamicModel(std::move(origin)) {
   //DEBUG std::cout << "DEBUG: C-Tor AnalysedModel::AnalysedModel" << std::endl;
   if (!dm_hsm::DynamicModel::regions().empty()) {
     for (const auto& it : DynamicModel::regions()) {
-      regions_.emplace(it.first, std::shared_ptr<Region>(new Region(*(it.second))));
+      regions_.emplace(it.first, std::shared_ptr<Region>(new Region(std::move(*(it.second)))));
     }
   }
   //DEBUG std::cout << "DEBUG: C-Tor AnalysedModel::AnalysedModel Regions finisehd" << std::endl;
   if (!dm_hsm::DynamicModel::links().empty()) {
     for (const auto& it : DynamicModel::links()) {
-      links_.emplace(it.first, std::shared_ptr<Link>(new Link(*(it.second))));
+      links_.emplace(it.first, std::shared_ptr<Link>(new Link(std::move(*(it.second)))));
     }
   }
   if (!dm_hsm::DynamicModel::global().empty()) {
     for (const auto& it : DynamicModel::global()) {
-      global_.emplace(it.first, std::shared_ptr<Global>(new Global(*(it.second))));
+      global_.emplace(it.first, std::shared_ptr<Global>(new Global(std::move(*(it.second)))));
     }
   }
   //std::cout << "DEBUG: END C-Tor AnalysedModel::AnalysedModel" << std::endl;
@@ -60,6 +60,10 @@ AnalysedModel::AnalysedModel(const DynamicModel& origin)
 void AnalysedModel::XmlOutput(std::unordered_map<std::string, double >fitness_results, const std::string& outFile,  const bool dynamic_output) {
   //std::cout << "FUNC-ID: AnalysedModel::XmlOutput " << std::endl;
   io_routines::XmlWriter xml_out(outFile);
+  if (dynamic_output && genesys::ProgramSettings::analysis_hsm_binary_series()) {
+    //hourly series go to a columnar binary file next to the xml, which only references them
+    xml_out.openSeriesArchive(outFile + ".series", genesys::ProgramSettings::analysis_hsm_compress_series());
+  }
   if(dynamic_output){//xml root element MODEL_TYPE
     xml_out.addTag("MODEL_DYNAMIC");
     xml_out.addElement("version-info");
@@ -51,7 +51,7 @@ class AnalysedModel: public dm_hsm::DynamicModel {
   AnalysedModel(AnalysedModel&&) = default;
   AnalysedModel& operator=(const AnalysedModel&) = delete;
   AnalysedModel& operator=(AnalysedModel&&) = delete;
-  AnalysedModel(const DynamicModel& origin);
+  AnalysedModel(DynamicModel&& origin); ///< Adopts the operated model, its components are moved into the analysis types
 
   ///@{ Output relevant
   //  void XmlOutput(const std::string& outFile = "xml-default-output", bool  dynamic = false);
@@ -41,8 +41,8 @@ void Converter::writeXmlVariables(io_routines::XmlWriter& xmlout, bool dynamic_o
   analysis_hsm::SysComponentActive::writeXmlVariables(xmlout, dynamic_output);
   if (dynamic_output) { //output of dynamic class properties hereafter
     //converter specific time-series
-    writeXmlElement(xmlout, "used_co2_emissions_", get_used_co2_emissions());
-    writeXmlElement(xmlout, "losses_", get_losses());
+    writeXmlElement(xmlout, "used_co2_emissions_", get_used_co2_emissions(), true);
+    writeXmlElement(xmlout, "losses_", get_losses(), true);
   }
 }
 
@@ -52,16 +52,16 @@ class Converter : public virtual dm_hsm::Converter, public virtual SysComponentA
   Converter(Converter&&) = default;
   Converter& operator=(const Converter&) = delete;
   Converter& operator=(Converter&&) = delete;
-  Converter(const dm_hsm::Converter& origin)
+  Converter(dm_hsm::Converter&& origin)
       : builder::SysCompActPrototype(origin), // virtual inheritance and deleted default c'tor
         builder::ConverterPrototype(origin), // virtual inheritance and deleted default c'tor
         am::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
         am::Converter(origin), // virtual inheritance and deleted default c'tor
         sm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
         sm::Converter(origin), // virtual inheritance and deleted default c'tor
-        dm_hsm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
-        dm_hsm::Converter(origin),
-        SysComponentActive(origin) {}
+        dm_hsm::SysComponentActive(std::move(origin)), // virtual inheritance and deleted default c'tor
+        dm_hsm::Converter(std::move(origin)),
+        SysComponentActive(std::move(origin)) {}
 
   virtual void writeXmlVariables(io_routines::XmlWriter& xmlout, bool dynamic_output) override;
 };
@@ -7,20 +7,22 @@
 
 #include <analysis_hsm/global.h>
 
+#include <utility>
+
 namespace analysis_hsm {
 
-Global::Global(const dm_hsm::Global& origin)
-    : dm_hsm::Global(origin) {
+Global::Global(dm_hsm::Global&& origin)
+    : dm_hsm::Global(std::move(origin)) {
   //  std::cout << "DEBUG: C-Tor an::Global::Global" << std::endl;
   if (!storage_ptrs_dm().empty()) {
     std::cout << "found global energy storage in dm..." << std::endl;
     for (const auto& it : storage_ptrs_dm()) {
         if (auto storage = std::dynamic_pointer_cast<dm_hsm::Storage>(it.second)) {
-          storage_ptrs_.emplace(it.first, std::shared_ptr<Storage>(new Storage(*storage)));
+          storage_ptrs_.emplace(it.first, std::shared_ptr<Storage>(new Storage(std::move(*storage))));
           //std::cout << "copy2 storage_an = " << storage_ptrs_.find(it.first)->second->get_fopex().PrintToString() << std::endl;
         } else {
           storage_ptrs_.emplace(it.first, std::shared_ptr<analysis_hsm::Storage>(
-                      new analysis_hsm::Storage(static_cast<dm_hsm::Storage>(*it.second)))); // static_cast is necessary because of multiple inheritance
+                      new analysis_hsm::Storage(std::move(static_cast<dm_hsm::Storage&>(*it.second))))); // static_cast is necessary because of multiple inheritance
         }
     }
   } else {
@@ -29,7 +31,7 @@ Global::Global(const dm_hsm::Global& origin)
   if(!primary_energy_ptrs_dm().empty()) {
     //std::cout << "found global primary energy in dm..." << std::endl;
     for (const auto& it : primary_energy_ptrs_dm())
-      primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(*it.second)));
+      primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(std::move(*it.second))));
   } else std::cout << "\t***info NO global primary energy ptrs found in dm" << std::endl;
 
   //std::cout << "DEBUG: END C-Tor an::Global::Global" << std::endl;
@@ -63,10 +65,14 @@ void Global::writeXmlGlobal(io_routines::XmlWriter& xmlout, bool dynamic_output)
 
 }
 
-void Global::writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConst& dataObj) {
+void Global::writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConst& dataObj,
+                             const bool dynamic) {
   xml_target.addSubElement("data");
     xml_target.addAttr("code", data_code);
-    xml_target.addTBD(dataObj);
+    if (dynamic)
+      xml_target.addSeries(dataObj);
+    else
+      xml_target.addTBD(dataObj);
   xml_target.closeSubElement();
 }
 
@@ -27,14 +27,15 @@ class Global : public dm_hsm::Global {
   Global(Global&& other) = delete; //  if this move c'tor is needed, special implementation is necessary, taking care of correct handling of the weak pointers of the converter
   Global& operator=(const Global&) = delete;
   Global& operator=(Global&&) = delete;
-  Global(const dm_hsm::Global& origin);
+  Global(dm_hsm::Global&& origin);
 
   /** \name Output Interface */
   ///@{
   void writeXmlGlobal(io_routines::XmlWriter& xmlout, bool dynamic_output = false);
 
  private:
-  void writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConst& dataObj);
+  void writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConst& dataObj,
+                       const bool dynamic = false);
   std::unordered_map<std::string, std::shared_ptr<PrimaryEnergy> > primary_energy_ptrs_;
   std::unordered_map<std::string, std::shared_ptr<Storage> > storage_ptrs_;
 };
@@ -73,7 +73,7 @@ std::unique_ptr<analysis_hsm::AnalysedModel> HSMAnalysis::RunHSMOperation() {
      double cpu_time1 = double(std::clock())/CLOCKS_PER_SEC;
      std::cout << "Analysis CPU time was: " << cpu_time1-cpu_time0 << " sec"<< std::endl;
      std::cout << "Analysis CPU time was: " << aux::pretty_time_string(1000*(cpu_time1-cpu_time0))<< std::endl;
-  return std::move(std::unique_ptr<analysis_hsm::AnalysedModel> (new analysis_hsm::AnalysedModel(model())));
+  return std::move(std::unique_ptr<analysis_hsm::AnalysedModel> (new analysis_hsm::AnalysedModel(ReleaseModel())));
 }
 
 void HSMAnalysis::RunAnalysis(const std::string& out_file_static) {
@@ -32,6 +32,7 @@
 #include <analysis_hsm/link.h>
 
 #include <iostream>
+#include <utility>
 
 #include <analysis_hsm/region.h>
 #include <dynamic_model_hsm/link.h>
@@ -39,12 +40,12 @@
 
 namespace analysis_hsm {
 
-Link::Link(const dm_hsm::Link& origin)
-    : dm_hsm::Link(origin) {
+Link::Link(dm_hsm::Link&& origin)
+    : dm_hsm::Link(std::move(origin)) {
   if (!tr_converter_ptrs_dm().empty()) {
     for (const auto& it : tr_converter_ptrs_dm()) {
           converter_ptrs_.emplace(it.first, std::shared_ptr<TransmissionConverter>
-          (new TransmissionConverter(*it.second))); // static_cast is necessary because of multiple inheritance
+          (new TransmissionConverter(std::move(*it.second))));
     }
   }
 }
@@ -56,7 +56,7 @@ class Link : public dm_hsm::Link {
   Link(Link&& other) = delete; // if this move c'tor is needed, special implementation is necessary, taking care of correct handling of the weak pointers
   Link& operator=(const Link&) = delete;
   Link& operator=(Link&&) = delete;
-  Link(const dm_hsm::Link& origin);
+  Link(dm_hsm::Link&& origin);
 
   /** \name Static Output Interface */
   ///@{
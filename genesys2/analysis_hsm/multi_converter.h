@@ -46,7 +46,7 @@ class MultiConverter : public dm_hsm::MultiConverter, public Converter {
   MultiConverter& operator=(const MultiConverter&) = delete;
   MultiConverter& operator=(MultiConverter&&) = delete;
 
-  MultiConverter(const dm_hsm::MultiConverter& origin)
+  MultiConverter(dm_hsm::MultiConverter&& origin)
         : builder::SysCompActPrototype(origin), // virtual inheritance and deleted default c'tor
           builder::ConverterPrototype(origin), // virtual inheritance and deleted default c'tor
           builder::MultiConverterProto(origin), // virtual inheritance and deleted default c'tor
@@ -56,11 +56,11 @@ class MultiConverter : public dm_hsm::MultiConverter, public Converter {
           sm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
           sm::Converter(origin), // virtual inheritance and deleted default c'tor
           sm::MultiConverter(origin), // virtual inheritance and deleted default c'tor
-          dm_hsm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
-          dm_hsm::Converter(origin), // virtual inheritance and deleted default c'tor
-          SysComponentActive(origin), // virtual inheritance and deleted default c'tor
-          dm_hsm::MultiConverter(origin),
-          Converter(origin) {}
+          dm_hsm::SysComponentActive(std::move(origin)), // virtual inheritance and deleted default c'tor
+          dm_hsm::Converter(std::move(origin)), // virtual inheritance and deleted default c'tor
+          SysComponentActive(std::move(origin)), // virtual inheritance and deleted default c'tor
+          dm_hsm::MultiConverter(std::move(origin)),
+          Converter(std::move(origin)) {}
 
   virtual void writeXmlVariables(io_routines::XmlWriter& xmlout, bool dynamic_output) override;
 };
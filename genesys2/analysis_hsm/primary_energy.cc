@@ -36,14 +36,18 @@ namespace analysis_hsm {
 
 void PrimaryEnergy::writeDynamicVariables(io_routines::XmlWriter& xmlout) {
   //std::cout << "writeStaticVariables "<< std::endl;
-  writeXmlElement(xmlout, "vopex_", get_vopex_() );
-  writeXmlElement(xmlout, "consumed_energy_", get_consumed_energy_() );
+  writeXmlElement(xmlout, "vopex_", get_vopex_(), true);
+  writeXmlElement(xmlout, "consumed_energy_", get_consumed_energy_(), true);
 }
 
-void PrimaryEnergy::writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConstAddable& dataObj) {
+void PrimaryEnergy::writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConstAddable& dataObj,
+                                    const bool dynamic) {
   xml_target.addSubElement("data");
     xml_target.addAttr("code", data_code);
-    xml_target.addTBD(dataObj);
+    if (dynamic)
+      xml_target.addSeries(dataObj);
+    else
+      xml_target.addTBD(dataObj);
   xml_target.closeSubElement();
 }
 
@@ -48,13 +48,14 @@ class PrimaryEnergy : public dm_hsm::PrimaryEnergy {
   PrimaryEnergy& operator=(const PrimaryEnergy&) = delete;
   PrimaryEnergy& operator=(PrimaryEnergy&&) = delete;
   //PrimaryEnergy(const am::PrimaryEnergy& origin)
-  PrimaryEnergy(const dm_hsm::PrimaryEnergy& origin)
-      : dm_hsm::PrimaryEnergy(origin) {}
+  PrimaryEnergy(dm_hsm::PrimaryEnergy&& origin)
+      : dm_hsm::PrimaryEnergy(std::move(origin)) {}
 
   void writeDynamicVariables(io_routines::XmlWriter& xmlout);
 
  private:
-  void writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConstAddable& dataObj);
+  void writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConstAddable& dataObj,
+                       const bool dynamic = false);
 };
 
 } /* namespace analysis_hsm */
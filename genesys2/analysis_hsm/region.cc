@@ -42,29 +42,29 @@
 
 namespace analysis_hsm {
 
-Region::Region(const dm_hsm::Region& origin)
-    : dm_hsm::Region(origin) {
+Region::Region(dm_hsm::Region&& origin)
+    : dm_hsm::Region(std::move(origin)) {
   //std::cout << "DEBUG: C-Tor an::Region::Region" << std::endl;
   for (const auto& it : converter_ptrs_dm()) {
     if (auto multi_conv = std::dynamic_pointer_cast<dm_hsm::MultiConverter>(it.second)) {
-      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(new MultiConverter(*multi_conv)));
+      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(new MultiConverter(std::move(*multi_conv))));
     } else {
       converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(
-            new Converter(static_cast<dm_hsm::Converter>(*it.second)))); // static_cast is necessary because of multiple inheritance
+            new Converter(std::move(static_cast<dm_hsm::Converter&>(*it.second))))); // static_cast is necessary because of multiple inheritance
     }
   }
   for (const auto& it : storage_ptrs_dm()) {
     if (auto storage = std::dynamic_pointer_cast<dm_hsm::Storage>(it.second)) {
-      storage_ptrs_.emplace(it.first, std::shared_ptr<Storage>(new Storage(*storage)));
+      storage_ptrs_.emplace(it.first, std::shared_ptr<Storage>(new Storage(std::move(*storage))));
       //std::cout << "copy2 storage_an = " << storage_ptrs_.find(it.first)->second->get_fopex().PrintToString() << std::endl;
     } else {
       storage_ptrs_.emplace(it.first, std::shared_ptr<analysis_hsm::Storage>(
-                  new analysis_hsm::Storage(static_cast<dm_hsm::Storage>(*it.second)))); // static_cast is necessary because of multiple inheritance
+                  new analysis_hsm::Storage(std::move(static_cast<dm_hsm::Storage&>(*it.second))))); // static_cast is necessary because of multiple inheritance
     }
 
   }
   for (const auto& it : primary_energy_ptrs_dm()) {
-    primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(*it.second)));
+    primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(std::move(*it.second))));
   }
   //std::cout << "DEBUG: END C-Tor an::Region::Region" << std::endl;
 }
@@ -107,11 +107,11 @@ void Region::writeXmlRegion(io_routines::XmlWriter& xmlout, const bool dynamic_o
   writeXmlElement(xmlout, "annual_co2_emissions", get_annual_co2_emissions_());
 		//dynamic output===============================================================================================
   if (dynamic_output){
-	writeXmlElement(xmlout, "load", get_load());
-    writeXmlElement(xmlout, "residual_load", get_residual_load_()); //original load
-    writeXmlElement(xmlout, "residual_heat_load", get_residual_heat_load_()); //original load
-    writeXmlElement(xmlout, "remaining_residual_load", get_remaining_residual_load_()); //modified load
-    writeXmlElement(xmlout, "remaining_residual_heat_load", get_remaining_residual_heat_load_()); //modified load
+	writeXmlElement(xmlout, "load", get_load(), true);
+    writeXmlElement(xmlout, "residual_load", get_residual_load_(), true); //original load
+    writeXmlElement(xmlout, "residual_heat_load", get_residual_heat_load_(), true); //original load
+    writeXmlElement(xmlout, "remaining_residual_load", get_remaining_residual_load_(), true); //modified load
+    writeXmlElement(xmlout, "remaining_residual_heat_load", get_remaining_residual_heat_load_(), true); //modified load
   }
   //  writeXmlElement(xmlout, "annual_co2_emissions", get_annual_co2_emissions_());
   //  writeXmlElement(xmlout, "annual_exported_electricity", get_annual_exported_electricity_GWh_());
@@ -122,11 +122,15 @@ void Region::writeXmlRegion(io_routines::XmlWriter& xmlout, const bool dynamic_o
   xmlout.closeTag();
 }
 
-void Region::writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConst& dataObj) {
+void Region::writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConst& dataObj,
+                             const bool dynamic) {
    //std::cout << "DEBUG: writing" << code() << " - output data=" << data_code <<std::endl;
    xml_target.addSubElement("data");
    xml_target.addAttr("code", data_code);
-   xml_target.addTBD(dataObj);
+   if (dynamic)
+     xml_target.addSeries(dataObj);
+   else
+     xml_target.addTBD(dataObj);
    xml_target.closeSubElement();
 }
 
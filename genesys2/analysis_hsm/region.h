@@ -56,7 +56,7 @@ class Region : public dm_hsm::Region {
   Region(Region&& other) = delete; //  if this move c'tor is needed, special implementation is necessary, taking care of correct handling of the weak pointers of the converter
   Region& operator=(const Region&) = delete;
   Region& operator=(Region&&) = delete;
-  Region(const dm_hsm::Region& origin);
+  Region(dm_hsm::Region&& origin);
 
   /** \name Output Interface */
   ///@{
@@ -64,7 +64,8 @@ class Region : public dm_hsm::Region {
   ///@}
 
  private:
-  void writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConst& dataObj);
+  void writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConst& dataObj,
+                       const bool dynamic = false);
   aux::TimeSeriesConst tscAnnualConsumption();
   aux::TimeSeriesConst tsc_annual_co2_potential();
   std::unordered_map<std::string, std::shared_ptr<PrimaryEnergy> > primary_energy_ptrs_;
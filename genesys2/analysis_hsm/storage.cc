@@ -41,8 +41,8 @@ void Storage::writeXmlVariables(io_routines::XmlWriter& xmlout, bool dynamic_out
   //std::cout << "FUNC-ID: Storage::writeXmlVariables \t" << code() << std::endl;
   analysis_hsm::SysComponentActive::writeXmlVariables(xmlout, dynamic_output);
   if (dynamic_output) {
-    writeXmlElement(xmlout, "charged_energy", get_charged_energy() );
-    writeXmlElement(xmlout, "energy_lost_by_transfer", get_energy_lost_by_transfer() );
+    writeXmlElement(xmlout, "charged_energy", get_charged_energy(), true);
+    writeXmlElement(xmlout, "energy_lost_by_transfer", get_energy_lost_by_transfer(), true);
   }
 }
 
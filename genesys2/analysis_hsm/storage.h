@@ -49,13 +49,13 @@ class Storage : public dm_hsm::Storage, public SysComponentActive {
   Storage(Storage&&) = default;
   Storage& operator=(const Storage&) = delete;
   Storage& operator=(Storage&&) = delete;
-  Storage(const dm_hsm::Storage& origin)
+  Storage(dm_hsm::Storage&& origin)
       : builder::SysCompActPrototype(origin), // virtual inheritance and deleted default c'tor
         am::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
         sm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
-        dm_hsm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
-        dm_hsm::Storage(origin),
-        SysComponentActive(origin) {}
+        dm_hsm::SysComponentActive(std::move(origin)), // virtual inheritance and deleted default c'tor
+        dm_hsm::Storage(std::move(origin)),
+        SysComponentActive(std::move(origin)) {}
 
   virtual void writeXmlVariables(io_routines::XmlWriter& xmlout, bool dynamic_output) override;
 };
@@ -46,15 +46,19 @@ void SysComponentActive::writeXmlVariables(io_routines::XmlWriter& xmlout, bool
   writeXmlElement(xmlout, "fopex", get_fopex());
   writeXmlElement(xmlout, "deprecated_capex", get_discounted_capex());
   if (dynamic_output) { //output of dynamic class properties hereafter
-    writeXmlElement(xmlout, "used_capacity", get_used_capacity());
-    writeXmlElement(xmlout, "vopex", get_vopex());
+    writeXmlElement(xmlout, "used_capacity", get_used_capacity(), true);
+    writeXmlElement(xmlout, "vopex", get_vopex(), true);
   }
 }
 
-void SysComponentActive::writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConstAddable& dataObj) {
+void SysComponentActive::writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConstAddable& dataObj,
+                                         const bool dynamic) {
   xml_target.addSubElement("data");
     xml_target.addAttr("code", data_code);
-    xml_target.addTBD(dataObj);
+    if (dynamic)
+      xml_target.addSeries(dataObj);
+    else
+      xml_target.addTBD(dataObj);
   xml_target.closeSubElement();
 }
 
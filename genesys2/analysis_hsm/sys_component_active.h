@@ -53,13 +53,14 @@ class SysComponentActive : public virtual dm_hsm::SysComponentActive {
  protected:
   SysComponentActive(const SysComponentActive&) = delete;
   SysComponentActive(SysComponentActive&&) = default;
-  SysComponentActive(const dm_hsm::SysComponentActive& origin)
+  SysComponentActive(dm_hsm::SysComponentActive&& origin)
       : builder::SysCompActPrototype(origin), // virtual inheritance and deleted default c'tor
         am::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
         sm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
-        dm_hsm::SysComponentActive(origin) {}
+        dm_hsm::SysComponentActive(std::move(origin)) {}
 
-  void writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConstAddable& dataObj);
+  void writeXmlElement(io_routines::XmlWriter& xml_target, std::string data_code, const aux::TimeSeriesConstAddable& dataObj,
+                       const bool dynamic = false);
   virtual void writeXmlVariables(io_routines::XmlWriter& xmlout, bool dynamic_output);
 };
 
@@ -38,7 +38,7 @@ void TransmissionConverter::writeXmlVariables(io_routines::XmlWriter& xmlout, bo
   analysis_hsm::Converter::writeXmlVariables(xmlout, dynamic_output);
   if (dynamic_output) {
     //output of dynamic class properties hereafter
-    writeXmlElement(xmlout, "delivered_energy", get_delivered_energy());
+    writeXmlElement(xmlout, "delivered_energy", get_delivered_energy(), true);
   }
 }
 
@@ -47,18 +47,18 @@ class TransmissionConverter : public dm_hsm::TransmissionConverter, public Conve
   TransmissionConverter(TransmissionConverter&&) = default;
   TransmissionConverter& operator=(const TransmissionConverter&) = delete;
   TransmissionConverter& operator=(TransmissionConverter&&) = delete;
-  TransmissionConverter(const dm_hsm::TransmissionConverter& origin)
+  TransmissionConverter(dm_hsm::TransmissionConverter&& origin)
       : builder::SysCompActPrototype(origin), // virtual inheritance and deleted default c'tor
         builder::ConverterPrototype(origin), // virtual inheritance and deleted default c'tor
         am::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
         am::Converter(origin), // virtual inheritance and deleted default c'tor
         sm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
         sm::Converter(origin), // virtual inheritance and deleted default c'tor
-        dm_hsm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
-        dm_hsm::Converter(origin), // virtual inheritance and deleted default c'tor
-        SysComponentActive(origin), // virtual inheritance and deleted default c'tor
-        dm_hsm::TransmissionConverter(origin),
-        Converter(origin) {}
+        dm_hsm::SysComponentActive(std::move(origin)), // virtual inheritance and deleted default c'tor
+        dm_hsm::Converter(std::move(origin)), // virtual inheritance and deleted default c'tor
+        SysComponentActive(std::move(origin)), // virtual inheritance and deleted default c'tor
+        dm_hsm::TransmissionConverter(std::move(origin)),
+        Converter(std::move(origin)) {}
 
   virtual void writeXmlVariables(io_routines::XmlWriter& xmlout, bool dynamic_output) override;
   //  double getDiscountedLosses(aux::SimulationClock::time_point start,
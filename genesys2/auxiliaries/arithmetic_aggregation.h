@@ -26,10 +26,10 @@ class ArithmeticAggregation : public TimeBasedData {
    */
   ArithmeticAggregation() = delete;
   virtual ~ArithmeticAggregation() override = default;
-  ArithmeticAggregation(const ArithmeticAggregation&);
-  ArithmeticAggregation(ArithmeticAggregation&&);
-  ArithmeticAggregation& operator=(const ArithmeticAggregation& other);
-  ArithmeticAggregation& operator=(ArithmeticAggregation&& other);
+  ArithmeticAggregation(const ArithmeticAggregation&) = default; // operands are shared, not cloned
+  ArithmeticAggregation(ArithmeticAggregation&&) = default;
+  ArithmeticAggregation& operator=(const ArithmeticAggregation& other) = default;
+  ArithmeticAggregation& operator=(ArithmeticAggregation&& other) = default;
   /**
   * @brief Constructor
   *
@@ -37,8 +37,8 @@ class ArithmeticAggregation : public TimeBasedData {
   * @param[in] tbd_b Time based Data
   * @param[in] binary_arithmetic_function Metafunction defining the binary arithmetic function to execute
   */
-  ArithmeticAggregation(std::unique_ptr<TimeBasedData> tbd_a,
-                        std::unique_ptr<TimeBasedData> tbd_b,
+  ArithmeticAggregation(std::shared_ptr<const TimeBasedData> tbd_a,
+                        std::shared_ptr<const TimeBasedData> tbd_b,
                         const std::function<double(double, double)>& binary_arithmetic_function)
     : tbd_a_(std::move(tbd_a)),
       tbd_b_(std::move(tbd_b)),
@@ -74,8 +74,8 @@ class ArithmeticAggregation : public TimeBasedData {
   virtual std::string PrintToString() const override {return "dummy return - AA is not printable (yet?)";}
 
  private:
-  std::unique_ptr<TimeBasedData> tbd_a_;
-  std::unique_ptr<TimeBasedData> tbd_b_;
+  std::shared_ptr<const TimeBasedData> tbd_a_;
+  std::shared_ptr<const TimeBasedData> tbd_b_;
   std::function<double(double, double)> binary_arithmetic_function_;
 };
 
@@ -84,22 +84,22 @@ class ArithmeticAggregation : public TimeBasedData {
  *
  * @return By the overloaded operator modified time based data
  */
-std::unique_ptr<TimeBasedData> operator +(std::unique_ptr<TimeBasedData> tbd_a,
-                                          std::unique_ptr<TimeBasedData> tbd_b);
+std::unique_ptr<TimeBasedData> operator +(std::shared_ptr<const TimeBasedData> tbd_a,
+                                          std::shared_ptr<const TimeBasedData> tbd_b);
 /**
  * @brief Overloaded operator defining the subtraction of time based data
  *
  * @return By the overloaded operator modified time based data
  */
-std::unique_ptr<TimeBasedData> operator -(std::unique_ptr<TimeBasedData> tbd_a,
-                                          std::unique_ptr<TimeBasedData> tbd_b);
+std::unique_ptr<TimeBasedData> operator -(std::shared_ptr<const TimeBasedData> tbd_a,
+                                          std::shared_ptr<const TimeBasedData> tbd_b);
 /**
  * @brief Overloaded operator defining the multiplication of time based data
  *
  * @return By the overloaded operator modified time based data
  */
-std::unique_ptr<TimeBasedData> operator *(std::unique_ptr<TimeBasedData> tbd_a,
-                                          std::unique_ptr<TimeBasedData> tbd_b);
+std::unique_ptr<TimeBasedData> operator *(std::shared_ptr<const TimeBasedData> tbd_a,
+                                          std::shared_ptr<const TimeBasedData> tbd_b);
 } /* namespace aux */
 
 #endif /* AUXILIARIES_ARITHMETIC_AGREGGATION_H_ */
@@ -17,6 +17,16 @@ double DateValuePairsConst::operator [](const SimulationClock::time_point& time_
   }
 }
 
+bool DateValuePairsConst::step_times(SimulationClock::time_point tp_start,
+                                     SimulationClock::time_point tp_end,
+                                     std::vector<SimulationClock::time_point>& steps) const {
+  for (const auto& it : data()) {
+    if (it.first > tp_start && it.first < tp_end)
+      steps.push_back(it.first);
+  }
+  return true;
+}
+
 double DateValuePairsConst::Mean(SimulationClock::time_point tp_start,
                                  SimulationClock::time_point tp_end) const {
   double rval = 0.0;
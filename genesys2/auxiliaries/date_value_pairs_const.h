@@ -56,6 +56,10 @@ class DateValuePairsConst : public DateValuePairs {
   virtual double Mean(SimulationClock::time_point tp_start,
                       SimulationClock::time_point tp_end) const override;
 
+  virtual bool step_times(SimulationClock::time_point tp_start,
+                          SimulationClock::time_point tp_end,
+                          std::vector<SimulationClock::time_point>& steps) const override;
+
   virtual std::string PrintToString() const override {return PrintToStringDVP("DVP_const");}
 };
 
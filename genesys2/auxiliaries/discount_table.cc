@@ -0,0 +1,117 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// discount_table.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <auxiliaries/discount_table.h>
+
+#include <exception>
+#include <iostream>
+#include <map>
+#include <mutex>
+
+namespace aux {
+
+namespace {
+
+const int kSharedHorizon = 200; // periods with precomputed factors per interest rate
+
+std::shared_ptr<const std::vector<double> > shared_factors(double interest_rate) {
+  // the tables of the own thread are checked first, so the lock is only taken once per thread and interest rate
+  thread_local std::map<double, std::shared_ptr<const std::vector<double> > > local_tables;
+  auto local_pos = local_tables.find(interest_rate);
+  if (local_pos != local_tables.end())
+    return local_pos->second;
+  static std::mutex tables_mutex;
+  static std::map<double, std::shared_ptr<const std::vector<double> > > tables;
+  std::shared_ptr<const std::vector<double> > factors;
+  {
+    std::lock_guard<std::mutex> lock(tables_mutex);
+    auto& shared = tables[interest_rate];
+    if (!shared) {
+      double base = 1.0 + interest_rate;
+      std::vector<double> values(kSharedHorizon);
+      for (int step = 0; step < kSharedHorizon; ++step)
+        values[step] = std::pow(base, -step);
+      shared = std::make_shared<const std::vector<double> >(std::move(values));
+    }
+    factors = shared;
+  }
+  local_tables.emplace(interest_rate, factors);
+  return factors;
+}
+
+} /* namespace */
+
+DiscountTable::DiscountTable(double interest_rate)
+    : base_(1.0 + interest_rate) {
+  if (interest_rate == -1.0) {
+    std::cerr << "ERROR in aux::DiscountTable::DiscountTable DIV by Zero - interest rate i must be != -1.0" << std::endl;
+    std::terminate();
+  }
+  factors_ = shared_factors(interest_rate);
+}
+
+double DiscountTable::discounted_sum(const double* values,
+                                     std::size_t count,
+                                     int first_step) const {
+  double discounted_sum = 0.0;
+  for (std::size_t i = 0; i < count; ++i)
+    discounted_sum += values[i] * factor(first_step + static_cast<int>(i));
+  return discounted_sum;
+}
+
+void DiscountTable::discounted_sums(const double* values,
+                                    std::size_t count,
+                                    std::size_t series,
+                                    int first_step,
+                                    double* sums) const {
+  for (std::size_t j = 0; j < series; ++j)
+    sums[j] = 0.0;
+  for (std::size_t i = 0; i < count; ++i) {
+    double current_factor = factor(first_step + static_cast<int>(i));
+    for (std::size_t j = 0; j < series; ++j)
+      sums[j] += values[j * count + i] * current_factor;
+  }
+}
+
+double DiscountTable::discounted_sum(const TimeBasedData& tbd,
+                                     SimulationClock::time_point start,
+                                     SimulationClock::time_point end,
+                                     SimulationClock::duration period,
+                                     SimulationClock::time_point present) const {
+  auto count = periods(start, end, period);
+  if (count == 0)
+    return 0.0;
+  std::vector<double> values(count);
+  tbd.sample(start, period, count, values.data());
+  return discounted_sum(values.data(), count, first_step(start, present));
+}
+
+} /* namespace aux */
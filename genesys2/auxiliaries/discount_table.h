@@ -0,0 +1,110 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// discount_table.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef AUXILIARIES_DISCOUNT_TABLE_H_
+#define AUXILIARIES_DISCOUNT_TABLE_H_
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <auxiliaries/simulation_clock.h>
+#include <auxiliaries/time_based_data.h>
+
+namespace aux {
+
+/**
+ * @brief Discount factors (1 + interest_rate)^-step of one interest rate
+ * @details The factors of the first periods are computed once per interest rate and shared by all tables of the
+ *          model and all threads. Steps outside of the shared horizon are computed on demand. The sums are identical
+ *          to the former step by step evaluation, the factors are only looked up instead of recomputed.
+ */
+class DiscountTable {
+ public:
+  DiscountTable() = delete;
+  explicit DiscountTable(double interest_rate);
+
+  double factor(int step) const {
+    return (0 <= step && static_cast<std::size_t>(step) < factors_->size()) ? (*factors_)[step]
+                                                                              : std::pow(base_, -step);
+  }
+
+  /**
+   * @brief Dot product of count annual values with the factors, values[i] is discounted by first_step + i periods
+   */
+  double discounted_sum(const double* values,
+                        std::size_t count,
+                        int first_step) const;
+
+  /**
+   * @brief Same as discounted_sum for several series of count values each, stored one after the other in values
+   *
+   * @param[out] sums Array of at least series elements, sums[j] = discounted_sum(values + j * count, count, first_step)
+   */
+  void discounted_sums(const double* values,
+                       std::size_t count,
+                       std::size_t series,
+                       int first_step,
+                       double* sums) const;
+
+  /**
+   * @brief Discounts the time based data at start, start + period, ... before end to present
+   * @details The data is sampled once into an array, see TimeBasedData::sample
+   */
+  double discounted_sum(const TimeBasedData& tbd,
+                        SimulationClock::time_point start,
+                        SimulationClock::time_point end,
+                        SimulationClock::duration period,
+                        SimulationClock::time_point present) const;
+
+  /**
+   * @brief Number of periods starting within [start, end)
+   */
+  static std::size_t periods(SimulationClock::time_point start,
+                             SimulationClock::time_point end,
+                             SimulationClock::duration period) {
+    return (start < end) ? static_cast<std::size_t>((end - start - SimulationClock::duration(1)) / period) + 1 : 0;
+  }
+  /**
+   * @brief Number of whole years from present to start, the first step of discounted_sum
+   */
+  static int first_step(SimulationClock::time_point start,
+                        SimulationClock::time_point present) {return (start - present) / years(1);}
+
+ private:
+  double base_;
+  std::shared_ptr<const std::vector<double> > factors_;
+};
+
+} /* namespace aux */
+
+#endif /* AUXILIARIES_DISCOUNT_TABLE_H_ */
@@ -6,6 +6,7 @@
  */
 
 #include <auxiliaries/functions.h>
+#include <auxiliaries/discount_table.h>
 #include <program_settings.h>
 
 #include <cmath>
@@ -23,22 +24,12 @@ double DiscountFuture2(const aux::TimeBasedData& tbd,
                       double interest_rate,
                       aux::SimulationClock::time_point present_day) {
   //   std::cout << "FUNC-ID: DiscountFuture2\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<<std::endl;
-  double discounted_sum = 0.0;
-  int initial_steps = (start_discount_horizon - present_day) / years(1);
-
-  if (interest_rate != -1.0) {
-    double base = 1.0 + interest_rate;
-    auto internal_present = start_discount_horizon;
-    for (int step = initial_steps; internal_present < end_discount_horizon; ++step) {
-      //      std::cout << "\tstart horizon = " << aux::SimulationClock::time_point_to_string(internal_present) << " | step= " << step << std::endl;
-      discounted_sum += tbd[internal_present] * std::pow(base, -step);
-      internal_present += period;
-    }
-  } else {
+  if (interest_rate == -1.0) {
     std::cerr << "ERROR in aux::Function::DiscountFuture DIV by Zero - interest rate i must be != -1.0" << std::endl;
     std::terminate();
   }
-  return discounted_sum;
+  return DiscountTable(interest_rate).discounted_sum(tbd, start_discount_horizon, end_discount_horizon, period,
+                                                     present_day);
 }
 
 double timed_value_annual(double value,
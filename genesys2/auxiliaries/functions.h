@@ -23,6 +23,7 @@ namespace aux {
 
 /**
  * @brief Discounting the time based data by a given rate
+ * @details Uses the shared factors of aux::DiscountTable, callers discounting several series should use the table
  *
  * @param[in] tbd Time based data
  * @param[in] present Start time point
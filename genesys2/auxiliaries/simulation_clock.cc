@@ -108,6 +108,28 @@ SimulationClock::SimulationClock(const duration duration_since_epoch,
   }
 }
 
+SimulationClock::Calendar::Calendar(time_point tp_start,
+                                    time_point tp_end,
+                                    duration tick_length)
+    : start_(tp_start),
+      end_(tp_end),
+      tick_length_(tick_length),
+      first_year_(year(tp_start)) {
+  if (tick_length_ <= duration(0)) {
+      std::cerr << "Error in aux::SimulationClock::Calendar::Calendar :" << std::endl
+          << "Tick length must be positive." << std::endl;
+      std::terminate();
+  }
+  if (!(tp_start < tp_end))
+    return;
+  for (int current_year = first_year_; current_year <= year(tp_end - duration(1)); ++current_year) {
+    auto begin = (current_year == first_year_) ? tp_start : time_point(years(current_year - epoch_[0]));
+    year_starts_.push_back(time_point(years(current_year - epoch_[0])));
+    // ceil of the distance in ticks
+    first_ticks_.push_back(static_cast<std::size_t>((begin - tp_start + tick_length_ - duration(1)) / tick_length_));
+  }
+}
+
 const std::array<int, 5> SimulationClock::epoch_ = {1970, 1, 1, 0, 0};
 
 } /* namespace aux */
@@ -34,9 +34,11 @@
 
 #include <array>
 #include <chrono>
+#include <cstddef>
 #include <ratio>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 namespace aux {
 
@@ -88,6 +90,11 @@ class SimulationClock {
 
   static int year(time_point tp) {return 1970 + tp.time_since_epoch().count()/(8760*60);}
 
+  /**
+  * @brief Return the first time point (01-01_00:00) of the year of tp, same as time_point_from_string without parsing
+  */
+  static time_point year_start(time_point tp) {return time_point(years(year(tp) - 1970));}
+
 
   /**
   * @brief Get tick length of the clock
@@ -204,6 +211,36 @@ class SimulationClock {
   static double p2e(double power,
                     duration p2e_duration);
 
+  /**
+  * @brief Year boundaries of a simulation window, computed once from integer durations
+  * @details Year k of the table is the k-th calendar year touched by [tp_start, tp_end). The tick indices count
+  * the ticks of tick_length from tp_start, so annual segments need neither clock.year() per tick nor strings.
+  */
+  class Calendar {
+   public:
+    Calendar() = delete;
+    Calendar(time_point tp_start,
+             time_point tp_end,
+             duration tick_length);
+
+    time_point start() const {return start_;}
+    time_point end() const {return end_;}
+    duration tick_length() const {return tick_length_;}
+    std::size_t size() const {return year_starts_.size();} ///< number of years in the table
+    std::size_t year_index(time_point tp) const {return static_cast<std::size_t>(year(tp) - first_year_);}
+    time_point year_start(std::size_t index) const {return year_starts_[index];}
+    std::size_t first_tick(std::size_t index) const {return first_ticks_[index];} ///< first tick at or after the year start
+    time_point tick_time(std::size_t tick) const {return start_ + static_cast<rep>(tick) * tick_length_;}
+
+   private:
+    time_point start_;
+    time_point end_;
+    duration tick_length_;
+    int first_year_;
+    std::vector<time_point> year_starts_;
+    std::vector<std::size_t> first_ticks_;
+  };
+
  private:
   SimulationClock(const duration duration_since_epoch,
                   rep tick_length);
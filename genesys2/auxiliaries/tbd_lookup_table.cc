@@ -15,54 +15,143 @@
 
 namespace aux {
 
-TBDLookupTable::TBDLookupTable(const TBDLookupTable& other) {
-  if (!other.data_.empty()) {
-    for (const auto& i : other.data_) {
-      data_.emplace_back(std::move((*(i.first)).clone()), std::move((*(i.second)).clone()));
+double TBDLookupTable::operator [](const SimulationClock::time_point& time_point) const {
+  index_type row;
+  if (baked_row(time_point, row)) {
+    const double* bases = &baked_bases_[row];
+    const double* values = &baked_values_[row];
+    return weighted_value(data_.size(),
+                          [bases](index_type i) {return bases[i];},
+                          [values](index_type i) {return values[i];});
+  }
+  return weighted_value(data_.size(),
+                        [&](index_type i) {return (*data_[i].first)[time_point];},
+                        [&](index_type i) {return (*data_[i].second)[time_point];});
+}
+//for use with efficiencies
+double TBDLookupTable::rlookup(const SimulationClock::time_point& time_point,
+                              double query,
+                              double offset) const {
+  if (query < -genesys::ProgramSettings::approx_epsilon()) {
+    std::cerr << "ERROR in TBDLookupTable::rlookup: query < 0.0 not allowed - query = "<< query  << std::endl;
+    std::terminate();
+  }
+  // iterate from the last element
+  const auto last = data_.size() - 1;
+  index_type row;
+  if (baked_row(time_point, row)) {
+    const double* bases = &baked_bases_[row];
+    const double* values = &baked_values_[row];
+    return query_value(data_.size(),
+                       [bases, last](index_type i) {return bases[last - i];},
+                       [values, last](index_type i) {return values[last - i];},
+                       query, offset);
+  }
+  return query_value(data_.size(),
+                     [&](index_type i) {return (*data_[last - i].first)[time_point];},
+                     [&](index_type i) {return (*data_[last - i].second)[time_point];},
+                     query, offset);
+}
+//for capacities
+double TBDLookupTable::lookup(const SimulationClock::time_point& time_point,
+                              double query,
+                              double offset) const {
+  if (query < -genesys::ProgramSettings::approx_epsilon()) {
+    std::cerr << "ERROR in TBDLookupTable::lookup: query < 0.0 not allowed - query = "<< query  << std::endl;
+    std::terminate();
+  }
+  index_type row;
+  if (baked_row(time_point, row)) {
+    const double* bases = &baked_bases_[row];
+    const double* values = &baked_values_[row];
+    return query_value(data_.size(),
+                       [bases](index_type i) {return bases[i];},
+                       [values](index_type i) {return values[i];},
+                       query, offset);
+  }
+  return query_value(data_.size(),
+                     [&](index_type i) {return (*data_[i].first)[time_point];},
+                     [&](index_type i) {return (*data_[i].second)[time_point];},
+                     query, offset);
+}
+
+void TBDLookupTable::lookup_series(SimulationClock::time_point tp_start,
+                                   SimulationClock::duration interval,
+                                   std::size_t count,
+                                   const double* query,
+                                   double* values) const {
+  // column i * count + t holds element i at time point t
+  std::vector<double> bases(data_.size() * count);
+  std::vector<double> element_values(data_.size() * count);
+  for (index_type i = 0; i < data_.size(); ++i) {
+    data_[i].first->sample(tp_start, interval, count, &bases[i * count]);
+    data_[i].second->sample(tp_start, interval, count, &element_values[i * count]);
+  }
+  for (std::size_t t = 0; t < count; ++t) {
+    if (query[t] < -genesys::ProgramSettings::approx_epsilon()) {
+      std::cerr << "ERROR in TBDLookupTable::lookup_series: query < 0.0 not allowed - query = "<< query[t]  << std::endl;
+      std::terminate();
     }
+    values[t] = query_value(data_.size(),
+                            [&](index_type i) {return bases[i * count + t];},
+                            [&](index_type i) {return element_values[i * count + t];},
+                            query[t], 0.0);
   }
 }
 
-TBDLookupTable& TBDLookupTable::operator=(const TBDLookupTable& other) {
-  data_.clear();
-  if (!other.data_.empty()) {
-    for (const auto& i : other.data_) {
-      data_.emplace_back(std::move((*(i.first)).clone()), std::move((*(i.second)).clone()));
+void TBDLookupTable::bake(SimulationClock::time_point tp_start,
+                          SimulationClock::time_point tp_end) {
+  clear_baked();
+  if (data_.empty() || !(tp_start < tp_end))
+    return;
+  std::vector<SimulationClock::time_point> steps{tp_start};
+  for (const auto& i : data_) {
+    if (!i.first->step_times(tp_start, tp_end, steps) || !i.second->step_times(tp_start, tp_end, steps))
+      return; // not piecewise constant - table stays unbaked
+  }
+  std::sort(steps.begin(), steps.end());
+  steps.erase(std::unique(steps.begin(), steps.end()), steps.end());
+  baked_bases_.reserve(steps.size() * data_.size());
+  baked_values_.reserve(steps.size() * data_.size());
+  for (const auto& tp : steps) {
+    for (const auto& i : data_) {
+      baked_bases_.push_back((*i.first)[tp]);
+      baked_values_.push_back((*i.second)[tp]);
     }
   }
-  return *this;
+  steps.push_back(tp_end);
+  baked_steps_ = std::move(steps);
 }
 
-TBDLookupTable& TBDLookupTable::operator=(TBDLookupTable&& other) {
-  data_ = std::move(other.data_);
-  return *this;
+bool TBDLookupTable::baked_row(const SimulationClock::time_point& time_point, index_type& row) const {
+  if (baked_steps_.empty() || time_point < baked_steps_.front() || !(time_point < baked_steps_.back()))
+    return false;
+  auto segment = std::upper_bound(baked_steps_.cbegin(), baked_steps_.cend(), time_point) - baked_steps_.cbegin() - 1;
+  row = static_cast<index_type>(segment) * data_.size();
+  return true;
 }
 
-double TBDLookupTable::operator [](const SimulationClock::time_point& time_point) const {
+template <typename Base, typename Value>
+double TBDLookupTable::weighted_value(index_type count, Base base, Value value) {
   double rval = 0.0;
   double sum_of_prev_bases = 0.0;
-  for (const auto& i : data_) {
-    double current_base = (*i.first)[time_point];
+  for (index_type i = 0; i < count; ++i) {
+    double current_base = base(i);
     if (current_base != 0.0) {
       sum_of_prev_bases += current_base;
-      rval += (current_base / sum_of_prev_bases) * ((*i.second)[time_point] - rval);
+      rval += (current_base / sum_of_prev_bases) * (value(i) - rval);
     }
   }
   return rval;
 }
-//for use with efficiencies
-double TBDLookupTable::rlookup(const SimulationClock::time_point& time_point,
-                              double query,
-                              double offset) const {
-  if (query < -genesys::ProgramSettings::approx_epsilon()) {
-    std::cerr << "ERROR in TBDLookupTable::rlookup: query < 0.0 not allowed - query = "<< query  << std::endl;
-    std::terminate();
-  }
+
+template <typename Base, typename Value>
+double TBDLookupTable::query_value(index_type count, Base base, Value value, double query, double offset) {
   // iterate over offset
   double current_base;
-  auto it = data_.rbegin();
-  for (; it < data_.rend(); ++it) {
-    if ((current_base = (*it->first)[time_point]) <= offset) {
+  index_type i = 0;
+  for (; i < count; ++i) {
+    if ((current_base = base(i)) <= offset) {
       offset -= current_base;
     } else {
       break;
@@ -70,79 +159,32 @@ double TBDLookupTable::rlookup(const SimulationClock::time_point& time_point,
   }
   // zero query is a special case
   if (query == 0.0) {
-    if (it != data_.rend())
-      return (*it->second)[time_point]; // offset is within current element
+    if (i != count)
+      return value(i); // offset is within current element
     return 0.0; // this->data_ is empty or offset past last element
   }
   double rval(0.0);
   double sum_of_prev_bases(0.0);
-  // the element that iterator currently points to is (first) part of query
+  // the element that i currently points to is (first) part of query
   auto query_countdown = query + offset;
   double current_base_active;
-  for (; it < data_.rend(); ++it) {
-    if ((current_base = (*it->first)[time_point]) < query_countdown) {
+  for (; i < count; ++i) {
+    if ((current_base = base(i)) < query_countdown) {
       // current element inside query
       query_countdown -= current_base;
       current_base_active = current_base - offset;
       sum_of_prev_bases += current_base_active;
-      rval += (current_base_active / sum_of_prev_bases) * ((*it->second)[time_point] - rval);
+      rval += (current_base_active / sum_of_prev_bases) * (value(i) - rval);
     } else {
-      // query finished within element that iterator currently points to
+      // query finished within element that i currently points to
       current_base_active = std::min(current_base - offset, std::min(query_countdown, query));
-      rval += (current_base_active / (sum_of_prev_bases + current_base_active)) * ((*it->second)[time_point] - rval);
+      rval += (current_base_active / (sum_of_prev_bases + current_base_active)) * (value(i) - rval);
       break;
     }
     offset = 0.0;
   }
-  // iterator at last element and offset/query go past last element
+  // i at last element and offset/query go past last element
   return rval;
 }
-//for capacities
-double TBDLookupTable::lookup(const SimulationClock::time_point& time_point,
-                              double query,
-                              double offset) const {
-  if (query < -genesys::ProgramSettings::approx_epsilon()) {
-      std::cerr << "ERROR in TBDLookupTable::lookup: query < 0.0 not allowed - query = "<< query  << std::endl;
-	    std::terminate();
-	  }
-	  // iterate over offset
-	  double current_base;
-	  auto it = data_.cbegin();
-	  for (; it < data_.cend(); ++it) {
-	    if ((current_base = (*it->first)[time_point]) <= offset) {
-	      offset -= current_base;
-	    } else {
-	      break;
-	    }
-	  }
-	  // zero query is a special case
-	  if (query == 0.0) {
-	    if (it != data_.cend())
-	      return (*it->second)[time_point]; // offset is within current element
-	    return 0.0; // this->data_ is empty or offset past last element
-	  }
-	  double rval(0.0);
-	  double sum_of_prev_bases(0.0);
-	  // the element that iterator currently points to is (first) part of query
-	  auto query_countdown = query + offset;
-	  double current_base_active;
-	  for (; it < data_.cend(); ++it) {
-	    if ((current_base = (*it->first)[time_point]) < query_countdown) {
-	      // current element inside query
-	      query_countdown -= current_base;
-	      current_base_active = current_base - offset;
-	      sum_of_prev_bases += current_base_active;
-	      rval += (current_base_active / sum_of_prev_bases) * ((*it->second)[time_point] - rval);
-	    } else {
-	      // query finished within element that iterator currently points to
-	      current_base_active = std::min(current_base - offset, std::min(query_countdown, query));
-	      rval += (current_base_active / (sum_of_prev_bases + current_base_active)) * ((*it->second)[time_point] - rval);
-	      break;
-	    }
-	    offset = 0.0;
-	  }
-	  // iterator at last element and offset/query go past last element
-	  return rval;
-}
 
 } /* namespace aux */
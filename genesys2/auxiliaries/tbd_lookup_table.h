@@ -8,6 +8,7 @@
 #ifndef AUXILIARIES_TBD_LOOKUP_TABLE_H_
 #define AUXILIARIES_TBD_LOOKUP_TABLE_H_
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -21,10 +22,10 @@ class TBDLookupTable {
  public:
   TBDLookupTable() = default;
   ~TBDLookupTable() = default;
-  TBDLookupTable(const TBDLookupTable& other);
+  TBDLookupTable(const TBDLookupTable& other) = default; // elements are shared, not cloned
   TBDLookupTable(TBDLookupTable&&) = default;
-  TBDLookupTable& operator=(const TBDLookupTable& other);
-  TBDLookupTable& operator=(TBDLookupTable&& other);
+  TBDLookupTable& operator=(const TBDLookupTable& other) = default;
+  TBDLookupTable& operator=(TBDLookupTable&& other) = default;
 
   double operator [](const SimulationClock::time_point& time_point) const;
 
@@ -36,11 +37,51 @@ class TBDLookupTable {
                 double query,
                 double offset = 0.0) const;
 
-  void complement(std::unique_ptr<TimeBasedData> base,
-              std::unique_ptr<TimeBasedData> value) {data_.emplace_back(std::move(base), std::move(value));}
+  /**
+   * @brief Same as lookup for count equidistant time points, each with its own query
+   * @details All bases and values are sampled once into contiguous columns, so no virtual call is made per time point
+   *
+   * @param[in] tp_start First time point
+   * @param[in] interval Distance between two time points
+   * @param[in] count Number of time points
+   * @param[in] query Array of count queries
+   * @param[out] values Array of at least count elements receiving the results
+   */
+  void lookup_series(SimulationClock::time_point tp_start,
+                     SimulationClock::duration interval,
+                     std::size_t count,
+                     const double* query,
+                     double* values) const;
+
+  void complement(std::shared_ptr<const TimeBasedData> base,
+                  std::shared_ptr<const TimeBasedData> value) {clear_baked(); data_.emplace_back(std::move(base), std::move(value));}
+
+  /**
+   * @brief Samples all bases and values once per constant segment of [tp_start, tp_end) into contiguous arrays
+   * @details Queries within the window are answered from the arrays without virtual calls. Baking requires all
+   * elements to be piecewise constant, otherwise the table stays unbaked. complement() discards the arrays.
+   */
+  void bake(SimulationClock::time_point tp_start,
+            SimulationClock::time_point tp_end);
+  bool baked() const {return !baked_steps_.empty();}
 
  private:
-  std::vector<std::pair<std::unique_ptr<TimeBasedData>, std::unique_ptr<TimeBasedData> > > data_;
+  /// the elements are read-only, copies of the table share them
+  typedef std::vector<std::pair<std::shared_ptr<const TimeBasedData>,
+                                std::shared_ptr<const TimeBasedData> > > data_structure;
+  typedef data_structure::size_type index_type;
+
+  template <typename Base, typename Value>
+  static double weighted_value(index_type count, Base base, Value value);
+  template <typename Base, typename Value>
+  static double query_value(index_type count, Base base, Value value, double query, double offset);
+  bool baked_row(const SimulationClock::time_point& time_point, index_type& row) const;
+  void clear_baked() {baked_steps_.clear(); baked_bases_.clear(); baked_values_.clear();}
+
+  data_structure data_;
+  std::vector<SimulationClock::time_point> baked_steps_; ///< start of each constant segment and end of the window
+  std::vector<double> baked_bases_; ///< bases of all elements, one row per segment
+  std::vector<double> baked_values_; ///< values of all elements, one row per segment
 };
 
 } /* namespace aux */
@@ -9,4 +9,12 @@
 
 namespace aux {
 
+void TimeBasedData::sample(SimulationClock::time_point tp_start,
+                           SimulationClock::duration interval,
+                           std::size_t count,
+                           double* values) const {
+  for (std::size_t i = 0; i < count; ++i, tp_start += interval)
+    values[i] = (*this)[tp_start];
+}
+
 } /* namespace aux */
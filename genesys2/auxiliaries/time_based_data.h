@@ -8,6 +8,7 @@
 #ifndef AUXILIARIES_TIME_BASED_DATA_H_
 #define AUXILIARIES_TIME_BASED_DATA_H_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -55,6 +56,33 @@ class TimeBasedData {
   virtual double Mean(SimulationClock::time_point,
                       SimulationClock::time_point) const {return 0.0;} // dummy return
 
+  /**
+   * @brief Collects the time points at which piecewise constant data changes its value
+   * @details Used by TBDLookupTable::bake, data that is not piecewise constant returns false
+   *
+   * @param[in] tp_start Start of the time window
+   * @param[in] tp_end End of the time window
+   * @param[out] steps All time points within (tp_start, tp_end) at which the value may change are appended
+   * @return True if the data is piecewise constant
+   */
+  virtual bool step_times(SimulationClock::time_point,
+                          SimulationClock::time_point,
+                          std::vector<SimulationClock::time_point>&) const {return false;}
+
+  /**
+   * @brief Samples the data at equidistant time points into a contiguous array
+   * @details The default calls operator[] once per time point, subclasses resolve the positions without virtual calls
+   *
+   * @param[in] tp_start First time point
+   * @param[in] interval Distance between two time points
+   * @param[in] count Number of time points
+   * @param[out] values Array of at least count elements, values[i] = (*this)[tp_start + i * interval]
+   */
+  virtual void sample(SimulationClock::time_point tp_start,
+                      SimulationClock::duration interval,
+                      std::size_t count,
+                      double* values) const;
+
   /**
    * @brief Virtual function defining the conversion of time based data to string
    *
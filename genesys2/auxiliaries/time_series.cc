@@ -54,6 +54,13 @@ std::tuple<std::string, std::string, std::string> TimeSeries::toXml() const {
   return t;
 }
 
+std::tuple<std::string, std::string, const double*, std::size_t> TimeSeries::toBinary() const {
+  return std::make_tuple(aux::SimulationClock::time_point_to_string(start()),
+                         aux::SimulationClock::duration_to_string(interval()),
+                         values_.data(),
+                         values_.size());
+}
+
 std::unique_ptr<TimeBasedData> aux::TimeSeries::clone() const {
   std::cerr << "Error in aux::TimeSeries::clone :" << std::endl
       << "Call to this dummy member function is undefined." << std::endl;
@@ -100,4 +107,22 @@ void TimeSeries::update_interval(SimulationClock::duration new_interval) {
   }
 }
 
+void TimeSeries::restart_values(double value,
+                                SimulationClock::time_point start,
+                                SimulationClock::duration interval) {
+  values_.assign(1, value);
+  size_ = 1;
+  interval_ = interval;
+  start_ = start;
+  end_ = start;
+}
+
+void TimeSeries::clear_values() {
+  values_.assign(1, 0.0);
+  size_ = 0;
+  interval_ = interval_type::zero();
+  start_ = SimulationClock::time_point();
+  end_ = SimulationClock::time_point();
+}
+
 }/* namespace aux */
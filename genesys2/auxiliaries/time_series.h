@@ -32,6 +32,7 @@
 #ifndef AUXILIARIES_TIME_SERIES_H_
 #define AUXILIARIES_TIME_SERIES_H_
 
+#include <cstddef>
 #include <exception>
 #include <iostream>
 #include <memory>
@@ -51,6 +52,10 @@ class TimeSeries : public TimeBasedData {
     * @brief Default deconstructor
     */
   virtual ~TimeSeries() = default;
+  TimeSeries(const TimeSeries&) = default;
+  TimeSeries(TimeSeries&&) = default; // the user-declared d'tor would otherwise turn moves into copies of values_
+  TimeSeries& operator=(const TimeSeries&) = default;
+  TimeSeries& operator=(TimeSeries&&) = default;
 
   /**
    * @brief Gets the start time point of the time based data
@@ -66,6 +71,12 @@ class TimeSeries : public TimeBasedData {
    */
   virtual std::string PrintToString() const override {return "dummy return - this is plain TS, should not be instantiated";}
   std::tuple<std::string, std::string, std::string> toXml() const;
+  /**
+   * @brief Same content as toXml, but the values are handed out in place for binary output
+   *
+   * @return start, interval, pointer to the first value and number of values
+   */
+  std::tuple<std::string, std::string, const double*, std::size_t> toBinary() const;
 
   virtual bool empty() const override{return ((size() > 0) ? false : true);}
 
@@ -154,7 +165,7 @@ class TimeSeries : public TimeBasedData {
    *
    * @return Values of the time based data
    */
-  data_structure values() const {return (values_);}
+  const data_structure& values() const {return (values_);}
 
   /**
    * @brief Gets the value of the time based data specified by the input variable
@@ -211,6 +222,29 @@ class TimeSeries : public TimeBasedData {
    */
   void update_interval(SimulationClock::duration interval);
 
+  /**
+   * @brief Reserves storage for the values of the time based data without changing its length
+
+   * @param[in] capacity Number of values to reserve storage for
+   */
+  void reserve_values(index_type capacity) {values_.reserve(capacity);}
+
+  /**
+   * @brief Restarts the time based data with a single value, the allocated storage is kept
+
+   * @param[in] value First value of the restarted time based data
+   * @param[in] start Start time point of the restarted time based data
+   * @param[in] interval Interval length of the restarted time based data
+   */
+  void restart_values(double value,
+                      SimulationClock::time_point start,
+                      SimulationClock::duration interval);
+
+  /**
+   * @brief Resets to the empty state of the default constructor, the allocated storage is kept
+   */
+  void clear_values();
+
  private:
   data_structure values_;
   index_type size_;
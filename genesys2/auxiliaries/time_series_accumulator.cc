@@ -0,0 +1,118 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// time_series_accumulator.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <auxiliaries/time_series_accumulator.h>
+
+#include <vector>
+
+namespace aux {
+
+void TimeSeriesAccumulator::add_pulse(double value,
+                                      SimulationClock::time_point time_point,
+                                      SimulationClock::duration interval) {
+  index_type index;
+  if (empty()) {
+    restart_values(value, time_point, interval);
+    append(0.);
+    update_end(time_point + interval);
+  } else if (locate_tick(time_point, interval, index)) {
+    // the interval after the pulse keeps the previous last value, gaps are filled with it as well
+    if (index + 1 >= size())
+      extend_to(index + 2);
+    add_assign_value(value, index);
+  } else { // not on the grid of this time series
+    *this += TimeSeriesConst(std::vector<double>{value, 0.}, time_point, interval);
+  }
+}
+
+void TimeSeriesAccumulator::add_pulses(const double* values,
+                                       std::size_t count,
+                                       SimulationClock::time_point time_point,
+                                       SimulationClock::duration interval) {
+  if (count == 0)
+    return;
+  add_pulse(values[0], time_point, interval);
+  index_type index;
+  if (locate_tick(time_point, interval, index)) {
+    // on the grid: grow once to the final size, then each interval receives its value
+    if (index + count >= size())
+      extend_to(index + count + 1);
+    for (std::size_t i = 1; i < count; ++i)
+      add_assign_value(values[i], index + i);
+  } else {
+    for (std::size_t i = 1; i < count; ++i)
+      add_pulse(values[i], time_point + static_cast<SimulationClock::duration::rep>(i) * interval, interval);
+  }
+}
+
+void TimeSeriesAccumulator::add_step(double value,
+                                     SimulationClock::time_point time_point,
+                                     SimulationClock::duration interval) {
+  index_type index;
+  if (empty()) {
+    restart_values(value, time_point, interval);
+  } else if (locate_tick(time_point, interval, index) && (index + 1 >= size())) {
+    // steps are recorded in chronological order, the new value persists after the last interval
+    if (index >= size())
+      extend_to(index + 1);
+    add_assign_value(value, index);
+  } else { // earlier time point or not on the grid of this time series
+    *this += TimeSeriesConst(std::vector<double>{value}, time_point, interval);
+  }
+}
+
+void TimeSeriesAccumulator::reserve(SimulationClock::time_point start,
+                                    SimulationClock::time_point end,
+                                    SimulationClock::duration interval) {
+  if ((end > start) && (interval > SimulationClock::duration::zero()))
+    reserve_values(static_cast<index_type>((end - start) / interval) + 2);
+}
+
+bool TimeSeriesAccumulator::locate_tick(SimulationClock::time_point time_point,
+                                        SimulationClock::duration interval_tp,
+                                        index_type& index) const {
+  if ((interval_tp != interval()) || (time_point < start()))
+    return false;
+  auto distance = time_point - start();
+  if ((distance % interval()) != SimulationClock::duration::zero())
+    return false;
+  index = static_cast<index_type>(distance / interval());
+  return true;
+}
+
+void TimeSeriesAccumulator::extend_to(index_type new_size) {
+  auto old_end = value(size() - 1);
+  while (size() < new_size)
+    append(old_end);
+  update_end(start() + interval() * (size() - 1));
+}
+
+} /* namespace aux */
@@ -0,0 +1,140 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// time_series_accumulator.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef AUXILIARIES_TIME_SERIES_ACCUMULATOR_H_
+#define AUXILIARIES_TIME_SERIES_ACCUMULATOR_H_
+
+#include <cstddef>
+#include <memory>
+
+#include <auxiliaries/simulation_clock.h>
+#include <auxiliaries/time_series_const_addable.h>
+
+namespace aux {
+
+class TimeSeriesAccumulator : public TimeSeriesConstAddable {
+ public:
+
+  /**
+  * @brief Default constructor
+  */
+  TimeSeriesAccumulator() = default;
+  /**
+  * @brief Default Destructor
+  */
+  virtual ~TimeSeriesAccumulator() = default;
+  TimeSeriesAccumulator(const TimeSeriesAccumulator&) = default;
+  TimeSeriesAccumulator(TimeSeriesAccumulator&&) = default;
+  TimeSeriesAccumulator& operator=(const TimeSeriesAccumulator&) = default;
+  TimeSeriesAccumulator& operator=(TimeSeriesAccumulator&&) = default;
+  TimeSeriesAccumulator(const TimeSeriesConstAddable& other)
+      : TimeSeriesConstAddable(other) {}
+
+  /**
+   * @brief Copies and stores the time based data in a new unique pointer
+   *
+   * @return Unique pointer containing the copied time based data
+   */
+  virtual std::unique_ptr<TimeBasedData> clone() const override {
+    return std::unique_ptr<TimeBasedData>(new TimeSeriesAccumulator(*this));
+  }
+
+  /**
+   * @brief Adds a value to a single interval of the time based data
+   * @details equivalent to += TimeSeriesConst({value, 0.}, time_point, interval), but without temporary objects
+   *
+   * @param[in] value Value to add
+   * @param[in] time_point Start of the interval the value is added to
+   * @param[in] interval Interval length of the value
+   */
+  void add_pulse(double value,
+                 SimulationClock::time_point time_point,
+                 SimulationClock::duration interval);
+
+  /**
+   * @brief Adds consecutive pulses, equivalent to add_pulse(values[i], time_point + i * interval, interval) for all i
+   *
+   * @param[in] values Array of count values to add
+   * @param[in] count Number of pulses
+   * @param[in] time_point Start of the interval of the first value
+   * @param[in] interval Interval length of each value
+   */
+  void add_pulses(const double* values,
+                  std::size_t count,
+                  SimulationClock::time_point time_point,
+                  SimulationClock::duration interval);
+
+  /**
+   * @brief Adds a value from a time point on, the value persists until the next change
+   * @details equivalent to += TimeSeriesConst({value}, time_point, interval), but without temporary objects
+   *          if time_point is not before the end of the time series
+   *
+   * @param[in] value Value to add
+   * @param[in] time_point Time point from which the value is added
+   * @param[in] interval Interval length of the time based data
+   */
+  void add_step(double value,
+                SimulationClock::time_point time_point,
+                SimulationClock::duration interval);
+
+  /**
+   * @brief Reserves storage for all intervals between two time points
+   *
+   * @param[in] start First time point to be stored
+   * @param[in] end Last time point to be stored
+   * @param[in] interval Interval length of the time based data
+   */
+  void reserve(SimulationClock::time_point start,
+               SimulationClock::time_point end,
+               SimulationClock::duration interval);
+
+  /**
+   * @brief Adds another time series of the same interval, empty time series are skipped
+   *
+   * @param[in] other Time series to add
+   */
+  void add_series(const TimeSeriesConstAddable& other) {if (!other.empty()) *this += other;}
+
+  /**
+   * @brief Resets to an empty object, the allocated storage is kept for reuse
+   */
+  void clear() {clear_values();}
+
+ private:
+  bool locate_tick(SimulationClock::time_point time_point,
+                   SimulationClock::duration interval,
+                   index_type& index) const;
+  void extend_to(index_type new_size);
+};
+
+} /* namespace aux */
+
+#endif /* AUXILIARIES_TIME_SERIES_ACCUMULATOR_H_ */
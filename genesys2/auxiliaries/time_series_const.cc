@@ -7,6 +7,7 @@
 
 #include <auxiliaries/time_series_const.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace aux {
@@ -23,6 +24,37 @@ double TimeSeriesConst::operator []( const SimulationClock::time_point& time_poi
   }
 }
 
+bool TimeSeriesConst::step_times(SimulationClock::time_point tp_start,
+                                 SimulationClock::time_point tp_end,
+                                 std::vector<SimulationClock::time_point>& steps) const {
+  if (empty())
+    return false;
+  for (index_type i = 0; i < size(); ++i) {
+    auto step = start() + static_cast<SimulationClock::duration::rep>(i) * interval();
+    if (step >= tp_end)
+      break;
+    if (step > tp_start)
+      steps.push_back(step);
+  }
+  return true;
+}
+
+void TimeSeriesConst::sample(SimulationClock::time_point tp_start,
+                             SimulationClock::duration interval_tp,
+                             std::size_t count,
+                             double* values) const {
+  if (empty() || (interval_tp != interval()) || (tp_start < start())) {
+    for (std::size_t i = 0; i < count; ++i, tp_start += interval_tp)
+      values[i] = TimeSeriesConst::operator[](tp_start);
+    return;
+  }
+  // same grid: the index advances by one per time point and saturates at the last value
+  auto index = locate_time(tp_start);
+  const auto last = size() - 1;
+  for (std::size_t i = 0; i < count; ++i, ++index)
+    values[i] = value(std::min(index, last));
+}
+
 double TimeSeriesConst::Mean(SimulationClock::time_point tp_start,
                              SimulationClock::time_point tp_end) const {
   double rval = 0.0;
@@ -63,6 +63,10 @@ class TimeSeriesConst : public TimeSeries {
   * @brief Default deconstructor
   */
   virtual ~TimeSeriesConst() = default;
+  TimeSeriesConst(const TimeSeriesConst&) = default;
+  TimeSeriesConst(TimeSeriesConst&&) = default;
+  TimeSeriesConst& operator=(const TimeSeriesConst&) = default;
+  TimeSeriesConst& operator=(TimeSeriesConst&&) = default;
 
   /**
    * @brief Overloaded operator defining the selection of an element from the data
@@ -85,6 +89,15 @@ class TimeSeriesConst : public TimeSeries {
   virtual double Mean(SimulationClock::time_point tp_start,
                       SimulationClock::time_point tp_end) const override;
 
+  virtual bool step_times(SimulationClock::time_point tp_start,
+                          SimulationClock::time_point tp_end,
+                          std::vector<SimulationClock::time_point>& steps) const override;
+
+  virtual void sample(SimulationClock::time_point tp_start,
+                      SimulationClock::duration interval,
+                      std::size_t count,
+                      double* values) const override;
+
   virtual std::string PrintToString() const override {return PrintToStringTS("TS_const");}
   //virtual std::tuple<std::string, std::string, std::string> toXmlString() const override {return toXmlString("TS_const");};
 
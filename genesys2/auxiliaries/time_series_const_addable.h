@@ -51,6 +51,10 @@ class TimeSeriesConstAddable : public TimeSeriesConst {
   * @brief Default Destructor
   */
   virtual ~TimeSeriesConstAddable() = default;
+  TimeSeriesConstAddable(const TimeSeriesConstAddable&) = default;
+  TimeSeriesConstAddable(TimeSeriesConstAddable&&) = default;
+  TimeSeriesConstAddable& operator=(const TimeSeriesConstAddable&) = default;
+  TimeSeriesConstAddable& operator=(TimeSeriesConstAddable&&) = default;
   TimeSeriesConstAddable(const TimeSeriesConst& other)
       : TimeSeriesConst(other) {}
 
@@ -17,6 +17,24 @@ double TimeSeriesRepeatConst::operator[](const SimulationClock::time_point& time
   }
 }
 
+void TimeSeriesRepeatConst::sample(SimulationClock::time_point tp_start,
+                                   SimulationClock::duration interval_tp,
+                                   std::size_t count,
+                                   double* values) const {
+  if (empty() || (interval_tp != interval()) || (tp_start < start())) {
+    for (std::size_t i = 0; i < count; ++i, tp_start += interval_tp)
+      values[i] = TimeSeriesRepeatConst::operator[](tp_start);
+    return;
+  }
+  // same grid: the index advances by one per time point and wraps around at the end of the pattern
+  auto index = locate_time(tp_start) % size();
+  for (std::size_t i = 0; i < count; ++i) {
+    values[i] = value(index);
+    if (++index == size())
+      index = 0;
+  }
+}
+
 double TimeSeriesRepeatConst::Mean(SimulationClock::time_point tp_start,
                                    SimulationClock::time_point tp_end) const {
   double rval = 0.0;
@@ -59,6 +59,11 @@ class TimeSeriesRepeatConst : public TimeSeries {
   virtual double Mean(SimulationClock::time_point tp_start,
                       SimulationClock::time_point tp_end) const override;
 
+  virtual void sample(SimulationClock::time_point tp_start,
+                      SimulationClock::duration interval,
+                      std::size_t count,
+                      double* values) const override;
+
   virtual std::string PrintToString() const override {return PrintToStringTS("TS_repeat_const");}
 };
 
@@ -14,6 +14,7 @@
 #include <auxiliaries/simulation_clock.h>
 #include <auxiliaries/tbd_lookup_table.h>
 #include <auxiliaries/time_based_data_dummy.h>
+#include <auxiliaries/time_series_accumulator.h>
 #include <auxiliaries/time_series_const.h>
 #include <auxiliaries/time_series_const_addable.h>
 #include <auxiliaries/time_series_linear.h>
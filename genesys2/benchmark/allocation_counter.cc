@@ -0,0 +1,108 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// allocation_counter.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <benchmark/allocation_counter.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace benchmark {
+
+namespace {
+std::atomic<bool> counting_enabled(false);
+std::atomic<unsigned long long> allocation_count(0);
+std::atomic<unsigned long long> allocation_bytes(0);
+} /* namespace */
+
+bool AllocationCounter::available() {
+#ifdef GENESYS_BENCHMARK
+  return true;
+#else
+  return false;
+#endif
+}
+
+void AllocationCounter::start() {
+  allocation_count.store(0);
+  allocation_bytes.store(0);
+  counting_enabled.store(true);
+}
+
+void AllocationCounter::stop() {
+  counting_enabled.store(false);
+}
+
+unsigned long long AllocationCounter::allocations() {
+  return allocation_count.load();
+}
+
+unsigned long long AllocationCounter::allocated_bytes() {
+  return allocation_bytes.load();
+}
+
+void AllocationCounter::count(std::size_t size) {
+  if (counting_enabled.load(std::memory_order_relaxed)) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+  }
+}
+
+} /* namespace benchmark */
+
+#ifdef GENESYS_BENCHMARK
+//replacement of the global allocation functions, the nothrow and sized versions forward to these
+void* operator new(std::size_t size) {
+  benchmark::AllocationCounter::count(size);
+  if (size == 0)
+    size = 1;
+  while (true) {
+    if (void* ptr = std::malloc(size))
+      return ptr;
+    std::new_handler handler = std::get_new_handler();
+    if (!handler)
+      throw std::bad_alloc();
+    handler();
+  }
+}
+
+void* operator new[](std::size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+#endif
@@ -0,0 +1,82 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// allocation_counter.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef BENCHMARK_ALLOCATION_COUNTER_H_
+#define BENCHMARK_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace benchmark {
+
+/**
+ * @brief Counts the calls to the global operator new while enabled
+ * @details The counter replaces the global operator new/delete of the program if it is compiled
+ *          with -DGENESYS_BENCHMARK, otherwise nothing is counted and available() is false. As long
+ *          as it is disabled (the default) the only overhead is a relaxed load of the enabled flag.
+ */
+class AllocationCounter {
+ public:
+  AllocationCounter() = delete;
+
+  /**
+   * @brief True if the global operator new is replaced, i.e. the program is compiled with GENESYS_BENCHMARK
+   */
+  static bool available();
+
+  /**
+   * @brief Resets the counters and starts counting
+   */
+  static void start();
+
+  /**
+   * @brief Stops counting, the counters keep their values until the next start()
+   */
+  static void stop();
+
+  /**
+   * @brief Number of allocations between start() and stop()
+   */
+  static unsigned long long allocations();
+
+  /**
+   * @brief Number of bytes requested between start() and stop()
+   */
+  static unsigned long long allocated_bytes();
+
+  /**
+   * @brief Registers one allocation of size bytes if counting is enabled, called by operator new
+   */
+  static void count(std::size_t size);
+};
+
+} /* namespace benchmark */
+
+#endif /* BENCHMARK_ALLOCATION_COUNTER_H_ */
@@ -0,0 +1,139 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// hsm_benchmark.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <benchmark/hsm_benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include <abstract_model/abstract_model.h>
+#include <benchmark/allocation_counter.h>
+#include <builder/model_builder.h>
+#include <dynamic_model_hsm/hsm_operation.h>
+#include <optim_cmaes/installation_list.h>
+#include <program_settings.h>
+#include <static_model/static_model.h>
+
+namespace benchmark {
+
+HSMBenchmark::HSMBenchmark(unsigned int evaluations)
+    : evaluations_(evaluations),
+      ticks_per_evaluation_((genesys::ProgramSettings::simulation_end() - genesys::ProgramSettings::simulation_start())
+                            / genesys::ProgramSettings::simulation_step_length()),
+      fitness_(0.),
+      phases_() {
+  if (evaluations_ < 1) {
+    std::cerr << "ERROR in benchmark::HSMBenchmark::HSMBenchmark : at least one evaluation required" << std::endl;
+    std::terminate();
+  }
+}
+
+template <typename Function>
+void HSMBenchmark::Measure(Phase& phase, Function&& function) {
+  AllocationCounter::start();
+  auto wall_time_timer = std::chrono::steady_clock::now();
+  function();
+  auto wall_time = std::chrono::steady_clock::now() - wall_time_timer;
+  AllocationCounter::stop();
+  ++phase.repetitions;
+  phase.wall_time_ms += std::chrono::duration_cast<std::chrono::duration<double, std::milli> >(wall_time).count();
+  phase.allocations += AllocationCounter::allocations();
+  phase.allocated_bytes += AllocationCounter::allocated_bytes();
+}
+
+void HSMBenchmark::Run(const std::string& installation_file) {
+  std::cout << "GENESYS benchmark: " << evaluations_ << " evaluations of " << ticks_per_evaluation_ << " ticks each"
+            << std::endl;
+  phases_ = {{"model builder", 0, 0., 0, 0},
+             {"static model", 0, 0., 0, 0},
+             {"dynamic model", 0, 0., 0, 0},
+             {"reparametrisation", 0, 0., 0, 0},
+             {"evaluation", 0, 0., 0, 0}};
+  std::unique_ptr<am::AbstractModel> abstract_model;
+  std::unique_ptr<optim_cmaes::InstallationList> installation_list;
+  std::unique_ptr<dm_hsm::HSMOperation> operation;
+  Measure(phases_[0], [&]() {
+    abstract_model.reset(new am::AbstractModel(builder::ModelBuilder().Create()));
+  });
+  std::unique_ptr<sm::StaticModel> static_model;
+  Measure(phases_[1], [&]() {
+    installation_list.reset(new optim_cmaes::InstallationList(io_routines::CsvInput(installation_file)));
+    static_model.reset(new sm::StaticModel(*abstract_model, installation_list->installations()));
+  });
+  Measure(phases_[2], [&]() {
+    operation.reset(new dm_hsm::HSMOperation(*static_model));
+  });
+  static_model.reset();
+  for (unsigned int i = 0; i < evaluations_; ++i) {
+    //the first evaluation runs on the freshly built model, like the first individual of the optimiser
+    if (i > 0) {
+      Measure(phases_[3], [&]() {
+        operation->resetParametrisedOperation(installation_list->installations());
+      });
+    }
+    Measure(phases_[4], [&]() {
+      fitness_ = operation->CalculateFitnessMinCost(false).find("fitness")->second;
+    });
+  }
+}
+
+void HSMBenchmark::Print() const {
+  std::cout << "======HSMBenchmark::Print===============" << "\n"
+            << std::left << std::setw(20) << "phase" << std::right
+            << std::setw(6) << "reps" << std::setw(16) << "wall time [ms]" << std::setw(16) << "allocations"
+            << std::setw(16) << "alloc/rep" << std::setw(16) << "MB allocated" << "\n";
+  for (const auto& i : phases_) {
+    auto repetitions = std::max(1u, i.repetitions);
+    std::cout << std::left << std::setw(20) << i.name << std::right
+              << std::setw(6) << i.repetitions
+              << std::setw(16) << std::fixed << std::setprecision(1) << i.wall_time_ms;
+    if (AllocationCounter::available()) {
+      std::cout << std::setw(16) << i.allocations
+                << std::setw(16) << i.allocations / repetitions
+                << std::setw(16) << std::setprecision(1) << i.allocated_bytes / (1024. * 1024.) << "\n";
+    } else {
+      //allocations are only counted with -DGENESYS_BENCHMARK
+      std::cout << std::setw(16) << "n/a" << std::setw(16) << "n/a" << std::setw(16) << "n/a" << "\n";
+    }
+  }
+  const auto& evaluation = phases_.back();
+  auto seconds = evaluation.wall_time_ms / 1000.;
+  std::cout << "evaluations/s = " << std::setprecision(3) << evaluation.repetitions / seconds << "\n"
+            << "ticks/s = " << std::setprecision(0) << evaluation.repetitions * ticks_per_evaluation_ / seconds << "\n"
+            << "fitness of last evaluation = " << std::scientific << std::setprecision(6) << fitness_ << "\n"
+            << "======HSMBenchmark::Print===============" << "\n" << std::defaultfloat << std::endl;
+}
+
+} /* namespace benchmark */
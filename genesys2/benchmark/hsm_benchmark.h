@@ -0,0 +1,84 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// hsm_benchmark.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef BENCHMARK_HSM_BENCHMARK_H_
+#define BENCHMARK_HSM_BENCHMARK_H_
+
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief Measures model construction and repeated fitness evaluations of the HSM dispatch
+ * @details The scenario is read from the current folder (see ScenarioGenerator for synthetic ones). Each phase
+ *          reports its wall time and the allocations counted by AllocationCounter (only with GENESYS_BENCHMARK);
+ *          the evaluation phase additionally reports evaluations and simulation ticks per second.
+ */
+class HSMBenchmark {
+ public:
+  HSMBenchmark() = delete;
+  ~HSMBenchmark() = default;
+  HSMBenchmark(unsigned int evaluations);
+
+  /**
+   * @brief Builds the model and runs the evaluations
+   *
+   * @param[in] installation_file InstallationList (csv) used for parametrisation of the model
+   */
+  void Run(const std::string& installation_file);
+
+  /**
+   * @brief Prints the results of all phases to std::cout
+   */
+  void Print() const;
+
+ private:
+  struct Phase {
+    std::string name;
+    unsigned int repetitions;
+    double wall_time_ms;
+    unsigned long long allocations;
+    unsigned long long allocated_bytes;
+  };
+
+  template <typename Function>
+  void Measure(Phase& phase, Function&& function);
+
+  unsigned int evaluations_;
+  long long ticks_per_evaluation_;
+  double fitness_;
+  std::vector<Phase> phases_;
+};
+
+} /* namespace benchmark */
+
+#endif /* BENCHMARK_HSM_BENCHMARK_H_ */
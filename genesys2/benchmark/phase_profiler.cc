@@ -0,0 +1,149 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// phase_profiler.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <benchmark/phase_profiler.h>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+struct PhaseRecord {
+  const char* phase;
+  unsigned long long calls;
+  std::chrono::steady_clock::duration time;
+};
+
+struct ThreadTable {
+  std::vector<PhaseRecord> records;
+};
+
+std::mutex tables_mutex;
+//owns the tables of all threads that recorded a phase, they are kept until the end of the program
+std::vector<std::unique_ptr<ThreadTable> >& tables() {
+  static std::vector<std::unique_ptr<ThreadTable> > all_tables;
+  return all_tables;
+}
+thread_local ThreadTable* thread_table = nullptr;
+
+PhaseRecord& find_record(const char* phase) {
+  if (thread_table == nullptr) {
+    std::unique_ptr<ThreadTable> table(new ThreadTable());
+    thread_table = table.get();
+    std::lock_guard<std::mutex> lock(tables_mutex);
+    tables().push_back(std::move(table));
+  }
+  //few phases per thread, equal literals of one translation unit share their address
+  for (auto& it : thread_table->records) {
+    if (it.phase == phase)
+      return it;
+  }
+  thread_table->records.push_back(PhaseRecord{phase, 0, std::chrono::steady_clock::duration::zero()});
+  return thread_table->records.back();
+}
+
+typedef std::map<std::string, std::pair<unsigned long long, std::chrono::steady_clock::duration> > PhaseSums;
+
+void add_to(PhaseSums& sums, const PhaseRecord& record) {
+  auto& sum = sums[record.phase];
+  sum.first += record.calls;
+  sum.second += record.time;
+}
+
+double seconds(std::chrono::steady_clock::duration time) {
+  return std::chrono::duration_cast<std::chrono::duration<double> >(time).count();
+}
+} /* namespace */
+
+void PhaseProfiler::record(const char* phase, std::chrono::steady_clock::duration duration) {
+  auto& record = find_record(phase);
+  ++record.calls;
+  record.time += duration;
+}
+
+void PhaseProfiler::count(const char* phase, unsigned long long count) {
+  find_record(phase).calls += count;
+}
+
+void PhaseProfiler::Write(const std::string& file_base) {
+  std::lock_guard<std::mutex> lock(tables_mutex);
+  //literals of different translation units may differ in their address, the sums are merged by name
+  std::vector<PhaseSums> thread_sums;
+  PhaseSums total_sums;
+  for (const auto& table : tables()) {
+    thread_sums.emplace_back();
+    for (const auto& it : table->records) {
+      add_to(thread_sums.back(), it);
+      add_to(total_sums, it);
+    }
+  }
+
+  std::ofstream csv_file(file_base + "_profile.csv");
+  std::ofstream json_file(file_base + "_profile.json");
+  if (!csv_file || !json_file) {
+    std::cerr << "ERROR in benchmark::PhaseProfiler::Write : could not open " << file_base << "_profile.csv/.json"
+              << std::endl;
+    return;
+  }
+  csv_file << "thread;phase;calls;time_s;" << "\n" << std::setprecision(9);
+  json_file << "{\n  \"threads\": [" << std::setprecision(9);
+  for (std::size_t thread = 0; thread < thread_sums.size(); ++thread) {
+    json_file << (thread == 0 ? "\n" : ",\n") << "    {\"thread\": " << thread << ", \"phases\": [";
+    bool first = true;
+    for (const auto& it : thread_sums[thread]) {
+      csv_file << thread << ";" << it.first << ";" << it.second.first << ";" << seconds(it.second.second) << ";\n";
+      json_file << (first ? "\n" : ",\n") << "      {\"phase\": \"" << it.first << "\", \"calls\": " << it.second.first
+                << ", \"time_s\": " << seconds(it.second.second) << "}";
+      first = false;
+    }
+    json_file << "\n    ]}";
+  }
+  json_file << "\n  ],\n  \"total\": [";
+  bool first = true;
+  for (const auto& it : total_sums) {
+    csv_file << "total;" << it.first << ";" << it.second.first << ";" << seconds(it.second.second) << ";\n";
+    json_file << (first ? "\n" : ",\n") << "    {\"phase\": \"" << it.first << "\", \"calls\": " << it.second.first
+              << ", \"time_s\": " << seconds(it.second.second) << "}";
+    first = false;
+  }
+  json_file << "\n  ]\n}\n";
+  std::cout << "Phase profile written to " << file_base << "_profile.json/.csv" << std::endl;
+}
+
+} /* namespace benchmark */
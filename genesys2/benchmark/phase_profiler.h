@@ -0,0 +1,98 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// phase_profiler.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef BENCHMARK_PHASE_PROFILER_H_
+#define BENCHMARK_PHASE_PROFILER_H_
+
+#include <chrono>
+#include <string>
+
+namespace benchmark {
+
+/**
+ * @brief Accumulates wall time and call counts of named phases of the HSM per thread
+ * @details Every thread sums into its own table, so recording takes no lock after the first use of a phase in a
+ *          thread. The phases are identified by string literals. The instrumentation in the model is only compiled
+ *          with -DGENESYS_PROFILE, see GENESYS_PROFILE_PHASE and GENESYS_PROFILE_COUNT.
+ */
+class PhaseProfiler {
+ public:
+  PhaseProfiler() = delete;
+
+  /**
+   * @brief Adds one call of the phase with its duration to the table of the calling thread
+   */
+  static void record(const char* phase, std::chrono::steady_clock::duration duration);
+
+  /**
+   * @brief Adds count to the counter of the phase in the table of the calling thread, no time is recorded
+   */
+  static void count(const char* phase, unsigned long long count);
+
+  /**
+   * @brief Writes the profile of all threads and the totals per phase as file_base_profile.json and .csv
+   *
+   * @param[in] file_base path and name of the output files without ending
+   */
+  static void Write(const std::string& file_base);
+};
+
+/**
+ * @brief Records the lifetime of the object as one call of the phase
+ */
+class ScopedPhase {
+ public:
+  ScopedPhase() = delete;
+  ScopedPhase(const ScopedPhase&) = delete;
+  ScopedPhase& operator=(const ScopedPhase&) = delete;
+  explicit ScopedPhase(const char* phase) : phase_(phase), start_(std::chrono::steady_clock::now()) {}
+  ~ScopedPhase() {PhaseProfiler::record(phase_, std::chrono::steady_clock::now() - start_);}
+
+ private:
+  const char* phase_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} /* namespace benchmark */
+
+#define GENESYS_PROFILE_CONCAT_(a, b) a##b
+#define GENESYS_PROFILE_CONCAT(a, b) GENESYS_PROFILE_CONCAT_(a, b)
+
+#ifdef GENESYS_PROFILE
+#define GENESYS_PROFILE_PHASE(phase) \
+  benchmark::ScopedPhase GENESYS_PROFILE_CONCAT(genesys_profile_phase_, __LINE__)(phase)
+#define GENESYS_PROFILE_COUNT(phase, n) benchmark::PhaseProfiler::count(phase, n)
+#else
+#define GENESYS_PROFILE_PHASE(phase) static_cast<void>(0)
+#define GENESYS_PROFILE_COUNT(phase, n) static_cast<void>(0)
+#endif
+
+#endif /* BENCHMARK_PHASE_PROFILER_H_ */
@@ -0,0 +1,490 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// scenario_generator.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <benchmark/scenario_generator.h>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+namespace benchmark {
+
+namespace {
+const unsigned int hours_per_year = 8760;
+const int start_year = 2020;
+const double pi = 3.14159265358979323846;
+const std::string unlimited_file = "./TimeSeries/PrimaryEnergyUnlimited.csv";
+} /* namespace */
+
+std::vector<ScenarioGenerator::Technology> ScenarioGenerator::archetypes() {
+  //codes must be known to dm_hsm::DynamicModel::setHSMCategoriesFromCode()
+  //                        code,                type,                         energy,          cost,  lifetime, eff., OaM,   fuel,    co2
+  return std::vector<Technology>({{"PV1",                TechnologyType::RENEWABLE,    "SOLAR",         6.0e8, 25, 1.,   0.02,  0.,      0.},
+                                  {"CH4_OCTURBINE",      TechnologyType::DISPATCHABLE, "CH4",           4.5e8, 30, 0.6,  0.013, 27000.,  200.},
+                                  {"BATPOWER",           TechnologyType::STORAGE,      "BAT_ENERGY",    1.0e8, 15, 0.9,  0.02,  0.,      0.},
+                                  {"WIND1",              TechnologyType::RENEWABLE,    "WIND",          1.2e9, 25, 1.,   0.03,  0.,      0.},
+                                  {"HARDCOAL_OCTURBINE", TechnologyType::DISPATCHABLE, "HARDCOAL",      1.4e9, 40, 0.45, 0.02,  12000.,  340.},
+                                  {"PH_TURBINE",         TechnologyType::STORAGE,      "PH_ENERGY",     1.0e8, 50, 0.94, 0.01,  0.,      0.},
+                                  {"WIND_OFF",           TechnologyType::RENEWABLE,    "WIND_OFFSHORE", 2.5e9, 25, 1.,   0.04,  0.,      0.},
+                                  {"LIGNITE_OCTURBINE",  TechnologyType::DISPATCHABLE, "LIGNITE",       1.6e9, 40, 0.4,  0.02,  6000.,   400.},
+                                  {"BAT2POWER",          TechnologyType::STORAGE,      "BAT2_ENERGY",   1.2e8, 15, 0.92, 0.02,  0.,      0.},
+                                  {"ROR",                TechnologyType::RENEWABLE,    "RUN_OF_RIVER",  3.0e9, 60, 1.,   0.01,  0.,      0.}});
+}
+
+unsigned int ScenarioGenerator::max_technologies() {
+  return static_cast<unsigned int>(archetypes().size());
+}
+
+ScenarioGenerator::ScenarioGenerator(unsigned int num_regions,
+                                     unsigned int num_links,
+                                     unsigned int num_technologies,
+                                     unsigned int num_years,
+                                     unsigned int seed)
+    : num_regions_(num_regions),
+      num_years_(num_years),
+      technologies_(),
+      links_(),
+      annual_demand_(),
+      generator_(seed) {
+  if (num_regions_ < 1 || num_years_ < 1) {
+    IssueError("ScenarioGenerator", "at least one region and one year of operation required");
+  }
+  //ModelBuilder expects at least one converter and one multi-converter
+  if (num_technologies < 2 || num_technologies > max_technologies()) {
+    IssueError("ScenarioGenerator", "number of technologies has to be in [2, " + std::to_string(max_technologies())
+               + "], given: " + std::to_string(num_technologies));
+  }
+  if (num_links > num_regions_ * (num_regions_ - 1) / 2) {
+    IssueError("ScenarioGenerator", std::to_string(num_regions_) + " regions allow at most "
+               + std::to_string(num_regions_ * (num_regions_ - 1) / 2) + " links, given: " + std::to_string(num_links));
+  }
+  auto all_technologies = archetypes();
+  technologies_.assign(all_technologies.begin(), all_technologies.begin() + num_technologies);
+  //connect neighbouring regions first (chain), then regions of growing index distance
+  for (unsigned int distance = 1; distance < num_regions_ && links_.size() < num_links; ++distance) {
+    for (unsigned int i = 0; i + distance < num_regions_ && links_.size() < num_links; ++i)
+      links_.emplace_back(i, i + distance);
+  }
+  std::uniform_real_distribution<double> demand_distribution(5e4, 1.5e5); // GWh/a
+  for (unsigned int i = 0; i < num_regions_; ++i)
+    annual_demand_.push_back(demand_distribution(generator_));
+}
+
+void ScenarioGenerator::Write(const std::string& folder) {
+  std::cout << "Generating synthetic scenario in " << folder << ": " << num_regions_ << " regions, " << links_.size()
+            << " links, " << technologies_.size() << " technologies, " << num_years_ << " years" << std::endl;
+  MakeFolder(folder);
+  MakeFolder(folder + "/TimeSeries");
+  WriteProgramSettings(folder);
+  WriteInstallationList(folder);
+  WritePrimaryEnergy(folder);
+  WriteStorage(folder);
+  WriteConverter(folder);
+  WriteMultiConverter(folder);
+  WriteTransmissionConverter(folder);
+  WriteRegions(folder);
+  WriteLinks(folder);
+}
+
+void ScenarioGenerator::WriteProgramSettings(const std::string& folder) const {
+  std::ofstream filestream(folder + "/ProgramSettings.dat");
+  if (!filestream.is_open()) {
+    IssueError("WriteProgramSettings", "cannot write to " + folder + "/ProgramSettings.dat");
+  }
+  filestream << "/*synthetic scenario written by --mode=generate*/\n"
+             << "optimisation_algorithm=cma-es\n"
+             << "simulation_start=" << start() << "\n"
+             << "simulation_end=" << std::to_string(start_year + static_cast<int>(num_years_)) << "-01-01_00:00\n"
+             << "interest_rate=0.07\n"
+             << "installation_interval=1a\n"
+             << "use_global_file=no\n"
+             << "/*variables for operation simulation*/\n"
+             << "gridbalance_hop_level=" << (links_.empty() ? 0 : 1) << "\n"
+             << "operation_algorithm=hsm_total_cost_min\n"
+             << "energy2power_ratio=1h\n"
+             << "operation_sequence_duration=1a\n"
+             << "simulation_step_length=1h\n"
+             << "analysis_hsm_output_detail=no" << std::endl;
+}
+
+void ScenarioGenerator::WriteInstallationList(const std::string& folder) const {
+  io_routines::CsvOutput output;
+  output.push_back("#comment");
+  output.push_back("installations of the synthetic scenario are part of Region.csv and Link.csv");
+  output.new_line();
+  output.push_back("#empty");
+  output.writeToDisk(folder + "/InstallationListResult.csv");
+}
+
+void ScenarioGenerator::WritePrimaryEnergy(const std::string& folder) const {
+  io_routines::CsvOutput output;
+  output.push_back("#comment");
+  output.push_back("===============synthetic primary energy===============");
+  output.new_line();
+  output.push_back("#blockwise");
+  auto add_block = [&output, this](const std::string& code, double base, double cost) {
+    AddLine(output, {"#code", code, "#name", code});
+    AddLine(output, {"cost_table", "#type", "TBD_lookupTable"});
+    AddVariable(output, "base", "DVP_const", start(), base);
+    AddVariable(output, "value", "DVP_const", start(), cost);
+    output.new_line();
+    output.push_back("#endtable");
+    output.new_line();
+    output.push_back("#endblock");
+  };
+  for (const auto& i : technologies_) {
+    if (i.type == TechnologyType::RENEWABLE) {
+      add_block(i.energy, 1., 0.);
+    } else if (i.type == TechnologyType::DISPATCHABLE) {
+      add_block(i.energy, 1e6, i.fuel_cost);
+    }
+  }
+  add_block("CO2", 1e6, 0.);
+  output.writeToDisk(folder + "/PrimaryEnergy.csv");
+
+  //potential of all fuels and of CO2 is unlimited
+  io_routines::CsvOutput unlimited;
+  unlimited.push_back("#comment");
+  unlimited.push_back("unlimited -1 primary ressource");
+  AddVariable(unlimited, "base", "DVP_const", start(), 1e15);
+  AddVariable(unlimited, "value", "DVP_linear", start(), -1.);
+  unlimited.new_line();
+  unlimited.push_back("#endtable");
+  unlimited.writeToDisk(folder + unlimited_file.substr(1));
+}
+
+void ScenarioGenerator::WriteStorage(const std::string& folder) const {
+  io_routines::CsvOutput output;
+  output.push_back("#comment");
+  output.push_back("===============synthetic storage technologies===============");
+  output.new_line();
+  if (count(TechnologyType::STORAGE) == 0) {
+    output.push_back("#empty");
+  } else {
+    output.push_back("#blockwise");
+    for (const auto& i : technologies_) {
+      if (i.type == TechnologyType::STORAGE) {
+        auto code = i.code + "_STORAGE";
+        AddLine(output, {"#code", code, "#name", code, "#input", i.energy, "#output", i.energy});
+        Technology storage = i;
+        storage.efficiency = 1.;
+        storage.cost = i.cost / 10.;
+        AddTechnologyVariables(output, storage, start());
+        output.new_line();
+        output.push_back("#endblock");
+      }
+    }
+  }
+  output.writeToDisk(folder + "/Storage.csv");
+}
+
+void ScenarioGenerator::WriteConverter(const std::string& folder) const {
+  io_routines::CsvOutput output;
+  output.push_back("#comment");
+  output.push_back("===============synthetic converter technologies===============");
+  output.new_line();
+  output.push_back("#blockwise");
+  for (const auto& i : technologies_) {
+    if (i.type == TechnologyType::DISPATCHABLE)
+      continue;
+    bool storage = (i.type == TechnologyType::STORAGE);
+    AddLine(output, {"#code", i.code, "#name", i.code,
+                     "#input", storage ? "electric_energy" : i.energy,
+                     "#output", storage ? i.energy : "electric_energy",
+                     "#bidirectional", storage ? "true" : "false"});
+    AddTechnologyVariables(output, i, start());
+    output.new_line();
+    output.push_back("#endblock");
+  }
+  output.writeToDisk(folder + "/Converter.csv");
+}
+
+void ScenarioGenerator::WriteMultiConverter(const std::string& folder) const {
+  io_routines::CsvOutput output;
+  output.push_back("#comment");
+  output.push_back("===============synthetic multiconverter technologies===============");
+  output.new_line();
+  output.push_back("#blockwise");
+  for (const auto& i : technologies_) {
+    if (i.type != TechnologyType::DISPATCHABLE)
+      continue;
+    AddLine(output, {"#code", i.code, "#name", i.code, "#input", i.energy});
+    AddLine(output, {"#output", "electric_energy", "CO2"});
+    output.new_line();
+    output.push_back("#conversion");
+    output.push_back("-1");
+    output.push_back(ToString(i.co2_factor));
+    AddTechnologyVariables(output, i, start());
+    output.new_line();
+    output.push_back("#endblock");
+  }
+  output.writeToDisk(folder + "/MultiConverter.csv");
+}
+
+void ScenarioGenerator::WriteTransmissionConverter(const std::string& folder) const {
+  io_routines::CsvOutput output;
+  output.push_back("#comment");
+  output.push_back("===============synthetic transmission converters===============");
+  output.new_line();
+  if (links_.empty()) {
+    output.push_back("#empty");
+  } else {
+    output.push_back("#blockwise");
+    AddLine(output, {"#code", "EL_AC", "#name", "EL_AC", "#input", "electric_energy",
+                     "#output", "electric_energy", "#bidirectional", "true"});
+    AddVariable(output, "efficiency_new", "DVP_linear", start(), 0.95);
+    AddVariable(output, "cost", "DVP_linear", start(), 1.65e9);
+    AddVariable(output, "lifetime", "DVP_linear", start(), 40.);
+    AddVariable(output, "OaM_rate", "DVP_linear", start(), 0.01);
+    AddVariable(output, "length_dep_loss", "DVP_linear", start(), 0.);
+    AddVariable(output, "length_dep_cost", "DVP_linear", start(), 0.);
+    output.new_line();
+    output.push_back("#endblock");
+  }
+  output.writeToDisk(folder + "/TransmissionConverter.csv");
+}
+
+void ScenarioGenerator::WriteRegions(const std::string& folder) {
+  io_routines::CsvOutput output;
+  output.push_back("#comment");
+  output.push_back("===============synthetic regions===============");
+  output.new_line();
+  output.push_back("#blockwise");
+  //installed capacities relative to the mean load, shared equally by the technologies of one type
+  auto num_renewable = std::max(1u, count(TechnologyType::RENEWABLE));
+  auto num_dispatchable = std::max(1u, count(TechnologyType::DISPATCHABLE));
+  auto num_storage = std::max(1u, count(TechnologyType::STORAGE));
+  for (unsigned int r = 0; r < num_regions_; ++r) {
+    auto code = RegionCode(r);
+    auto mean_load = annual_demand_[r] / hours_per_year; // GW
+    AddLine(output, {"#code", code, "#name", code});
+    auto demand_file = "./TimeSeries/" + code + "_demand.csv";
+    AddLine(output, {"demand_electric_dyn", "#type", "TS_repeat_const", "#interval", "1h",
+                     "#start", start(), "#data_source_path", demand_file});
+    AddVariable(output, "demand_electric_per_a", "DVP_linear", start(), annual_demand_[r]);
+    io_routines::CsvOutput demand;
+    AddSeries(demand, DemandProfile(r));
+    demand.writeToDisk(folder + demand_file.substr(1));
+
+    //primary energy
+    auto add_potential = [&output](const std::string& energy, const std::string& file) {
+      AddLine(output, {"#primary_energy", "#code", energy});
+      AddLine(output, {"potential", "#type", "TBD_lookupTable", "#data_source_path", file});
+    };
+    for (const auto& i : technologies_) {
+      if (i.type == TechnologyType::RENEWABLE) {
+        auto potential_file = "./TimeSeries/" + code + "_" + i.energy + ".csv";
+        add_potential(i.energy, potential_file);
+        io_routines::CsvOutput potential;
+        potential.push_back("#comment");
+        potential.push_back("synthetic " + i.energy + " profile of " + code);
+        AddVariable(potential, "base", "DVP_const", start(), 1e6);
+        AddLine(potential, {"value", "#type", "TS_repeat_const", "#interval", "1h", "#start", start(), "#data"});
+        AddSeries(potential, RenewableProfile(i.energy, r));
+        potential.new_line();
+        potential.push_back("#endtable");
+        potential.writeToDisk(folder + potential_file.substr(1));
+      } else if (i.type == TechnologyType::DISPATCHABLE) {
+        add_potential(i.energy, unlimited_file);
+      }
+    }
+    add_potential("CO2", unlimited_file);
+
+    //installations, ModelBuilder expects converter, multi-converter and storage in this order
+    auto add_installation = [&output, this](const std::string& keyword, const std::string& tech_code, double value) {
+      AddLine(output, {keyword, "#code", tech_code});
+      AddVariable(output, "installation", "DVP_const", start(), value);
+    };
+    for (const auto& i : technologies_) {
+      if (i.type == TechnologyType::RENEWABLE) {
+        add_installation("#converter", i.code, 2.0 * mean_load / num_renewable);
+      } else if (i.type == TechnologyType::STORAGE) {
+        add_installation("#converter", i.code, 0.2 * mean_load / num_storage);
+      }
+    }
+    for (const auto& i : technologies_) {
+      if (i.type == TechnologyType::DISPATCHABLE)
+        add_installation("#multi-converter", i.code, 1.5 * mean_load / num_dispatchable);
+    }
+    for (const auto& i : technologies_) {
+      if (i.type == TechnologyType::STORAGE)
+        add_installation("#storage", i.code + "_STORAGE", 0.2 * mean_load / num_storage);
+    }
+    output.new_line();
+    output.push_back("#endblock");
+  }
+  output.writeToDisk(folder + "/Region.csv");
+}
+
+void ScenarioGenerator::WriteLinks(const std::string& folder) const {
+  io_routines::CsvOutput output;
+  output.push_back("#comment");
+  output.push_back("===============synthetic links===============");
+  output.new_line();
+  if (links_.empty()) {
+    output.push_back("#empty");
+  } else {
+    output.push_back("#blockwise");
+    for (const auto& i : links_) {
+      auto region_A = RegionCode(i.first);
+      auto region_B = RegionCode(i.second);
+      auto code = region_A + "_" + region_B;
+      AddLine(output, {"#code", code, "#region_A", region_A, "#region_B", region_B});
+      AddVariable(output, "length", "DVP_const", start(), 100. * (i.second - i.first));
+      AddLine(output, {"#converter", "#code", "EL_AC"});
+      auto capacity = 0.1 * (annual_demand_[i.first] + annual_demand_[i.second]) / (2 * hours_per_year);
+      AddVariable(output, "installation", "DVP_const", start(), capacity);
+      output.new_line();
+      output.push_back("#endblock");
+    }
+  }
+  output.writeToDisk(folder + "/Link.csv");
+}
+
+std::vector<double> ScenarioGenerator::DemandProfile(unsigned int region_index) {
+  std::normal_distribution<double> noise(0., 0.03);
+  std::vector<double> profile(hours_per_year);
+  auto shift = static_cast<double>(region_index % 4);
+  for (unsigned int h = 0; h < hours_per_year; ++h) {
+    auto hour_of_day = h % 24 + shift;
+    auto day = static_cast<double>(h / 24);
+    auto value = 1. + 0.25 * std::sin(2 * pi * (hour_of_day - 8.) / 24.) + 0.15 * std::cos(2 * pi * day / 365.)
+                 - ((h / 24) % 7 >= 5 ? 0.1 : 0.) + noise(generator_);
+    profile[h] = std::max(0.1, value);
+  }
+  //normalised to one, demand_electric_per_a gives the annual energy
+  auto sum = std::accumulate(profile.begin(), profile.end(), 0.);
+  for (auto& i : profile)
+    i /= sum;
+  return profile;
+}
+
+std::vector<double> ScenarioGenerator::RenewableProfile(const std::string& energy, unsigned int region_index) {
+  std::vector<double> profile(hours_per_year);
+  auto shift = static_cast<double>(region_index % 4);
+  if (energy == "SOLAR") {
+    std::uniform_real_distribution<double> clouds(0.3, 1.);
+    double cloud_factor = 1.;
+    for (unsigned int h = 0; h < hours_per_year; ++h) {
+      if (h % 24 == 0)
+        cloud_factor = clouds(generator_);
+      auto day = static_cast<double>(h / 24);
+      auto season = 0.55 + 0.45 * std::cos(2 * pi * (day - 172.) / 365.);
+      profile[h] = std::max(0., std::sin(pi * (h % 24 + shift - 6.) / 12.)) * season * cloud_factor;
+    }
+  } else if (energy.find("WIND") != std::string::npos) {
+    //auto-regressive process around the mean capacity factor
+    auto mean = (energy == "WIND_OFFSHORE") ? 0.45 : 0.3;
+    std::normal_distribution<double> noise(0., 0.05);
+    auto value = mean;
+    for (auto& i : profile) {
+      value = std::min(1., std::max(0., 0.97 * value + 0.03 * mean + noise(generator_)));
+      i = value;
+    }
+  } else {
+    std::normal_distribution<double> noise(0., 0.02);
+    for (unsigned int h = 0; h < hours_per_year; ++h) {
+      auto day = static_cast<double>(h / 24);
+      profile[h] = std::min(1., std::max(0., 0.5 + 0.2 * std::cos(2 * pi * (day - 120.) / 365.) + noise(generator_)));
+    }
+  }
+  return profile;
+}
+
+void ScenarioGenerator::AddLine(io_routines::CsvOutput& output, const std::vector<std::string>& fields) {
+  output.new_line();
+  for (const auto& i : fields)
+    output.push_back(i);
+}
+
+void ScenarioGenerator::AddVariable(io_routines::CsvOutput& output, const std::string& name, const std::string& type,
+                                    const std::string& time_point, double value) {
+  AddLine(output, {name, "#type", type, "#data", time_point});
+  output.push_back(ToString(value));
+}
+
+void ScenarioGenerator::AddTechnologyVariables(io_routines::CsvOutput& output, const Technology& tech,
+                                               const std::string& time_point) {
+  AddVariable(output, "efficiency_new", "DVP_linear", time_point, tech.efficiency);
+  AddVariable(output, "cost", "DVP_linear", time_point, tech.cost);
+  AddVariable(output, "lifetime", "DVP_linear", time_point, tech.lifetime);
+  AddVariable(output, "OaM_rate", "DVP_linear", time_point, tech.OaM_rate);
+}
+
+void ScenarioGenerator::AddSeries(io_routines::CsvOutput& output, const std::vector<double>& series) {
+  for (const auto& i : series)
+    output.push_back(ToString(i));
+}
+
+std::string ScenarioGenerator::ToString(double value) {
+  std::ostringstream stream;
+  stream << std::setprecision(10) << value;
+  return stream.str();
+}
+
+void ScenarioGenerator::MakeFolder(const std::string& folder) {
+  if (mkdir(folder.c_str(), 0755) != 0 && errno != EEXIST) {
+    std::cerr << "ERROR in benchmark::ScenarioGenerator::MakeFolder : cannot create folder " << folder << std::endl;
+    std::terminate();
+  }
+}
+
+std::string ScenarioGenerator::RegionCode(unsigned int index) const {
+  std::ostringstream stream;
+  stream << "R" << std::setw(3) << std::setfill('0') << index;
+  return stream.str();
+}
+
+std::string ScenarioGenerator::start() const {
+  return std::to_string(start_year) + "-01-01_00:00";
+}
+
+unsigned int ScenarioGenerator::count(TechnologyType type) const {
+  return static_cast<unsigned int>(std::count_if(technologies_.begin(), technologies_.end(),
+                                                 [type](const Technology& tech) {return tech.type == type;}));
+}
+
+void ScenarioGenerator::IssueError(std::string calling_function_name,
+                                   std::string error_message) const {
+  std::cerr << "ERROR in benchmark::ScenarioGenerator::" << calling_function_name << " :" << std::endl
+            << error_message << std::endl;
+  std::terminate();
+}
+
+} /* namespace benchmark */
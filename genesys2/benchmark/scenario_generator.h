@@ -0,0 +1,125 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// scenario_generator.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef BENCHMARK_SCENARIO_GENERATOR_H_
+#define BENCHMARK_SCENARIO_GENERATOR_H_
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <io_routines/csv_output.h>
+
+namespace benchmark {
+
+/**
+ * @brief Writes a synthetic scenario in the input format of builder::ModelBuilder
+ * @details The scenario consists of num_regions regions with num_technologies technologies each, connected by
+ *          num_links links. The technologies are taken in order from a fixed list of renewable, dispatchable and
+ *          storage archetypes, whose codes are known to dm_hsm::DynamicModel::setHSMCategoriesFromCode().
+ *          Demand and renewable profiles are drawn from a seeded random generator, so that the same sizes always
+ *          result in the same scenario. Next to the csv files a ProgramSettings.dat for num_years of operation and
+ *          an empty InstallationListResult.csv are written, the folder can be used directly with --mode=analysis
+ *          or --mode=benchmark.
+ */
+class ScenarioGenerator {
+ public:
+  ScenarioGenerator() = delete;
+  ~ScenarioGenerator() = default;
+  ScenarioGenerator(unsigned int num_regions,
+                    unsigned int num_links,
+                    unsigned int num_technologies,
+                    unsigned int num_years,
+                    unsigned int seed = 2017);
+
+  /**
+   * @brief Writes all input files of the scenario to folder (created if necessary)
+   *
+   * @param[in] folder Target folder of the scenario
+   */
+  void Write(const std::string& folder);
+
+  static unsigned int max_technologies();
+
+ private:
+  enum class TechnologyType {RENEWABLE, DISPATCHABLE, STORAGE};
+  struct Technology {
+    std::string code;
+    TechnologyType type;
+    std::string energy; ///< primary energy (renewable, dispatchable) or stored energy carrier (storage)
+    double cost;
+    double lifetime;
+    double efficiency;
+    double OaM_rate;
+    double fuel_cost; ///< dispatchable only
+    double co2_factor; ///< dispatchable only
+  };
+
+  static std::vector<Technology> archetypes();
+
+  void WriteProgramSettings(const std::string& folder) const;
+  void WriteInstallationList(const std::string& folder) const;
+  void WritePrimaryEnergy(const std::string& folder) const;
+  void WriteStorage(const std::string& folder) const;
+  void WriteConverter(const std::string& folder) const;
+  void WriteMultiConverter(const std::string& folder) const;
+  void WriteTransmissionConverter(const std::string& folder) const;
+  void WriteRegions(const std::string& folder);
+  void WriteLinks(const std::string& folder) const;
+
+  std::vector<double> DemandProfile(unsigned int region_index);
+  std::vector<double> RenewableProfile(const std::string& energy, unsigned int region_index);
+
+  static void AddLine(io_routines::CsvOutput& output, const std::vector<std::string>& fields);
+  static void AddVariable(io_routines::CsvOutput& output, const std::string& name, const std::string& type,
+                          const std::string& time_point, double value);
+  static void AddTechnologyVariables(io_routines::CsvOutput& output, const Technology& tech,
+                                     const std::string& time_point);
+  static void AddSeries(io_routines::CsvOutput& output, const std::vector<double>& series);
+  static std::string ToString(double value);
+  static void MakeFolder(const std::string& folder);
+  std::string RegionCode(unsigned int index) const;
+  std::string start() const;
+  unsigned int count(TechnologyType type) const;
+  void IssueError(std::string calling_function_name, std::string error_message) const;
+
+  unsigned int num_regions_;
+  unsigned int num_years_;
+  std::vector<Technology> technologies_;
+  std::vector<std::pair<unsigned int, unsigned int> > links_;
+  std::vector<double> annual_demand_;
+  std::mt19937 generator_;
+};
+
+} /* namespace benchmark */
+
+#endif /* BENCHMARK_SCENARIO_GENERATOR_H_ */
@@ -54,11 +54,11 @@ class ConverterPrototype : public virtual SysCompActPrototype {
                      const std::string& input,
                      const std::string& output,
                      bool bidirectional,
-                     std::unique_ptr<aux::TimeBasedData> efficiency_new,
-                     std::unique_ptr<aux::TimeBasedData> cost,
-                     std::unique_ptr<aux::TimeBasedData> lifetime,
-                     std::unique_ptr<aux::TimeBasedData> internal_rate_of_return,
-                     std::unique_ptr<aux::TimeBasedData> OaM_rate)
+                     std::shared_ptr<const aux::TimeBasedData> efficiency_new,
+                     std::shared_ptr<const aux::TimeBasedData> cost,
+                     std::shared_ptr<const aux::TimeBasedData> lifetime,
+                     std::shared_ptr<const aux::TimeBasedData> internal_rate_of_return,
+                     std::shared_ptr<const aux::TimeBasedData> OaM_rate)
       : SysCompActPrototype(code, name, input, output, std::move(efficiency_new), std::move(cost), std::move(lifetime),
                      std::move(internal_rate_of_return), std::move(OaM_rate)),
         bidirectional_(bidirectional) {}
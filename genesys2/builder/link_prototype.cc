@@ -39,7 +39,7 @@ LinkPrototype::LinkPrototype(const LinkPrototype& other)
     : SysComponent(other),
       region_A_(other.region_A_),
       region_B_(other.region_B_),
-      length_(std::move(other.length_->clone())) {
+      length_(other.length_) {
   if (!other.converter_list_.empty()) {
     for (const auto &it : other.converter_list_) {
       converter_list_.emplace(
@@ -66,7 +66,7 @@ class LinkPrototype : public SysComponent {
   std::string region_A() const {return region_A_;}
   std::string region_B() const {return region_B_;}
   double length(aux::SimulationClock::time_point tp) const {return (*length_)[tp];}
-  std::unique_ptr<aux::TimeBasedData> length() const {return length_->clone();}
+  const std::shared_ptr<const aux::TimeBasedData>& length() const {return length_;}
   const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
                                                    aux::SimulationClock::time_point,
                                                    aux::SimulationClock::time_point,
@@ -78,7 +78,7 @@ class LinkPrototype : public SysComponent {
  private:
   std::string region_A_;
   std::string region_B_;
-  std::unique_ptr<aux::TimeBasedData> length_;
+  std::shared_ptr<const aux::TimeBasedData> length_; ///read-only, shared by all copies
   std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
                                              aux::SimulationClock::time_point,
                                              aux::SimulationClock::time_point,
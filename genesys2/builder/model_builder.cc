@@ -43,7 +43,12 @@
 
 namespace builder {
 
+std::set<std::string> ModelBuilder::input_files_;
+
 am::AbstractModel ModelBuilder::Create() {
+  input_files_.clear();
+  if (!genesys::ProgramSettings::scenario_cache_file().empty())
+    scenario_cache_.reset(new ScenarioCache(genesys::ProgramSettings::scenario_cache_file()));
   FactoryPrimaryEnergy("PrimaryEnergy.csv");
   FactoryStorage("Storage.csv");
   FactoryConverter("Converter.csv");
@@ -54,6 +59,10 @@ am::AbstractModel ModelBuilder::Create() {
   if (genesys::ProgramSettings::use_global_file()) {
 	  FactoryGlobals("global.csv");
   }
+  if (scenario_cache_) {
+    scenario_cache_->Save();
+    scenario_cache_.reset();
+  }
   return am::AbstractModel(primary_energy_prototype_cache_,
                            storage_prototype_cache_,
                            converter_prototype_cache_,
@@ -553,6 +562,7 @@ std::vector<std::string> ModelBuilder::GetData(const std::unordered_map<std::str
   std::vector<std::string> return_vector;
   auto search_data_source_path = var_keys.find("#data_source_path");
   if (search_data_source_path != var_keys.end()) {
+    input_files_.insert(search_data_source_path->second);
     auto data_source_file = io_routines::CsvInput(search_data_source_path->second);
     return_vector = data_source_file.GetFieldsUpToEOL();
   } else if (file_.get_field().compare("#data") == 0) {
@@ -569,6 +579,65 @@ std::vector<std::string> ModelBuilder::GetData(const std::unordered_map<std::str
   return return_vector;
 }
 
+std::vector<double> ModelBuilder::GetValues(const std::unordered_map<std::string, std::string>& var_keys) {
+  //same as GetData, but the fields are parsed as numbers straight from the input file
+  std::vector<double> return_vector;
+  std::pair<std::string, std::uint64_t> cache_key;
+  auto search_data_source_path = var_keys.find("#data_source_path");
+  if (search_data_source_path != var_keys.end())
+    input_files_.insert(search_data_source_path->second);
+  if (scenario_cache_) {
+    cache_key = CacheKey("TS", var_keys);
+    if (scenario_cache_->Find(cache_key.first, cache_key.second, return_vector)) {
+      SkipData(var_keys);
+      return return_vector;
+    }
+  }
+  if (search_data_source_path != var_keys.end()) {
+    auto data_source_file = io_routines::CsvInput(search_data_source_path->second);
+    return_vector = data_source_file.GetValuesUpToEOL();
+  } else if (file_.get_field().compare("#data") == 0) {
+    if (file_.next_field()) {
+      return_vector = file_.GetValuesUpToEOL();
+    } else {
+      IssueError("GetValues", "expected more fields in file after #data; " + file_.filename()
+                 + ", line " + file_.current_line() + " (after field" + file_.current_field() + ")");
+    }
+  } else {
+    IssueError("GetValues", "missing keywords #data or #data_source_path in file " + file_.filename()
+               + ", line " + file_.current_line());
+  }
+  if (scenario_cache_)
+    scenario_cache_->Insert(cache_key.first, cache_key.second, return_vector);
+  return return_vector;
+}
+
+std::pair<std::string, std::uint64_t> ModelBuilder::CacheKey(const std::string& data_type,
+                                                             const std::unordered_map<std::string,
+                                                             std::string>& var_keys) {
+  //separate data files are cached on their own, inline data depends on the whole file it is part of
+  auto search_data_source_path = var_keys.find("#data_source_path");
+  if (search_data_source_path != var_keys.end())
+    return std::make_pair(data_type + ":" + search_data_source_path->second,
+                          FileFingerprint(search_data_source_path->second));
+  return std::make_pair(data_type + ":" + file_.filename() + ":" + file_.current_line(),
+                        FileFingerprint(file_.filename()));
+}
+
+std::uint64_t ModelBuilder::FileFingerprint(const std::string& filename) {
+  auto search = file_fingerprints_.find(filename);
+  if (search == file_fingerprints_.end())
+    search = file_fingerprints_.emplace(filename, io_routines::CsvInput::Fingerprint(filename)).first;
+  return search->second;
+}
+
+void ModelBuilder::SkipData(const std::unordered_map<std::string, std::string>& var_keys) {
+  //leaves the cursor where GetData would have left it
+  if (var_keys.find("#data_source_path") == var_keys.end()) {
+    while (file_.next_field()) {}
+  }
+}
+
 void ModelBuilder::ProcessVariablesUpTo(std::vector<std::string>&& stop_keywords, std::vector<std::string> optional_var) {
   //std::cout << "FUNC-ID: ModelBuilder::ProcessVariablesUpTo\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<<std::endl;
   TBDvariable_cache_.clear();
@@ -636,23 +705,35 @@ void ModelBuilder::ProcessVariablesUpTo(std::vector<std::string>&& stop_keywords
 std::unique_ptr<aux::TimeBasedData> ModelBuilder::ProcessDVPData(const std::unordered_map<std::string,
                                                                  std::string>& var_keys) {
   //std::cout << "FUNC-ID: ModelBuilder::ProcessDVPData\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-2)<<std::endl;
-  auto var_data = GetData(var_keys);
   std::vector<std::pair<aux::SimulationClock::time_point, double> > dvp_data;
-  bool next_entry_is_second = false;
-  std::string tmp_string;
-  for (auto&& i : var_data) {
+  std::pair<std::string, std::uint64_t> cache_key;
+  auto search_data_source_path = var_keys.find("#data_source_path");
+  if (search_data_source_path != var_keys.end())
+    input_files_.insert(search_data_source_path->second);
+  if (scenario_cache_)
+    cache_key = CacheKey("DVP", var_keys);
+  if (scenario_cache_ && scenario_cache_->Find(cache_key.first, cache_key.second, dvp_data)) {
+    SkipData(var_keys);
+  } else {
+    auto var_data = GetData(var_keys);
+    bool next_entry_is_second = false;
+    std::string tmp_string;
+    for (auto&& i : var_data) {
+      if (next_entry_is_second) {
+        next_entry_is_second = false;
+        dvp_data.push_back(std::pair<aux::SimulationClock::time_point, double>(
+          aux::SimulationClock::time_point_from_string(tmp_string), std::stod(i)));
+      } else {
+        next_entry_is_second = true;
+        tmp_string = i;
+      }
+    }
     if (next_entry_is_second) {
-      next_entry_is_second = false;
-      dvp_data.push_back(std::pair<aux::SimulationClock::time_point, double>(
-        aux::SimulationClock::time_point_from_string(tmp_string), std::stod(i)));
-    } else {
-      next_entry_is_second = true;
-      tmp_string = i;
+      IssueError("ProcessDVPData", "no data given for last timepoint - expected (one) more field(s) in file "
+                 + file_.filename() + ", line " + file_.current_line() + " (after field" + file_.current_field() + ")");
     }
-  }
-  if (next_entry_is_second) {
-    IssueError("ProcessDVPData", "no data given for last timepoint - expected (one) more field(s) in file "
-               + file_.filename() + ", line " + file_.current_line() + " (after field" + file_.current_field() + ")");
+    if (scenario_cache_)
+      scenario_cache_->Insert(cache_key.first, cache_key.second, dvp_data);
   }
   auto type_info = var_keys.find("#type")->second;
   if (type_info.find("const") != std::string::npos) {
@@ -669,10 +750,7 @@ std::unique_ptr<aux::TimeBasedData> ModelBuilder::ProcessDVPData(const std::unor
 std::unique_ptr<aux::TimeBasedData> ModelBuilder::ProcessTSData(const std::unordered_map<std::string,
                                                                 std::string>& var_keys) {
   //std::cout << "FUNC-ID: ModelBuilder::ProcessTSData\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<<std::endl;
-  auto ts_value_strings = GetData(var_keys);
-  std::vector<double> ts_values;
-  for (auto&& i : ts_value_strings)
-    ts_values.push_back(std::stod(i));
+  auto ts_values = GetValues(var_keys);
   aux::SimulationClock::duration ts_interval;
   aux::SimulationClock::time_point ts_start;
   auto search_interval = var_keys.find("#interval");
@@ -730,6 +808,7 @@ aux::TBDLookupTable ModelBuilder::ProcessTBDLookupTableData(const std::string& d
           + " after line " + file_.current_line());
     }
   } else {
+    input_files_.insert(data_source_path);
     source_file = io_routines::CsvInput(data_source_path);
     std::swap(file_, source_file);
   }
@@ -32,9 +32,12 @@
 #ifndef BUILDER_MODEL_BUILDER_H_
 #define BUILDER_MODEL_BUILDER_H_
 
+#include <cstdint>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <builder/converter_prototype.h>
@@ -45,6 +48,7 @@
 #include <builder/transm_conv_prototype.h>
 #include <builder/multi_converter_proto.h>
 #include <builder/global_proto.h>
+#include <builder/scenario_cache.h>
 #include <abstract_model/abstract_model.h>
 #include <auxiliaries/time_tools.h>
 #include <io_routines/csv_input.h>
@@ -62,6 +66,10 @@ class ModelBuilder {
 
   am::AbstractModel Create();
 
+  /** @brief Input files read by the last call of Create(), including separate data source files.
+   */
+  static const std::set<std::string>& input_files() {return input_files_;}
+
  private:
   void FactoryPrimaryEnergy(const std::string& filename);
   void FactoryStorage(const std::string& filename);
@@ -77,12 +85,22 @@ class ModelBuilder {
                         std::vector<std::string>&& block_delimiter,
                         std::vector<std::string> optional_variables = {});
   std::unordered_map<std::string, double> PrepareMCExtraContent();
-  void open_file(const std::string& filename) {file_ = io_routines::CsvInput(filename);}
+  void open_file(const std::string& filename) {
+    input_files_.insert(filename);
+    file_ = io_routines::CsvInput(filename);
+  }
   bool check_blockwise();
   void skip_comment();
   std::unordered_map<std::string, std::string> ParseKeywords();
   std::vector<std::string> GetData(const std::unordered_map<std::string,
                                    std::string>& var_keys);
+  std::vector<double> GetValues(const std::unordered_map<std::string,
+                                std::string>& var_keys);
+  std::pair<std::string, std::uint64_t> CacheKey(const std::string& data_type,
+                                                 const std::unordered_map<std::string,
+                                                 std::string>& var_keys);
+  std::uint64_t FileFingerprint(const std::string& filename);
+  void SkipData(const std::unordered_map<std::string, std::string>& var_keys);
   //void ProcessVariablesUpTo(std::vector<std::string>&& stop_keywords);
   void ProcessVariablesUpTo(std::vector<std::string>&& stop_keywords,
                             std::vector<std::string> optional_var = {});
@@ -105,6 +123,9 @@ class ModelBuilder {
                     std::string error_message) const;
 
   io_routines::CsvInput file_; /// currently processed input file
+  std::unique_ptr<ScenarioCache> scenario_cache_; /// parsed data blocks of earlier runs, if enabled
+  std::unordered_map<std::string, std::uint64_t> file_fingerprints_;
+  static std::set<std::string> input_files_;
 
   /// variable caches
   std::unordered_map<std::string, std::unique_ptr<aux::TimeBasedData> > TBDvariable_cache_;
@@ -37,8 +37,11 @@ namespace builder {
 
 RegionPrototype::RegionPrototype(const RegionPrototype& other)
     : SysComponent(other),
-      demand_electric_dyn_(std::move(other.demand_electric_dyn_->clone())),
-      demand_electric_per_a_(std::move(other.demand_electric_per_a_->clone())),
+      demand_electric_dyn_(other.demand_electric_dyn_),
+      demand_electric_per_a_(other.demand_electric_per_a_),
+      demand_heat_dyn_(other.demand_heat_dyn_),
+      demand_heat_per_a_(other.demand_heat_per_a_),
+      ambient_temp_dyn_(other.ambient_temp_dyn_),
       module_heat_active_ (other.module_heat_active_){
   if (!other.primary_energy_list_.empty()) {
     for (const auto &it : other.primary_energy_list_) {
@@ -63,12 +66,6 @@ RegionPrototype::RegionPrototype(const RegionPrototype& other)
                                                       std::get<2>(it.second), std::get<3>(it.second)));
     }
   }
-  if(other.demand_heat_dyn_)
-    demand_heat_dyn_ = (std::move(other.demand_heat_dyn_->clone()));
-  if(other.demand_heat_per_a_)
-    demand_heat_per_a_ = (std::move(other.demand_heat_per_a_->clone()));
-  if(other.ambient_temp_dyn_)
-    ambient_temp_dyn_ = (std::move(other.ambient_temp_dyn_->clone()));
 }
 
 RegionPrototype::RegionPrototype(const std::string& code,
@@ -178,4 +175,15 @@ aux::TimeSeriesConst RegionPrototype::demand_electric(aux::SimulationClock::time
   return (aux::TimeSeriesConst(demand_vec, start, genesys::ProgramSettings::simulation_step_length()));
 }
 
+void RegionPrototype::demand_electric(aux::SimulationClock::time_point start,
+                                      aux::SimulationClock::duration interval,
+                                      std::size_t count,
+                                      double* values) const {
+  std::vector<double> per_a(count);
+  demand_electric_dyn_->sample(start, interval, count, values);
+  demand_electric_per_a_->sample(start, interval, count, per_a.data());
+  for (std::size_t i = 0; i < count; ++i)
+    values[i] *= per_a[i];
+}
+
 } /* namespace builder */
@@ -32,6 +32,7 @@
 #ifndef BUILDER_REGION_PROTOTYPE_H_
 #define BUILDER_REGION_PROTOTYPE_H_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -86,6 +87,10 @@ class RegionPrototype : public SysComponent {
 
   aux::TimeSeriesConst demand_electric (aux::SimulationClock::time_point start,
                                         aux::SimulationClock::time_point end) const;
+  void demand_electric(aux::SimulationClock::time_point start,
+                       aux::SimulationClock::duration interval,
+                       std::size_t count,
+                       double* values) const; ///< values[i] = demand_electric(start + i * interval)
   const std::unordered_map<std::string, aux::TBDLookupTable>& primary_energy_list() const {
     return primary_energy_list_; }
   const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
@@ -105,11 +110,12 @@ class RegionPrototype : public SysComponent {
     return storage_list_;}
 
  private:
-  std::unique_ptr<aux::TimeBasedData> demand_electric_dyn_;
-  std::unique_ptr<aux::TimeBasedData> demand_electric_per_a_;
-  std::unique_ptr<aux::TimeBasedData> demand_heat_dyn_;
-  std::unique_ptr<aux::TimeBasedData> demand_heat_per_a_;
-  std::unique_ptr<aux::TimeBasedData> ambient_temp_dyn_;
+  // read-only input series, shared by all copies along am -> sm -> dm_hsm -> analysis_hsm instead of cloned
+  std::shared_ptr<const aux::TimeBasedData> demand_electric_dyn_;
+  std::shared_ptr<const aux::TimeBasedData> demand_electric_per_a_;
+  std::shared_ptr<const aux::TimeBasedData> demand_heat_dyn_;
+  std::shared_ptr<const aux::TimeBasedData> demand_heat_per_a_;
+  std::shared_ptr<const aux::TimeBasedData> ambient_temp_dyn_;
   bool module_heat_active_;
   std::unordered_map<std::string, aux::TBDLookupTable> primary_energy_list_;
   std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
@@ -0,0 +1,209 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// scenario_cache.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <builder/scenario_cache.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <unistd.h>
+
+namespace builder {
+
+namespace {
+const char kMagicHeader[8] = {'G', 'S', 'Y', 'S', '_', 'M', 'D', 'L'};
+const std::uint32_t kVersion = 1;
+const std::uint32_t kEndianMark = 0x01020304;
+}
+
+ScenarioCache::ScenarioCache(const std::string& filename)
+    : filename_(filename),
+      file_(),
+      blocks_(),
+      lookups_(0),
+      hits_(0),
+      modified_(false) {
+  Load();
+}
+
+bool ScenarioCache::Find(const std::string& tag, std::uint64_t fingerprint, std::vector<double>& values) {
+  auto block = Use(tag, fingerprint, Kind::values);
+  if (!block)
+    return false;
+  values.resize(block->count);
+  if (block->count > 0)
+    std::memcpy(values.data(), block->bytes(), block->count * sizeof(double));
+  return true;
+}
+
+bool ScenarioCache::Find(const std::string& tag, std::uint64_t fingerprint, DateValuePairs& date_value_pairs) {
+  auto block = Use(tag, fingerprint, Kind::date_value_pairs);
+  if (!block)
+    return false;
+  date_value_pairs.clear();
+  date_value_pairs.reserve(block->count);
+  const char* pos = block->bytes();
+  for (std::uint64_t i = 0; i < block->count; ++i) {
+    std::int64_t minutes;
+    double value;
+    std::memcpy(&minutes, pos, sizeof(minutes));
+    std::memcpy(&value, pos + sizeof(minutes), sizeof(value));
+    pos += sizeof(minutes) + sizeof(value);
+    date_value_pairs.emplace_back(aux::SimulationClock::time_point(aux::SimulationClock::duration(minutes)), value);
+  }
+  return true;
+}
+
+void ScenarioCache::Insert(const std::string& tag, std::uint64_t fingerprint, const std::vector<double>& values) {
+  Block block{fingerprint, Kind::values, values.size(), nullptr,
+              std::string(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double)), true};
+  blocks_[tag] = std::move(block);
+  modified_ = true;
+}
+
+void ScenarioCache::Insert(const std::string& tag, std::uint64_t fingerprint, const DateValuePairs& date_value_pairs) {
+  Block block{fingerprint, Kind::date_value_pairs, date_value_pairs.size(), nullptr, std::string(), true};
+  for (const auto& i : date_value_pairs) {
+    append(block.data, static_cast<std::int64_t>(i.first.time_since_epoch().count()));
+    append(block.data, i.second);
+  }
+  blocks_[tag] = std::move(block);
+  modified_ = true;
+}
+
+const ScenarioCache::Block* ScenarioCache::Use(const std::string& tag, std::uint64_t fingerprint, Kind kind) {
+  ++lookups_;
+  auto search = blocks_.find(tag);
+  if (search == blocks_.end() || search->second.fingerprint != fingerprint || search->second.kind != kind)
+    return nullptr;
+  ++hits_;
+  search->second.used = true;
+  return &search->second;
+}
+
+void ScenarioCache::Load() {
+  file_.reset(new io_routines::MappedFile(filename_));
+  if (!file_->is_open() || file_->size() == 0) {
+    std::cout << "INFO: no scenario cache found in " << filename_ << ", starting empty" << std::endl;
+    file_.reset();
+    return;
+  }
+  const char* pos = file_->begin();
+  const char* end = file_->end();
+  char magic[sizeof(kMagicHeader)];
+  std::uint32_t version = 0;
+  std::uint32_t endian_mark = 0;
+  std::uint64_t block_count = 0;
+  bool valid = read(pos, end, magic) && std::memcmp(magic, kMagicHeader, sizeof(kMagicHeader)) == 0
+               && read(pos, end, version) && version == kVersion
+               && read(pos, end, endian_mark) && endian_mark == kEndianMark
+               && read(pos, end, block_count);
+  for (std::uint64_t i = 0; valid && i < block_count; ++i) {
+    std::uint32_t tag_length = 0;
+    valid = read(pos, end, tag_length) && static_cast<std::size_t>(end - pos) >= tag_length;
+    if (!valid)
+      break;
+    std::string tag(pos, tag_length);
+    pos += tag_length;
+    Block block{0, Kind::values, 0, nullptr, std::string(), false};
+    std::uint32_t kind = 0;
+    valid = read(pos, end, block.fingerprint) && read(pos, end, kind) && kind <= 1 && read(pos, end, block.count);
+    if (!valid)
+      break;
+    block.kind = static_cast<Kind>(kind);
+    const std::uint64_t element_size = (block.kind == Kind::values) ? sizeof(double)
+                                                                    : sizeof(std::int64_t) + sizeof(double);
+    //compare before multiplying, a damaged count must not wrap around the bounds check
+    valid = block.count <= static_cast<std::uint64_t>(end - pos) / element_size;
+    block.mapped_data = pos;
+    pos += valid ? block.count * element_size : 0;
+    blocks_.emplace(std::move(tag), std::move(block));
+  }
+  if (!valid || pos != end) {
+    std::cout << "INFO: scenario cache " << filename_
+              << " does not match this version of genesys or is damaged, starting empty" << std::endl;
+    blocks_.clear();
+    file_.reset();
+    return;
+  }
+  std::cout << "INFO: loaded " << blocks_.size() << " data blocks from scenario cache " << filename_ << std::endl;
+}
+
+void ScenarioCache::Save() const {
+  std::size_t used_blocks = 0;
+  for (const auto& i : blocks_)
+    used_blocks += i.second.used ? 1 : 0;
+  std::cout << "INFO: scenario cache " << filename_ << " provided " << hits_ << " of " << lookups_
+            << " data blocks" << std::endl;
+  if (!modified_ && used_blocks == blocks_.size())
+    return;
+  std::string buffer(kMagicHeader, sizeof(kMagicHeader));
+  append(buffer, kVersion);
+  append(buffer, kEndianMark);
+  append(buffer, static_cast<std::uint64_t>(used_blocks));
+  for (const auto& i : blocks_) {
+    if (!i.second.used)
+      continue;
+    append(buffer, static_cast<std::uint32_t>(i.first.size()));
+    buffer.append(i.first);
+    append(buffer, i.second.fingerprint);
+    append(buffer, static_cast<std::uint32_t>(i.second.kind));
+    append(buffer, i.second.count);
+    buffer.append(i.second.bytes(), i.second.count * ((i.second.kind == Kind::values)
+                                                      ? sizeof(double) : sizeof(std::int64_t) + sizeof(double)));
+  }
+  // the old cache file may still be mapped, it is replaced instead of overwritten; the temporary
+  // file is per process since every MPI rank builds the model and saves the cache
+  std::string temp_filename = filename_ + "." + std::to_string(::getpid()) + ".tmp";
+  std::ofstream filestream(temp_filename, std::ofstream::binary | std::ofstream::trunc);
+  if (!filestream.is_open() || !filestream.write(buffer.data(), buffer.size())) {
+    std::cerr << "WARNING: cannot write scenario cache " << temp_filename << std::endl;
+    std::remove(temp_filename.c_str());
+    return;
+  }
+  filestream.close();
+  if (std::rename(temp_filename.c_str(), filename_.c_str()) != 0)
+    std::cerr << "WARNING: cannot replace scenario cache " << filename_ << std::endl;
+}
+
+template<typename T>
+bool ScenarioCache::read(const char*& pos, const char* end, T& value) {
+  if (static_cast<std::size_t>(end - pos) < sizeof(T))
+    return false;
+  std::memcpy(&value, pos, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+} /* namespace builder */
@@ -0,0 +1,115 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// scenario_cache.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef BUILDER_SCENARIO_CACHE_H_
+#define BUILDER_SCENARIO_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <auxiliaries/simulation_clock.h>
+#include <io_routines/mapped_file.h>
+
+namespace builder {
+
+/**
+ * @brief Binary cache of the data blocks parsed by the ModelBuilder, shared by repeated runs on one scenario
+ *
+ * Every block is stored under the position of its variable in the input files (tag) together with a
+ * fingerprint of the files it was parsed from, a block is only reused if the fingerprint still matches.
+ * The cache file is memory mapped; blocks not used by a run are dropped when the cache is saved.
+ */
+class ScenarioCache {
+ public:
+  typedef std::vector<std::pair<aux::SimulationClock::time_point, double> > DateValuePairs;
+
+  ScenarioCache() = delete;
+  ~ScenarioCache() = default;
+  ScenarioCache(const ScenarioCache&) = delete;
+  ScenarioCache& operator=(const ScenarioCache&) = delete;
+  explicit ScenarioCache(const std::string& filename);
+
+  /** \name Access to the data blocks, Find returns false for missing or outdated blocks.*/
+  ///@{
+  bool Find(const std::string& tag, std::uint64_t fingerprint, std::vector<double>& values);
+  bool Find(const std::string& tag, std::uint64_t fingerprint, DateValuePairs& date_value_pairs);
+  void Insert(const std::string& tag, std::uint64_t fingerprint, const std::vector<double>& values);
+  void Insert(const std::string& tag, std::uint64_t fingerprint, const DateValuePairs& date_value_pairs);
+  ///@}
+
+  /**
+   * @brief Writes the blocks used since construction to the cache file, if any of them changed
+   */
+  void Save() const;
+
+  /** \name Statistics.*/
+  ///@{
+  std::size_t lookups() const {return lookups_;}
+  std::size_t hits() const {return hits_;}
+  ///@}
+
+ private:
+  enum class Kind : std::uint32_t {values = 0, date_value_pairs = 1};
+  struct Block {
+    std::uint64_t fingerprint;
+    Kind kind;
+    std::uint64_t count;
+    const char* mapped_data; ///< points into the cache file, if loaded from there
+    std::string data;
+    bool used;
+    const char* bytes() const {return mapped_data ? mapped_data : data.data();}
+  };
+
+  void Load();
+  const Block* Use(const std::string& tag, std::uint64_t fingerprint, Kind kind);
+  template<typename T>
+  static void append(std::string& buffer, const T& value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  template<typename T>
+  static bool read(const char*& pos, const char* end, T& value);
+
+  std::string filename_;
+  std::unique_ptr<io_routines::MappedFile> file_;
+  std::unordered_map<std::string, Block> blocks_;
+  std::size_t lookups_;
+  std::size_t hits_;
+  bool modified_;
+};
+
+} /* namespace builder */
+
+#endif /* BUILDER_SCENARIO_CACHE_H_ */
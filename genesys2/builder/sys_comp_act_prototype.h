@@ -50,11 +50,11 @@ class SysCompActPrototype : public SysComponent {
       : SysComponent(other),
         input_(other.input_),
         output_(other.output_),
-        efficiency_new_(std::move(other.efficiency_new_->clone())),
-        cost_(std::move(other.cost_->clone())),
-        lifetime_(std::move(other.lifetime_->clone())),
-        internal_rate_of_return_(std::move(other.internal_rate_of_return_->clone())),
-        OaM_rate_(std::move(other.OaM_rate_->clone())) {}
+        efficiency_new_(other.efficiency_new_),
+        cost_(other.cost_),
+        lifetime_(other.lifetime_),
+        internal_rate_of_return_(other.internal_rate_of_return_),
+        OaM_rate_(other.OaM_rate_) {}
   SysCompActPrototype(SysCompActPrototype&& other) = default;
   SysCompActPrototype& operator=(const SysCompActPrototype&) = delete;
   SysCompActPrototype& operator=(SysCompActPrototype&&) = delete;
@@ -62,11 +62,11 @@ class SysCompActPrototype : public SysComponent {
                       const std::string& name,
                       const std::string& input,
                       const std::string& output,
-                      std::unique_ptr<aux::TimeBasedData> efficiency_new,
-                      std::unique_ptr<aux::TimeBasedData> cost,
-                      std::unique_ptr<aux::TimeBasedData> lifetime,
-                      std::unique_ptr<aux::TimeBasedData> internal_rate_of_return,
-                      std::unique_ptr<aux::TimeBasedData> OaM_rate)
+                      std::shared_ptr<const aux::TimeBasedData> efficiency_new,
+                      std::shared_ptr<const aux::TimeBasedData> cost,
+                      std::shared_ptr<const aux::TimeBasedData> lifetime,
+                      std::shared_ptr<const aux::TimeBasedData> internal_rate_of_return,
+                      std::shared_ptr<const aux::TimeBasedData> OaM_rate)
       : SysComponent(code, name),
         input_(input),
         output_(output),
@@ -87,20 +87,21 @@ class SysCompActPrototype : public SysComponent {
   double lifetime(aux::SimulationClock::time_point tp) const {return ((*lifetime_)[tp]);}
   double internal_rate_of_return(aux::SimulationClock::time_point tp) const {return ((*internal_rate_of_return_)[tp]);}
   double OaM_rate(aux::SimulationClock::time_point tp) const {return ((*OaM_rate_)[tp]);}
-  std::unique_ptr<aux::TimeBasedData> efficiency_new() const {return efficiency_new_->clone();}
-  std::unique_ptr<aux::TimeBasedData> cost() const {return cost_->clone();}
-  std::unique_ptr<aux::TimeBasedData> lifetime() const {return lifetime_->clone();}
-  std::unique_ptr<aux::TimeBasedData> internal_rate_of_return() const {return internal_rate_of_return_->clone();}
-  std::unique_ptr<aux::TimeBasedData> OaM_rate() const {return OaM_rate_->clone();}
+  const std::shared_ptr<const aux::TimeBasedData>& efficiency_new() const {return efficiency_new_;}
+  const std::shared_ptr<const aux::TimeBasedData>& cost() const {return cost_;}
+  const std::shared_ptr<const aux::TimeBasedData>& lifetime() const {return lifetime_;}
+  const std::shared_ptr<const aux::TimeBasedData>& internal_rate_of_return() const {return internal_rate_of_return_;}
+  const std::shared_ptr<const aux::TimeBasedData>& OaM_rate() const {return OaM_rate_;}
 
  private:
   std::string input_;
   std::string output_;
-  std::unique_ptr<aux::TimeBasedData> efficiency_new_;
-  std::unique_ptr<aux::TimeBasedData> cost_;
-  std::unique_ptr<aux::TimeBasedData> lifetime_;
-  std::unique_ptr<aux::TimeBasedData> internal_rate_of_return_;
-  std::unique_ptr<aux::TimeBasedData> OaM_rate_;
+  // read-only input data, shared by all copies along am -> sm -> dm_hsm -> analysis_hsm instead of cloned
+  std::shared_ptr<const aux::TimeBasedData> efficiency_new_;
+  std::shared_ptr<const aux::TimeBasedData> cost_;
+  std::shared_ptr<const aux::TimeBasedData> lifetime_;
+  std::shared_ptr<const aux::TimeBasedData> internal_rate_of_return_;
+  std::shared_ptr<const aux::TimeBasedData> OaM_rate_;
 };
 
 } /* namespace builder */
@@ -50,8 +50,8 @@ class TransmConvPrototype : public ConverterPrototype {
   TransmConvPrototype(const TransmConvPrototype& other)
       : SysCompActPrototype(other), // virtual inheritance and deleted default c'tor
         ConverterPrototype(other),
-        length_dep_loss_(std::move(other.length_dep_loss_->clone())),
-        length_dep_cost_(std::move(other.length_dep_cost_->clone())) {}
+        length_dep_loss_(other.length_dep_loss_),
+        length_dep_cost_(other.length_dep_cost_) {}
   TransmConvPrototype(TransmConvPrototype&& other) = default;
   TransmConvPrototype& operator=(const TransmConvPrototype&) = delete;
   TransmConvPrototype& operator=(TransmConvPrototype&&) = delete;
@@ -60,13 +60,13 @@ class TransmConvPrototype : public ConverterPrototype {
                       const std::string& source,
                       const std::string& sink,
                       bool bidirectional,
-                      std::unique_ptr<aux::TimeBasedData> efficiency_new,
-                      std::unique_ptr<aux::TimeBasedData> cost,
-                      std::unique_ptr<aux::TimeBasedData> lifetime,
-                      std::unique_ptr<aux::TimeBasedData> internal_rate_of_return,
-                      std::unique_ptr<aux::TimeBasedData> OaM_rate,
-                      std::unique_ptr<aux::TimeBasedData> length_dep_loss,
-                      std::unique_ptr<aux::TimeBasedData> length_dep_cost)
+                      std::shared_ptr<const aux::TimeBasedData> efficiency_new,
+                      std::shared_ptr<const aux::TimeBasedData> cost,
+                      std::shared_ptr<const aux::TimeBasedData> lifetime,
+                      std::shared_ptr<const aux::TimeBasedData> internal_rate_of_return,
+                      std::shared_ptr<const aux::TimeBasedData> OaM_rate,
+                      std::shared_ptr<const aux::TimeBasedData> length_dep_loss,
+                      std::shared_ptr<const aux::TimeBasedData> length_dep_cost)
       : SysCompActPrototype(code, name, source, sink, std::move(efficiency_new), std::move(cost),
                             std::move(lifetime), std::move(internal_rate_of_return), std::move(OaM_rate)), // diamond problem and deleted default c'tor
         ConverterPrototype(*this, bidirectional),
@@ -74,12 +74,12 @@ class TransmConvPrototype : public ConverterPrototype {
         length_dep_cost_(std::move(length_dep_cost)) {}
 
  protected:
-  std::unique_ptr<aux::TimeBasedData> length_dep_loss_TBD() const {return length_dep_loss_->clone();}
-  std::unique_ptr<aux::TimeBasedData> length_dep_cost_TBD() const {return length_dep_cost_->clone();}
+  const std::shared_ptr<const aux::TimeBasedData>& length_dep_loss_TBD() const {return length_dep_loss_;}
+  const std::shared_ptr<const aux::TimeBasedData>& length_dep_cost_TBD() const {return length_dep_cost_;}
 
  private:
-  std::unique_ptr<aux::TimeBasedData> length_dep_loss_;
-  std::unique_ptr<aux::TimeBasedData> length_dep_cost_;
+  std::shared_ptr<const aux::TimeBasedData> length_dep_loss_;
+  std::shared_ptr<const aux::TimeBasedData> length_dep_cost_;
 };
 
 } /* namespace builder */
@@ -44,6 +44,11 @@ std::string CmdParameters::input_filename_  = "InstallationListResult.csv";
 std::string CmdParameters::scenario_name_ = "default-scenario-name";
 int CmdParameters::threads_ = 1;
 bool CmdParameters::verbose_output_ = false;
+unsigned int CmdParameters::generator_regions_ = 4;
+unsigned int CmdParameters::generator_links_ = 3;
+unsigned int CmdParameters::generator_technologies_ = 5;
+unsigned int CmdParameters::generator_years_ = 1;
+unsigned int CmdParameters::benchmark_evaluations_ = 10;
 
 CmdParameters::CmdParameters(int input_argc, const char* input_argv[])
     : program_settings_file_("ProgramSettings.dat") {
@@ -81,7 +86,8 @@ CmdParameters::CmdParameters(int input_argc, const char* input_argv[])
 		  std::cout << "threads_ = " << threads_ << std::endl;
 		}	else if (sParameter == "--mode") {
 		  auto mode = sValue;
-		  if (mode == "analysis"  || mode == "optimisation" || mode == "optimization" || mode == "optim" || mode=="test") {
+		  if (mode == "analysis"  || mode == "optimisation" || mode == "optimization" || mode == "optim" || mode=="test"
+		      || mode == "benchmark" || mode == "generate") {
 			  if (mode == "optimization" || mode == "optim") {
 				  mode_ = "optimisation";
 			  } else {
@@ -115,6 +121,16 @@ CmdParameters::CmdParameters(int input_argc, const char* input_argv[])
 		        std::terminate();
 			}
 
+		} else if (sParameter == "--regions") {
+			generator_regions_ = ParseCount(sParameter, sValue);
+		} else if (sParameter == "--links") {
+			generator_links_ = ParseCount(sParameter, sValue);
+		} else if (sParameter == "--technologies") {
+			generator_technologies_ = ParseCount(sParameter, sValue);
+		} else if (sParameter == "--years") {
+			generator_years_ = ParseCount(sParameter, sValue);
+		} else if (sParameter == "--evaluations") {
+			benchmark_evaluations_ = ParseCount(sParameter, sValue);
 		} else {
 			std::cerr << "Error while reading command line parameters: "<< sParameter << std::endl;
 			std::terminate();
@@ -133,12 +149,17 @@ void CmdParameters::PrintAll() {
 			  << "threads_ = " << threads_ << "\n"
 			  << "scenario_name_ = " << scenario_name_ << "\n"
 			  << "verbose_output_ = " << verbose_output_ << "\n"
+			  << "generator_regions_ = " << generator_regions_ << "\n"
+			  << "generator_links_ = " << generator_links_ << "\n"
+			  << "generator_technologies_ = " << generator_technologies_ << "\n"
+			  << "generator_years_ = " << generator_years_ << "\n"
+			  << "benchmark_evaluations_ = " << benchmark_evaluations_ << "\n"
 			  << "======CmdParameters::PrintAll===============" << "\n"<< std::endl;
 }
 
 void CmdParameters::printusage(const char *prog) const {
   std::cout << "Use with options: \n"<< prog << std::endl;
-  std::cout << "       --mode= <optimisation| optim | analysis : run mode >" << std::endl;
+  std::cout << "       --mode= <optimisation| optim | analysis | benchmark | generate : run mode >" << std::endl;
   std::cout << "       --threads= <number of threads to calculate optimisation | max | all : analysis is always running on 1 thread>" << std::endl;
   std::cout << "       --input= <input_filename of InstallationListResult.csv>" << std::endl;
   std::cout << "       --output= <output filename of analysedResult(.xml)>" << std::endl;
@@ -146,6 +167,21 @@ void CmdParameters::printusage(const char *prog) const {
   std::cout << "       --settings= <filename of ProgramSettings.dat>" << std::endl;
   std::cout << "       --scenario= <string name of scenario>" << std::endl;
   std::cout << "       --verbose= <yes|no : verbose output of object results in csv>" << std::endl;
+  std::cout << "       --regions= --links= --technologies= --years= <size of the scenario written to folder --scenario= by mode generate>" << std::endl;
+  std::cout << "       --evaluations= <number of fitness evaluations of mode benchmark>" << std::endl;
+}
+
+unsigned int CmdParameters::ParseCount(const std::string& parameter, const std::string& value) const {
+  try {
+    auto count = std::stoi(value);
+    if (count >= 0)
+      return static_cast<unsigned int>(count);
+  } catch (const std::exception& e) {
+    // error below
+  }
+  std::cerr << "ERROR in cmd_parameters: Value given for '" << parameter << "' is no valid count: " << value << std::endl;
+  std::terminate();
+  return 0; // dummy return
 }
 
 } /* namespace genesys */
@@ -56,9 +56,18 @@ public:
 	const std::string& getProgramSettingsFile() const { return (program_settings_file_);}
 	static int availableThreads() {return (threads_);}
 	static bool verbose_output() {return verbose_output_;}
+	/** \name Sizes of --mode=generate and --mode=benchmark*/
+	///@{
+	static unsigned int generator_regions() {return generator_regions_;}
+	static unsigned int generator_links() {return generator_links_;}
+	static unsigned int generator_technologies() {return generator_technologies_;}
+	static unsigned int generator_years() {return generator_years_;}
+	static unsigned int benchmark_evaluations() {return benchmark_evaluations_;}
+	///@}
 
 private:
   void printusage(const char *prog) const;
+  unsigned int ParseCount(const std::string& parameter, const std::string& value) const;
 	std::string program_settings_file_;
 	static std::string mode_ ;
 	static std::string output_filename_;
@@ -66,6 +75,11 @@ private:
 	static std::string scenario_name_;
 	static int threads_;
 	static bool verbose_output_;
+	static unsigned int generator_regions_;
+	static unsigned int generator_links_;
+	static unsigned int generator_technologies_;
+	static unsigned int generator_years_;
+	static unsigned int benchmark_evaluations_;
 
 };
 
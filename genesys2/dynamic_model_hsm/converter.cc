@@ -50,6 +50,22 @@ void Converter::ResetSequencedConverter() {
   co2_price_per_unit_current_tp_ = std::numeric_limits<double>::infinity();
 }
 
+void Converter::ResetParametrisedConverter() {
+  //dynamic information of the converter, the installation is reset by resetParametrisedSysComponent
+  is_starting_ = false;
+  is_rampingdown_ = false;
+  price_per_unit_current_tp_ = std::numeric_limits<double>::infinity();
+  co2_price_per_unit_current_tp_ = std::numeric_limits<double>::infinity();
+  used_co2_emissions_.clear();
+  losses_.clear();
+}
+
+void Converter::MergeOperationConverter(const Converter& other) {
+  mergeOperationSysComponent(other);
+  used_co2_emissions_.add_series(other.used_co2_emissions_);
+  losses_.add_series(other.losses_);
+}
+
 void Converter::check_for_decommission(){
   if(!active_current_year() ){
     //DEBUG
@@ -75,9 +91,9 @@ void Converter::connectStorage(std::shared_ptr<dm_hsm::Storage> storage_ptr) {
   //std::cout << "\tDEBUG FUNC-ID: DynamicModel::Converter::connectStorage" << std::endl;
   if (storage_connected_)
     std::cerr << "\t***WARNING this converter is already connected to a storage - switching ptrs now!" << std::endl;
-  storageptr_ = storage_ptr;
-  if (storageptr_.expired()) {
-    std::cerr << "ERROR in Converter::connectStorage - storageptr_ expired in " << code() << std::endl;
+  storage_ = storage_ptr.get();
+  if (!storage_) {
+    std::cerr << "ERROR in Converter::connectStorage - no storage given in " << code() << std::endl;
     std::terminate();
   } else {
     storage_connected_ = true; //this should be the only function that modifies the bool to true!
@@ -87,9 +103,9 @@ void Converter::connectStorage(std::shared_ptr<dm_hsm::Storage> storage_ptr) {
 void Converter::connectPrimaryEnergy(std::shared_ptr<dm_hsm::PrimaryEnergy> primenergy_ptr) {
   if (primary_energy_connected_)
     std::cerr << "\t***WARNING this converter is already connected to a primary energy - switching ptrs now!" << std::endl;
-  primenergyptr_ = primenergy_ptr;
-  if (primenergyptr_.expired()) {
-    std::cerr << "ERROR in Converter::connectPrimaryEnergy - primenergyptr_ expired in " << code() << std::endl;
+  primenergy_ = primenergy_ptr.get();
+  if (!primenergy_) {
+    std::cerr << "ERROR in Converter::connectPrimaryEnergy - no primary energy given in " << code() << std::endl;
     std::terminate();
   } else {
     primary_energy_connected_ = true;//this should be the only function that modifies the bool to true!
@@ -104,21 +120,22 @@ bool Converter::connectCo2Reservoir(std::shared_ptr<dm_hsm::PrimaryEnergy>) {
   return false;
 }
 
-double Converter::generation_fromPotential(const aux::SimulationClock& clock){
+void Converter::generation_fromPotential(aux::SimulationClock::time_point tp_start,
+                                         aux::SimulationClock::duration tick_length,
+                                         std::vector<double>& generation) {
+  //fills generation for generation.size() ticks from tp_start on
   if (hsm_category_ == dm_hsm::HSMCategory::RE_GENERATOR) {
 	  //RE_GENERATOR does not use the active_current_year_-flag, OaM cost are added every year!
-    double re_generation = capacity(clock.now()) * primenergyptr_.lock()->potential(clock.now(), capacity(clock.now()) );
-	//  std::cout << "RE Generator\t" << code() << " generating\t" << re_generation << std::endl;
-	//  std::cout << "	\t capacity         \t" << capacity(clock.now()) << std::endl;
-	//  std::cout << "	\t potential - mean?\t" << primenergyptr_.lock()->potential(clock.now())<< std::endl;
-	//  std::cout << "	\t potential - look \t" << primenergyptr_.lock()->potential(clock.now(), capacity(clock.now()))<< std::endl;
-    add_used_capacity(clock, re_generation);
-    return (re_generation);
+    std::vector<double> capacities(generation.size());
+    get_capacity_().sample(tp_start, tick_length, capacities.size(), capacities.data());
+    primenergy_->potential(tp_start, tick_length, capacities.size(), capacities.data(), generation.data());
+    for (std::size_t i = 0; i < generation.size(); ++i)
+      generation[i] *= capacities[i];//generation = capacity * ts_generation_potential
+    add_used_capacity(tp_start, tick_length, generation);
   } else {
     std::cerr << "ERROR in Converter::getGeneration - no behaviour defined for this category: "
               << static_cast<int>(hsm_category_) << std::endl;
     std::terminate();
-    return 0.0; // dummy return
   }
 }
 
@@ -133,19 +150,19 @@ bool Converter::useConverterOutput(const aux::SimulationClock& clock,
     std::cout << "output_request = " << output_request << " > " << reserved_capacity_tp() << " reserved capacity_tp " << std::endl;
     std::terminate();
   }
-  if(!storageptr_.expired()){
+  if(storage_){
     double DchgInputFromStorage = output_request / efficiency(clock.now(), output_request);
     //std::cout << "\t| DchgInputFromStorage=\t" << DchgInputFromStorage << " Gw"<< std::endl;
     double EDchg = aux::SimulationClock::p2e(DchgInputFromStorage, clock.tick_length());
     //std::cout << "\t| EDchg               =\t" << EDchg << " Gwh"<< std::endl;
-    if (storageptr_.lock()->useCapacityDischarge(EDchg, clock) ) {
+    if (storage_->useCapacityDischarge(EDchg, clock) ) {
       return SysComponentActive::useCapacity(output_request, clock);
     }
-  } else if (!primenergyptr_.expired()) {
+  } else if (primenergy_) {
     std::cerr << "ERROR Converter::useConverterOutput:  not implemented for use of PrimaryEnergy with storage Converter" << std::endl;
     std::terminate();
   } else {
-    std::cerr << "ERROR in Converter::useConverterOutput - storageptr_ has expired!" << std::endl;
+    std::cerr << "ERROR in Converter::useConverterOutput - no storage connected!" << std::endl;
     std::terminate();
   }
   return false;
@@ -158,25 +175,25 @@ double Converter::reserveDischarger(const aux::SimulationClock& clock,
       std::cerr << "ERROR in Converter::reserveDischarger with negative request= " << output_request << std::endl;
       std::terminate();
     } else if (output_request < genesys::ProgramSettings::approx_epsilon()           //CASE small request
-            || capacity(clock.now()) < genesys::ProgramSettings::approx_epsilon()) { //CASE converter pwr too small
+            || capacity_tp(clock) < genesys::ProgramSettings::approx_epsilon()) { //CASE converter pwr too small
       // std::cout << "Converter::usable_power_out_tp has requestedPower very small! " << output_request<< std::endl;
       return 0.;//premature termination
     }
     double rval_reserved_output = 0.0;
     //implicit  if ((hsm_category_ == dm_hsm::HSMCategory::LT_STORAGE) || (hsm_category_ == dm_hsm::HSMCategory::ST_STORAGE)) {
-    if (!storageptr_.expired()) {
+    if (storage_) {
       //Discharger Power
       double maxDchgPwrConv = std::min(usable_capacity_el(clock), output_request);
       //reduce power to output
       double DchgInputFromStorage = maxDchgPwrConv / efficiency(clock.now(), maxDchgPwrConv);
       double EDchg = aux::SimulationClock::p2e(DchgInputFromStorage, clock.tick_length());
-      double maxEDchgStorage = storageptr_.lock()->getCapacityDischarge(EDchg, clock);
+      double maxEDchgStorage = storage_->getCapacityDischarge(EDchg, clock);
       //std::cout << "\t| maxDchgPwrConv=\t" << maxDchgPwrConv << " Gw"<< std::endl;
       //std::cout << "\t| DchgInputFromStorage=\t" << DchgInputFromStorage << " Gw"<< std::endl;
       //std::cout << "\t| EDchg=\t" << EDchg << " Gwh"<< std::endl;
       //std::cout << "\t| maxEDchgStorage=\t" << maxEDchgStorage << " Gwh"<< std::endl;
       if (maxEDchgStorage > genesys::ProgramSettings::approx_epsilon()) {
-        if (storageptr_.lock()->reserveCapacityDischarge(maxEDchgStorage, clock)) {
+        if (storage_->reserveCapacityDischarge(maxEDchgStorage, clock)) {
           rval_reserved_output = aux::SimulationClock::e2p(maxEDchgStorage, clock.tick_length());
           //reduce to the el_output side
           rval_reserved_output = rval_reserved_output * efficiency(clock.now(), rval_reserved_output);
@@ -191,7 +208,7 @@ double Converter::reserveDischarger(const aux::SimulationClock& clock,
         return 0.; // storage does not allow discharge!
       }
     } else {
-      std::cerr << "ERROR in Converter::reserveDischarger - storageptr_ has expired!" << std::endl;
+      std::cerr << "ERROR in Converter::reserveDischarger - no storage connected!" << std::endl;
       std::terminate();
     }
     return 0.;
@@ -252,16 +269,16 @@ double Converter::reserveChargerInput( const aux::SimulationClock& clock,
   //std::cout << "\tFUNC-ID: Converter::reserveChargerInput with inputRequest= " << inRequestEl << std::endl;
   double reservableInputPwr = 0.0;
   //implicit  if ((hsm_category_ == dm_hsm::HSMCategory::LT_STORAGE) || (hsm_category_ == dm_hsm::HSMCategory::ST_STORAGE)) {
-    if (!storageptr_.expired()) {
+    if (storage_) {
       //Charge Acceptance of the Converter
       double maxAcceptConvPwr = std::min(usable_capacity_el(clock), inRequestEl);
       //reduce power to output
       double maxOutputConv = maxAcceptConvPwr * efficiency(clock.now(), maxAcceptConvPwr);
       //Charge Acceptance of Storage Reservoir
-      double maxAcceptStorageEngy  = storageptr_.lock()->getCapacityCharge(aux::SimulationClock::p2e(maxOutputConv,
+      double maxAcceptStorageEngy  = storage_->getCapacityCharge(aux::SimulationClock::p2e(maxOutputConv,
     		                                                                                         clock.tick_length()), clock);
       if (maxAcceptStorageEngy > genesys::ProgramSettings::approx_epsilon()) {
-        if (storageptr_.lock()->reserveCapacityCharge(clock, maxAcceptStorageEngy)) {
+        if (storage_->reserveCapacityCharge(clock, maxAcceptStorageEngy)) {
           reservableInputPwr = aux::SimulationClock::e2p(maxAcceptStorageEngy, clock.tick_length());
           //expand to the el_input side
           reservableInputPwr = reservableInputPwr / efficiency(clock.now(), reservableInputPwr);
@@ -280,7 +297,7 @@ double Converter::reserveChargerInput( const aux::SimulationClock& clock,
       }
 
   } else {
-    std::cout << "\t***WARNING: Storage ptr expired! --- Could not acceess Converter or Storage" << code() << std::endl;
+    std::cout << "\t***WARNING: no storage connected! --- Could not acceess Converter or Storage" << code() << std::endl;
     return 0.;
   }
   return -1.;
@@ -295,7 +312,7 @@ bool Converter::useChargeStorage(double inputPower,
     //std::cout << "\t| accepted reserved capacity sufficient in converter " << code() << std::endl;
     //reduce input (electrical energy) with efficiency
     double Energy_To_Storage = aux::SimulationClock::p2e(inputPower*efficiency(clock.now(), inputPower), clock.tick_length());
-    if(storageptr_.lock()->useCapacityCharge(Energy_To_Storage, clock)) {
+    if(storage_->useCapacityCharge(Energy_To_Storage, clock)) {
       useSucceded = useCapacity(inputPower, clock, true);
     }
   } else {
@@ -308,7 +325,7 @@ bool Converter::useChargeStorage(double inputPower,
 }
 //  if ((std::abs(inputPower - reserved_capacity_tp())) < genesys::ProgramSettings::approx_epsilon()) {
 //    // change charge in storage -> transform inputPower 2 Energy (inflated by efficiency)
-//    if (storageptr_.lock()->useCapacityCharge(aux::SimulationClock::p2e(inputPower/efficiency(clock.now()), clock.tick_length()), clock)){
+//    if (storage_->useCapacityCharge(aux::SimulationClock::p2e(inputPower/efficiency(clock.now()), clock.tick_length()), clock)){
 //      //todo use negative power for charging of storage!!!
 //      useSucceded = useCapacity(inputPower, clock, true);
 //    }
@@ -324,12 +341,12 @@ bool Converter::useChargeStorage(double inputPower,
 
 double Converter::get_efficiency(const aux::SimulationClock& clock) const {
   //  std::cout << "FUNC-ID: Converter::getEfficiencyMaxPower" << std::endl;
-  return efficiency(clock.now());
+  return efficiency_tp(clock);
 }
 
 double Converter::get_capacity (const aux::SimulationClock& clock) const {
   //  std::cout << "FUNC-ID: Converter::getEfficiencyMaxPower" << std::endl;
-  return capacity(clock.now());
+  return capacity_tp(clock);
 }
 
 } /* namespace dm_hsm */
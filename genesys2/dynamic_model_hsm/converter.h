@@ -33,6 +33,7 @@
 #define DYNAMIC_MODEL_HSM__CONVERTER_H_
 
 #include <memory>
+#include <vector>
 
 #include <auxiliaries/time_tools.h>
 #include <dynamic_model_hsm/hsm_category.h>
@@ -47,7 +48,7 @@ class Converter : public virtual sm::Converter, public virtual SysComponentActiv
  public:
   Converter() = delete;
   virtual ~Converter() = default;
-  Converter(const Converter& other)  // correct handling of weak pointer members not possible in this context
+  Converter(const Converter& other)  // the connections are not copied, they are resolved again by the owner
       : builder::SysCompActPrototype(other), // virtual inheritance and deleted default c'tor
         builder::ConverterPrototype(other), // virtual inheritance and deleted default c'tor
         am::SysComponentActive(other), // virtual inheritance and deleted default c'tor
@@ -55,15 +56,30 @@ class Converter : public virtual sm::Converter, public virtual SysComponentActiv
         sm::SysComponentActive(other), // virtual inheritance and deleted default c'tor
         sm::Converter(other),
         SysComponentActive(other),
-        primenergyptr_(), //no ptr in copy
-        storageptr_(),//no ptr in copy
+        primenergy_(nullptr), //no ptr in copy
+        storage_(nullptr),//no ptr in copy
         hsm_category_(other.hsm_category_),
         hsm_sub_category_(other.hsm_sub_category_),
         storage_connected_(other.storage_connected_),
         primary_energy_connected_(other.primary_energy_connected_),
         used_co2_emissions_(other.used_co2_emissions_),
         losses_(other.losses_) {}
-  Converter(Converter&&) = delete; // maybe also ok as default, but consider again weak pointer members before!
+  Converter(Converter&& other)  // the connections are dropped as in the copy c'tor
+      : builder::SysCompActPrototype(other), // virtual inheritance and deleted default c'tor
+        builder::ConverterPrototype(other), // virtual inheritance and deleted default c'tor
+        am::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+        am::Converter(other), // virtual inheritance and deleted default c'tor
+        sm::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+        sm::Converter(other),
+        SysComponentActive(std::move(other)),
+        primenergy_(nullptr), //no ptr in move
+        storage_(nullptr),//no ptr in move
+        hsm_category_(other.hsm_category_),
+        hsm_sub_category_(other.hsm_sub_category_),
+        storage_connected_(other.storage_connected_),
+        primary_energy_connected_(other.primary_energy_connected_),
+        used_co2_emissions_(std::move(other.used_co2_emissions_)),
+        losses_(std::move(other.losses_)) {}
   Converter& operator=(const Converter&) = delete;
   Converter& operator=(Converter&&) = delete;
   Converter(const sm::Converter& origin)
@@ -74,8 +90,8 @@ class Converter : public virtual sm::Converter, public virtual SysComponentActiv
         sm::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
         sm::Converter(origin),
         SysComponentActive(origin),
-        primenergyptr_(),
-        storageptr_(),
+        primenergy_(nullptr),
+        storage_(nullptr),
         hsm_category_(),
         hsm_sub_category_(dm_hsm::HSMSubCategory::UNAVAILABLE),
         storage_connected_(false),
@@ -104,11 +120,15 @@ class Converter : public virtual sm::Converter, public virtual SysComponentActiv
   /** \name Reset Functions.*/
   ///@{
     void ResetSequencedConverter();
+    void ResetParametrisedConverter();
+    void MergeOperationConverter(const Converter& other);
   ///@}
 
   /** \name Hierarchical Operation Functions.*/
   ///@{
-    double generation_fromPotential(const aux::SimulationClock& clock);
+    void generation_fromPotential(aux::SimulationClock::time_point tp_start,
+                                  aux::SimulationClock::duration tick_length,
+                                  std::vector<double>& generation);
     //DEPRECATED
     virtual double usable_power_out_tp(const aux::SimulationClock& clock, const double requestPower);
     /* Heat Integrationsversuch: kja
@@ -148,10 +168,12 @@ class Converter : public virtual sm::Converter, public virtual SysComponentActiv
   ///@}
 
  protected:
-  std::weak_ptr<PrimaryEnergy> primenergyptr() const {return primenergyptr_.lock();}
+  PrimaryEnergy* primenergy() const {return primenergy_;}
   double losses( aux::SimulationClock::time_point tp) const { std::cout << "losses " << std::endl; return losses_[tp];}
-  void set_losses(aux::TimeSeriesConstAddable TSA) {losses_+=TSA;}
-  void set_co2_emissions(const aux::TimeSeriesConstAddable& TSA) {used_co2_emissions_+=TSA;}
+  void set_losses(const double value, const aux::SimulationClock& clock)
+                  {losses_.add_pulse(value, clock.now(), clock.tick_length());}
+  void set_co2_emissions(const double value, const aux::SimulationClock& clock)
+                        {used_co2_emissions_.add_pulse(value, clock.now(), clock.tick_length());}
 
 
   /** \name Accessors to analysis_hsm*/
@@ -162,8 +184,9 @@ class Converter : public virtual sm::Converter, public virtual SysComponentActiv
 
  private:
 
-  std::weak_ptr<PrimaryEnergy> primenergyptr_;
-  std::weak_ptr<Storage> storageptr_;
+  //owned by the region or global, resolved once by connectPrimaryEnergy/connectStorage
+  PrimaryEnergy* primenergy_;
+  Storage* storage_;
 
   dm_hsm::HSMCategory hsm_category_;
   dm_hsm::HSMSubCategory hsm_sub_category_ = dm_hsm::HSMSubCategory::UNAVAILABLE;
@@ -174,8 +197,8 @@ class Converter : public virtual sm::Converter, public virtual SysComponentActiv
   bool is_rampingdown_ = false;
   double price_per_unit_current_tp_ = std::numeric_limits<double>::infinity();
   double co2_price_per_unit_current_tp_ = std::numeric_limits<double>::infinity();
-  aux::TimeSeriesConstAddable used_co2_emissions_; ///stores the produced co2 amount in detail
-  aux::TimeSeriesConstAddable losses_;
+  aux::TimeSeriesAccumulator used_co2_emissions_; ///stores the produced co2 amount in detail
+  aux::TimeSeriesAccumulator losses_;
 };
 
 } /* namespace dm_hsm */
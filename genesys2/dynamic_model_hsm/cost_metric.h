@@ -0,0 +1,65 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// cost_metric.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef DYNAMIC_MODEL_HSM_COST_METRIC_H_
+#define DYNAMIC_MODEL_HSM_COST_METRIC_H_
+
+#include <array>
+#include <cstddef>
+
+namespace dm_hsm {
+
+enum class CostMetric { CAPEX, FOPEX, VOPEX, ENERGY };
+
+/**
+ * @brief Sums and discounted values of all CostMetrics, collected in one traversal of the model
+ */
+class CostMetricTotals {
+ public:
+  CostMetricTotals() {sum_.fill(0.); discounted_.fill(0.);}
+
+  double sum(const CostMetric metric) const {return sum_[index(metric)];}
+  double discounted(const CostMetric metric) const {return discounted_[index(metric)];}
+
+  void add_sum(const CostMetric metric, const double value) {sum_[index(metric)] += value;}
+  void add_discounted(const CostMetric metric, const double value) {discounted_[index(metric)] += value;}
+
+ private:
+  static constexpr std::size_t kNumMetrics = 4;
+  static std::size_t index(const CostMetric metric) {return static_cast<std::size_t>(metric);}
+
+  std::array<double, kNumMetrics> sum_;
+  std::array<double, kNumMetrics> discounted_;
+};
+
+} /* namespace dm_hsm */
+
+#endif /* DYNAMIC_MODEL_HSM_COST_METRIC_H_ */
@@ -37,16 +37,44 @@
 #include <algorithm>
 #include <iterator>
 
+#include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
+#include <omp.h>
+
+#include <benchmark/phase_profiler.h>
+
 namespace dm_hsm {
 
+#ifdef GENESYS_PROFILE
+namespace {
+const char* balance_phase(bool local, const dm_hsm::HSMCategory& cat) {
+  switch (cat) {
+    case HSMCategory::CONV_MUSTRUN:
+      return "balance_mustrun";
+    case HSMCategory::RE_GENERATOR:
+      return local ? "balance_local_RE_GENERATOR" : "balance_grid_RE_GENERATOR";
+    case HSMCategory::ST_STORAGE:
+      return local ? "balance_local_ST_STORAGE" : "balance_grid_ST_STORAGE";
+    case HSMCategory::LT_STORAGE:
+      return local ? "balance_local_LT_STORAGE" : "balance_grid_LT_STORAGE";
+    case HSMCategory::DISPATCHABLE_GENERATOR:
+      return local ? "balance_local_DISPATCHABLE_GENERATOR" : "balance_grid_DISPATCHABLE_GENERATOR";
+    default:
+      return local ? "balance_local_other" : "balance_grid_other";
+  }
+}
+} /* namespace */
+#endif
+
 DynamicModel::DynamicModel(const DynamicModel& other)
      : StaticModel(other),
        region_codes_{},
        link_codes_{},
        annual_electricity_price_(other.annual_electricity_price_){
+  GENESYS_PROFILE_PHASE("model_construction");
   if (!other.regions().empty()) {
       for (const auto& it : other.regions()){
         regions_.emplace(it.first, std::shared_ptr<Region>(new Region(*(it.second))));
@@ -64,12 +92,15 @@ DynamicModel::DynamicModel(const DynamicModel& other)
 	  for (const auto& it : other.global())
          global_.emplace(it.first, std::shared_ptr<Global>(new Global(*(it.second))));
   }
+  index_components();
+  setupBalanceSchedule();
 }
 
 DynamicModel::DynamicModel(const sm::StaticModel& origin)
     : sm::StaticModel(origin),
       annual_electricity_price_(),
       annual_unsupplied_total_(){
+  GENESYS_PROFILE_PHASE("model_construction");
   if (!sm::StaticModel::regions().empty()) {
       for (const auto& it : StaticModel::regions()) {
         regions_.emplace(it.first, std::shared_ptr<Region>(new Region(*(it.second))));
@@ -79,7 +110,7 @@ DynamicModel::DynamicModel(const sm::StaticModel& origin)
   if (!sm::StaticModel::links().empty()) {
       for (const auto& it : StaticModel::links()) {
         auto new_link_ptr = std::shared_ptr<Link>(new Link(*(it.second), regions()));
-        new_link_ptr->RegisterWithRegions(new_link_ptr);
+        new_link_ptr->RegisterWithRegions();
         links_.emplace(it.first, new_link_ptr);
         link_codes_.push_back(it.first);
       }
@@ -125,6 +156,100 @@ DynamicModel::DynamicModel(const sm::StaticModel& origin)
 		  }
 	  }
   }
+  index_components();
+  setupBalanceSchedule();
+}
+
+void DynamicModel::index_components() {
+  //The maps own the regions, links and globals and serve the lookups by code, the loops per tp run over these
+  //views in map order. The maps are only filled in the c'tors, the pointers stay valid when the model is moved.
+  region_index_.clear();
+  for (const auto& it : regions_)
+    region_index_.push_back(it.second.get());
+  link_index_.clear();
+  for (const auto& it : links_)
+    link_index_.push_back(it.second.get());
+  global_index_.clear();
+  for (const auto& it : global_)
+    global_index_.push_back(it.second.get());
+  grid_balance_order_.clear();
+  for (const auto& it : region_codes_) {
+    auto search = regions_.find(it);
+    if (search == regions_.end()) {
+      std::cerr << "ERROR in DynamicModel::index_components --> Region code : " << it << " not found" << std::endl;
+      std::terminate();
+    }
+    grid_balance_order_.push_back(search->second.get());
+  }
+}
+
+void DynamicModel::setupBalanceSchedule() {
+  //Regions share state only via links and global reservoirs (CO2 of multi converters).
+  //Local balance: regions without a global reservoir can be balanced concurrently.
+  //Grid balance: balance_start() of a region reaches the region itself, its direct neighbours and the links in
+  //between. Regions whose reach does not overlap form a batch (greedy colouring of the link graph at distance 2),
+  //regions reaching a global reservoir are balanced one by one after all batches.
+  local_parallel_regions_.clear();
+  local_serial_regions_.clear();
+  grid_balance_batches_.clear();
+  std::vector<std::string> sorted_codes(region_codes_);
+  std::sort(sorted_codes.begin(), sorted_codes.end());//deterministic batches independent of map order
+  std::unordered_map<std::string, std::set<std::string> > reach;
+  for (const auto& it : sorted_codes) {
+    reach[it].insert(it);
+  }
+  for (const auto& it : links_) {
+    auto connected = it.second->connected_regions();
+    reach[connected.first].insert(connected.second);
+    reach[connected.second].insert(connected.first);
+  }
+  std::set<std::string> shared_regions;
+  for (const auto& it : sorted_codes) {
+    auto region = regions_.find(it)->second;
+    if (!global_.empty() && region->has_multi_converter()) {
+      shared_regions.insert(it);
+      local_serial_regions_.push_back(region);
+    } else {
+      local_parallel_regions_.push_back(region);
+    }
+  }
+  std::vector<std::set<std::string> > batch_reach;
+  std::vector<std::shared_ptr<Region> > serial_grid_regions;
+  for (const auto& it : sorted_codes) {
+    const auto& region_reach = reach[it];
+    bool reaches_shared = false;
+    for (const auto& r : region_reach) {
+      if (shared_regions.find(r) != shared_regions.end()) {
+        reaches_shared = true;
+        break;
+      }
+    }
+    if (reaches_shared) {
+      serial_grid_regions.push_back(regions_.find(it)->second);
+      continue;
+    }
+    std::size_t batch = 0;
+    for (; batch < batch_reach.size(); ++batch) {
+      bool overlap = false;
+      for (const auto& r : region_reach) {
+        if (batch_reach[batch].find(r) != batch_reach[batch].end()) {
+          overlap = true;
+          break;
+        }
+      }
+      if (!overlap)
+        break;
+    }
+    if (batch == batch_reach.size()) {
+      batch_reach.emplace_back();
+      grid_balance_batches_.emplace_back();
+    }
+    batch_reach[batch].insert(region_reach.begin(), region_reach.end());
+    grid_balance_batches_[batch].push_back(regions_.find(it)->second);
+  }
+  for (const auto& it : serial_grid_regions) {
+    grid_balance_batches_.push_back(std::vector<std::shared_ptr<Region> >{it});
+  }
 }
 
 double DynamicModel::getDiscountedValue(std::string query,
@@ -182,8 +307,24 @@ double DynamicModel::getSumValue(std::string query,
   return (sum_value);
 }
 
+CostMetricTotals DynamicModel::getCostMetricTotals(aux::SimulationClock::time_point start,
+                                                   aux::SimulationClock::time_point end,
+                                                   aux::SimulationClock::time_point discount_present) const {
+  //single traversal of regions and links, replaces getSumValue/getDiscountedValue for CAPEX, FOPEX, VOPEX, ENERGY
+  GENESYS_PROFILE_PHASE("aggregation");
+  CostMetricTotals totals;
+  for (auto&& it : regions_) {
+    it.second->accumulate_cost_metrics(start, end, discount_present, totals);
+  }
+  for (auto&& it : links_) {
+    it.second->accumulate_cost_metrics(start, end, discount_present, totals);
+  }
+  return (totals);
+}
+
 void DynamicModel::calculate_annual_disc_capex(aux::SimulationClock::time_point start,
                                           aux::SimulationClock::time_point end) {
+  GENESYS_PROFILE_PHASE("aggregation");
   auto mystart = start;
   do {
     if (!regions_.empty()) {
@@ -204,6 +345,7 @@ void DynamicModel::calculate_annual_disc_capex(aux::SimulationClock::time_point
 void DynamicModel::calculate_annual_electricity_prices(aux::SimulationClock::time_point start,
                                                        aux::SimulationClock::time_point end) {
   //std::cout << "DynamicModel::calculate_annual_electricity_prices" << std::endl;
+  GENESYS_PROFILE_PHASE("aggregation");
   auto mystart = start;
   do {
     double cost_current_year = 0.;
@@ -228,7 +370,7 @@ void DynamicModel::calculate_annual_electricity_prices(aux::SimulationClock::tim
       lcoe_current_year = cost_current_year / discounted_energy_current_year;
     }
     //std::cout << " | LCOE = " << lcoe_current_year << " | DISC_ENERGY = " << discounted_energy_current_year << std::endl;
-    annual_electricity_price_ += aux::TimeSeriesConst(std::vector<double>{lcoe_current_year, 0.}, mystart, aux::years(1));
+    annual_electricity_price_.add_pulse(lcoe_current_year, mystart, aux::years(1));
     mystart += aux::years(1);
   } while (mystart < end);
 }
@@ -257,42 +399,183 @@ void DynamicModel::CalculateResidualLoad(dm_hsm::HSMCategory hsm_cat,
 //  //annual_unsupplied_total_ =
 //}
 
-void DynamicModel::resetSequencedModel(const aux::SimulationClock& clock){
+void DynamicModel::resetSequencedModel(const aux::SimulationClock& clock,
+                                       aux::SimulationClock::time_point tp_end_seq){
   //std::cout << "FUNC-ID: DynamicModel::resetSequencedModel()" << std::endl;
   //Reset all values to standard
   for (auto &it : regions_){
-    it.second->resetSequencedRegion(clock);
+    it.second->resetSequencedRegion(clock, tp_end_seq);
   }
   for (auto &it : links_){
 	  it.second->resetSequencedLink(clock);
   }
   for (auto &it : global_) {
-    it.second->resetSequencedGlobal(clock);
+    it.second->resetSequencedGlobal(clock, tp_end_seq);
+  }
+}
+
+void DynamicModel::resetParametrisedModel(const std::unordered_map<std::string,
+                                                                    std::unordered_map<std::string,
+                                                                                       std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                                       aux::SimulationClock::time_point,
+                                                                                       aux::SimulationClock::time_point,
+                                                                                       aux::SimulationClock::duration>
+                                                                                       >
+                                                                    >& installations) {
+  //std::cout << "FUNC-ID: DynamicModel::resetParametrisedModel()" << std::endl;
+  //Restores the state after construction with new installations, without rebuilding the model structure
+  //the installations are only referenced, every entry has to match a region, link or global
+  std::unordered_set<std::string> applied_installations; //each entry is applied once, as by erasing it
+  for (auto& it : regions_) {
+    auto region_pos = installations.find(it.first);
+    if (region_pos != installations.end() && applied_installations.insert(it.first).second) {
+      it.second->resetParametrisedRegion(region_pos->second);
+    } else {
+      it.second->resetParametrisedRegion({});
+    }
+  }
+  for (auto& it : links_) {
+    auto link_pos = installations.find(it.first);
+    if (link_pos != installations.end() && applied_installations.insert(it.first).second) {
+      it.second->resetParametrisedLink(link_pos->second);
+    } else {
+      it.second->resetParametrisedLink({});
+    }
+  }
+  for (auto& it : global_) {
+    auto glob_pos = installations.find(it.first);
+    if (glob_pos != installations.end() && applied_installations.insert(it.first).second) {
+      it.second->resetParametrisedGlobal(glob_pos->second);
+    } else {
+      it.second->resetParametrisedGlobal({});
+    }
+  }
+  if (applied_installations.size() != installations.size()) {
+    std::cerr << "ERROR in DynamicModel::resetParametrisedModel : installation list contained invalid entries" << std::endl;
+    for (auto& it : installations) {
+      if (applied_installations.count(it.first) == 0)
+        std::cout << "\t" << it.first << std::endl;
+    }
+    std::terminate();
+  }
+  annual_electricity_price_.clear();
+  annual_unsupplied_total_.clear();
+}
+
+void DynamicModel::resetOperationModel() {
+  //std::cout << "FUNC-ID: DynamicModel::resetOperationModel()" << std::endl;
+  //Restores the state after resetParametrisedModel, keeping the current installations
+  for (auto& it : regions_) {
+    it.second->resetOperationRegion();
+  }
+  for (auto& it : links_) {
+    it.second->resetOperationLink();
+  }
+  for (auto& it : global_) {
+    it.second->resetOperationGlobal();
+  }
+  annual_electricity_price_.clear();
+  annual_unsupplied_total_.clear();
+}
+
+void DynamicModel::mergeOperationResults(const DynamicModel& other) {
+  //std::cout << "FUNC-ID: DynamicModel::mergeOperationResults()" << std::endl;
+  //adds the values kept between sequences of a model with identical structure, operated on a different time window
+  for (auto& it : regions_) {
+    auto other_pos = other.regions_.find(it.first);
+    if (other_pos == other.regions_.end()) {
+      std::cerr << "ERROR in DynamicModel::mergeOperationResults : region " << it.first << " not found" << std::endl;
+      std::terminate();
+    }
+    it.second->mergeOperationRegion(*other_pos->second);
+  }
+  for (auto& it : links_) {
+    auto other_pos = other.links_.find(it.first);
+    if (other_pos == other.links_.end()) {
+      std::cerr << "ERROR in DynamicModel::mergeOperationResults : link " << it.first << " not found" << std::endl;
+      std::terminate();
+    }
+    it.second->mergeOperationLink(*other_pos->second);
+  }
+  for (auto& it : global_) {
+    auto other_pos = other.global_.find(it.first);
+    if (other_pos == other.global_.end()) {
+      std::cerr << "ERROR in DynamicModel::mergeOperationResults : global " << it.first << " not found" << std::endl;
+      std::terminate();
+    }
+    it.second->mergeOperationGlobal(*other_pos->second);
+  }
+  annual_unsupplied_total_.add_series(other.annual_unsupplied_total_);
+}
+
+std::unordered_map<std::string, double> DynamicModel::getStoredEnergyTransfer() const {
+  //SOC of all storages at the end of the last solved sequence, keyed by <region or global>.<storage>
+  std::unordered_map<std::string, double> transfer;
+  for (const auto& it : regions_) {
+    it.second->get_stored_energy_transfer(transfer);
+  }
+  for (const auto& it : global_) {
+    it.second->get_stored_energy_transfer(transfer);
+  }
+  return transfer;
+}
+
+std::unordered_map<std::string, double> DynamicModel::getInitialStoredEnergy(aux::SimulationClock::time_point tp) const {
+  //SOC of all storages if a sequence starting at tp is solved without transfer from a prior sequence
+  std::unordered_map<std::string, double> initial;
+  for (const auto& it : regions_) {
+    it.second->get_initial_stored_energy(tp, initial);
+  }
+  for (const auto& it : global_) {
+    it.second->get_initial_stored_energy(tp, initial);
+  }
+  return initial;
+}
+
+void DynamicModel::setStoredEnergyTransfer(const std::unordered_map<std::string, double>& transfer) {
+  for (auto& it : regions_) {
+    it.second->set_stored_energy_transfer(transfer);
+  }
+  for (auto& it : global_) {
+    it.second->set_stored_energy_transfer(transfer);
   }
 }
 
 void DynamicModel::resetCurrentTP(const aux::SimulationClock& clock){
   //DEBUG std::cout << "FUNC-ID: DynamicModel::resetCurrentTP()"<<std::endl;
     //reset transported energy for regions
-  if(!regions_.empty()){
-    for (auto& it : regions_){
-       it.second->resetCurrentTP(clock);
+  if(!region_index_.empty()){
+    for (auto region : region_index_){
+       region->resetCurrentTP(clock);
     }
   } else {
     std::cerr <<"ERROR: DynamicModel::resetCurrentTP -> regions_ is empty!" << std::endl;
     std::terminate();
   }
-  if(!links_.empty()){
-    for (auto& it : links_){
-       it.second->resetCurrentTP(clock);
-    }
-  } else {
-    //std::cerr <<"***WARNING: DynamicModel::resetCurrentTP -> links_ is empty!" << std::endl;
-  }
-  if(!global_.empty()) {
-	  for (auto& it : global_)
-		  it.second->resetCurrentTP(clock);
-  }
+  for (auto link : link_index_)
+    link->resetCurrentTP(clock);
+  for (auto global : global_index_)
+    global->resetCurrentTP(clock);
+}
+
+void DynamicModel::lowerKernel(aux::SimulationClock::time_point tp_start,
+                               aux::SimulationClock::time_point tp_end,
+                               aux::SimulationClock::duration tick_length) {
+  for (auto region : region_index_)
+    region->lowerKernel(tp_start, tp_end, tick_length);
+  for (auto link : link_index_)
+    link->lowerKernel(tp_start, tp_end, tick_length);
+  for (auto global : global_index_)
+    global->lowerKernel(tp_start, tp_end, tick_length);
+}
+
+void DynamicModel::writeBackKernel() {
+  for (auto region : region_index_)
+    region->writeBackKernel();
+  for (auto link : link_index_)
+    link->writeBackKernel();
+  for (auto global : global_index_)
+    global->writeBackKernel();
 }
 
 void DynamicModel::decommission_plants(){
@@ -304,30 +587,18 @@ void DynamicModel::decommission_plants(){
 }
 
 void DynamicModel::uncheck_active_current_year(){
-	if (!regions_.empty()){
-	    for (const auto& it : regions_){
-	      it.second->uncheck_active_current_year();
-	    }
-	  }
-	if (!links_.empty()){
-	    for (const auto& it : links_){
-	      it.second->uncheck_active_current_year();
-	    }
-	  }
+	for (auto region : region_index_)
+	  region->uncheck_active_current_year();
+	for (auto link : link_index_)
+	  link->uncheck_active_current_year();
 }
 
 void DynamicModel::add_OaM_cost(aux::SimulationClock::time_point tp) {
 	//	std::cout << "FUNC-ID: DynamicModel::add_OaM_cost at tp_now " << aux::SimulationClock::time_point_to_string(tp)  << " for precceeding year. " << std::endl;
-  if (!regions_.empty()) {
-	  for (const auto& it : regions_) {
-		  it.second->add_OaM_cost(tp);
-	  }
-  }
-  if (!links_.empty()) {
-    for (const auto& it : links_) {
-      it.second->add_OaM_cost(tp);
-    }
-  }
+  for (auto region : region_index_)
+    region->add_OaM_cost(tp);
+  for (auto link : link_index_)
+    link->add_OaM_cost(tp);
 }
 
 void DynamicModel::activate_mustrun(const aux::SimulationClock& sim_clock){
@@ -351,38 +622,58 @@ void DynamicModel::generalised_balance(bool local,
   */
 
   //DEBUG std::cout << "FUNC-ID: DynamicModel::generalised_balance() with HSMCategory= "<< static_cast<int>(hsm_cat) << " | local = " << local<< std::endl;
+  GENESYS_PROFILE_PHASE(balance_phase(local, hsm_cat));
   if (hsm_cat == dm_hsm::HSMCategory::CONV_MUSTRUN) {
-    for (auto& it : regions_){
-        //std::cout << "activate_mustrun in region " << it.first << std::endl;
-        it.second->activate_mustrun(clock);
+    //regions are independent here, see setupBalanceSchedule()
+    #pragma omp parallel for schedule(dynamic) if(!omp_in_parallel())
+    for (std::size_t i = 0; i < local_parallel_regions_.size(); ++i){
+        //std::cout << "activate_mustrun in region " << local_parallel_regions_[i]->code() << std::endl;
+        local_parallel_regions_[i]->activate_mustrun(clock);
+    }
+    for (auto& it : local_serial_regions_){
+        it->activate_mustrun(clock);
     }
   } else if (local) {
-    for (auto& it : regions_){
-      it.second->generalised_balance_local(hsm_cat, clock);
+    #pragma omp parallel for schedule(dynamic) if(!omp_in_parallel())
+    for (std::size_t i = 0; i < local_parallel_regions_.size(); ++i){
+      local_parallel_regions_[i]->generalised_balance_local(hsm_cat, clock);
+    }
+    for (auto& it : local_serial_regions_){
+      it->generalised_balance_local(hsm_cat, clock);
     }
   } else if (!local){
     int max_hops = genesys::ProgramSettings::gridbalance_hop_level();
     if ( 0  <= max_hops ) {//otherwise skip grid balanc if negative!
       //std::cout << "DEBUG: Execution of grid-balance: max_hops: " << max_hops << std::endl;
+      //every region proposes its usable lines once per tp on the first balance() call, see Region::proposeGridLines()
+      const bool parallel_batches = genesys::ProgramSettings::parallel_grid_balance()
+                                    && !genesys::ProgramSettings::use_randomisation();
+      if (parallel_batches) {
+        //the batches may reach the same neighbour over several hops, so they only read the proposed lines
+        for (auto region : region_index_)
+          region->proposeGridLines(clock);
+      }
       int current_hops = 0;//0 = direct neighbours to start with
       do {
-
+        if (parallel_batches) {
+          //conflict free batches in fixed order, results do not depend on the number of threads
+          for (const auto& batch : grid_balance_batches_) {
+            #pragma omp parallel for schedule(dynamic) if(batch.size() > 1 && !omp_in_parallel())
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+              batch[i]->balance_start(current_hops, hsm_cat, clock);
+            }
+          }
+          ++current_hops;
+          continue;
+        }
         if (genesys::ProgramSettings::use_randomisation()){
           //random balance one region first!
           std::random_device rd;
           std::mt19937_64 g(rd());
-          std::shuffle(region_codes_.begin(), region_codes_.end(), g); //lookup vector
+          std::shuffle(grid_balance_order_.begin(), grid_balance_order_.end(), g); //lookup vector
         }
-        for (auto& it : region_codes_){
-          auto search = regions_.find(it);
-          if(search != regions_.end()) {
-              //std::cout << "\t found " << search->first << std::endl;
-              search->second->balance_start(current_hops, hsm_cat, clock);
-          }
-          else {
-              std::cerr << "ERROR in DynamicModel::generalised_balance --> Region code : " << it << " not found" << std::endl;
-              std::terminate();
-          }
+        for (auto region : grid_balance_order_){
+          region->balance_start(current_hops, hsm_cat, clock);
         }
         //DEPRECATED: loop through map has always same order
         //        for (auto& it : regions_){//iterate all regions for the current hop level
@@ -403,8 +694,8 @@ void DynamicModel::generalised_balance(bool local,
 }
 
 void DynamicModel::save_unsupplied_load (const aux::SimulationClock& clock) {
-  for (auto& it : regions_){
-    it.second->save_unsupplied_load(clock);
+  for (auto region : region_index_){
+    region->save_unsupplied_load(clock);
   }
   //unsupplied +=
   // double unsupplied = 0.0;
@@ -417,34 +708,36 @@ double DynamicModel::calculate_unsupplied_load(){
   for (auto& it : regions_){
     auto usLoad = it.second->get_remaining_residual_load_();
 
-    //Build clock
-    aux::SimulationClock clock(genesys::ProgramSettings::simulation_start(), genesys::ProgramSettings::simulation_step_length());
-    aux::SimulationClock::time_point tp_end = genesys::ProgramSettings::simulation_end();
-    int current_year = clock.year();
-    int start_year = current_year;
-    aux::SimulationClock::time_point tp_start_tmp = genesys::ProgramSettings::simulation_start();
-    do {
-      if (clock.year() - current_year != 0 ||  //or last year end of simulation
-          clock.now() + aux::minutes(genesys::ProgramSettings::simulation_step_length()) > tp_end) { // tp_end is not exactly reached therefore check if clock exceeds
-        auto step = aux::minutes(genesys::ProgramSettings::simulation_step_length());
-        auto tp_justbefore_now = clock.now()- step;
-        double current_year_usLoad = aux::sum_positiveValues(it.second->get_remaining_residual_load_(),
-                                                             tp_start_tmp, tp_justbefore_now,
-                                                             genesys::ProgramSettings::simulation_step_length());
-        annual_unsupplied_total_ += aux::TimeSeriesConst(std::vector<double>{current_year_usLoad,0.0},
-                                                         tp_start_tmp,
-                                                         aux::years(1));
-        it.second->set_annual_unsupplied(current_year_usLoad, tp_start_tmp);
-        double factor = std::pow((1+genesys::ProgramSettings::interest_rate()), (current_year - start_year));
-        //unsupplied of later years is expanded by factor to accound for lower worth of money in far future when penalty is applied.
-        unsupplied += current_year_usLoad*factor;
-        //DEBUG:
-        //        std::cout << it.first  << " " << aux::SimulationClock::time_point_to_string(tp_start_tmp)
-        //                  << " usLoad = " << current_year_usLoad << " GWh" << std::endl;
-        tp_start_tmp = clock.now() ;
-        current_year = clock.year();
-      }
-    } while (clock.tick() <= tp_end);
+    //Annual segments from the calendar: a segment ends at the first tick of the next year or at the last tick
+    //at or before the simulation end, both are excluded from the segment
+    const auto& calendar = genesys::ProgramSettings::calendar();
+    auto step = aux::minutes(genesys::ProgramSettings::simulation_step_length());
+    auto last_tick = static_cast<std::size_t>((genesys::ProgramSettings::simulation_end() - calendar.start()) / step);
+    std::size_t segment_begin = 0;
+    std::size_t segment_year = 0; //index of the year in the calendar
+    for (std::size_t k = 1; ; ++k) {
+      bool last_segment = (k >= calendar.size() || calendar.first_tick(k) >= last_tick);
+      auto segment_end = last_segment ? last_tick : calendar.first_tick(k);
+      auto tp_start_tmp = calendar.tick_time(segment_begin);
+      auto tp_justbefore_now = calendar.tick_time(segment_end) - step;
+      double current_year_usLoad = aux::sum_positiveValues(it.second->get_remaining_residual_load_(),
+                                                           tp_start_tmp, tp_justbefore_now,
+                                                           genesys::ProgramSettings::simulation_step_length());
+      annual_unsupplied_total_.add_pulse(current_year_usLoad,
+                                         tp_start_tmp,
+                                         aux::years(1));
+      it.second->set_annual_unsupplied(current_year_usLoad, tp_start_tmp);
+      double factor = std::pow((1+genesys::ProgramSettings::interest_rate()), static_cast<int>(segment_year));
+      //unsupplied of later years is expanded by factor to accound for lower worth of money in far future when penalty is applied.
+      unsupplied += current_year_usLoad*factor;
+      //DEBUG:
+      //        std::cout << it.first  << " " << aux::SimulationClock::time_point_to_string(tp_start_tmp)
+      //                  << " usLoad = " << current_year_usLoad << " GWh" << std::endl;
+      if (last_segment)
+        break;
+      segment_begin = segment_end;
+      segment_year = calendar.year_index(calendar.tick_time(segment_end));
+    }
     //    double total_usLoad = aux::sum_positiveValues(it.second->get_remaining_residual_load_(), genesys::ProgramSettings::simulation_start(), genesys::ProgramSettings::simulation_end(), genesys::ProgramSettings::simulation_step_length());
     //    std::cout << "TOTOAL\n -----------\n usLoad = " << total_usLoad << " GWh \t\tin "<< it.first << " between " << aux::SimulationClock::time_point_to_string(genesys::ProgramSettings::simulation_start())<< " and " << aux::SimulationClock::time_point_to_string(genesys::ProgramSettings::simulation_end()) << std::endl;
     //    double usLoad_regio = aux::sum_positiveValues(usLoad,
@@ -482,23 +775,13 @@ void DynamicModel::print_current_model_capacities(const aux::SimulationClock& sc
 void DynamicModel::set_annual_lookups(const aux::SimulationClock& clock){
   //std::cout << "FUNC-ID: DynamicModel::set_annual_lookups" << std::endl;
 	if (genesys::ProgramSettings::use_global_file()) {
-		if(!global_.empty()){
-			for (auto& it : global_) {
-				//std::cout << "global: set_annual_lookups" << it.first<< std::endl;
-				it.second->set_annual_lookups(clock);
-			}
-		}
-	}
-	if(!regions_.empty()){
-		for (auto& it : regions_){
-			it.second->set_annual_lookups(clock);
-		}
-	}
-	if(!links_.empty()){
-		for (auto& it : links_){
-			it.second->set_annual_lookups(clock);
-		}
+		for (auto global : global_index_)
+			global->set_annual_lookups(clock);
 	}
+	for (auto region : region_index_)
+		region->set_annual_lookups(clock);
+	for (auto link : link_index_)
+		link->set_annual_lookups(clock);
 }
 
 void DynamicModel::setHSMCategoriesFromCode() {
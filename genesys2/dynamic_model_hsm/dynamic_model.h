@@ -53,10 +53,14 @@ class DynamicModel : public sm::StaticModel {
                      aux::SimulationClock::time_point start,
                      aux::SimulationClock::time_point end,
                      const aux::SimulationClock::time_point discount_present =
-                                                                    aux::SimulationClock::time_point_from_string("1970-01-01_00:00")) const;
+                                                                    aux::SimulationClock::time_point()) const; // 1970-01-01_00:00, discount to start
   double getSumValue(std::string,
                      aux::SimulationClock::time_point start,
                      aux::SimulationClock::time_point end) const;
+  CostMetricTotals getCostMetricTotals(aux::SimulationClock::time_point start,
+                                       aux::SimulationClock::time_point end,
+                                       const aux::SimulationClock::time_point discount_present =
+                                                                    aux::SimulationClock::time_point()) const; // 1970-01-01_00:00, discount to start
   double calc_annual_selfsupply(const aux::SimulationClock& clock);
 
   void calculate_annual_electricity_prices(aux::SimulationClock::time_point start,
@@ -70,8 +74,25 @@ class DynamicModel : public sm::StaticModel {
                              aux::SimulationClock::time_point tp_start,
                              aux::SimulationClock::time_point tp_end_seq,
                              aux::SimulationClock::duration tick_length);
-  void resetSequencedModel(const aux::SimulationClock& clock);
+  void resetSequencedModel(const aux::SimulationClock& clock, aux::SimulationClock::time_point tp_end_seq);
+  void resetParametrisedModel(const std::unordered_map<std::string,
+                                                       std::unordered_map<std::string,
+                                                                          std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                                     aux::SimulationClock::time_point,
+                                                                                     aux::SimulationClock::time_point,
+                                                                                     aux::SimulationClock::duration>
+                                                                          >
+                                                       >& installations);
+  void resetOperationModel();
+  void mergeOperationResults(const DynamicModel& other);
+  std::unordered_map<std::string, double> getStoredEnergyTransfer() const;
+  std::unordered_map<std::string, double> getInitialStoredEnergy(aux::SimulationClock::time_point tp) const;
+  void setStoredEnergyTransfer(const std::unordered_map<std::string, double>& transfer);
   void resetCurrentTP(const aux::SimulationClock& clock);
+  void lowerKernel(aux::SimulationClock::time_point tp_start,
+                   aux::SimulationClock::time_point tp_end,
+                   aux::SimulationClock::duration tick_length);
+  void writeBackKernel();
   //  void transfer_persisting_data(const aux::SimulationClock& clock);
   void decommission_plants();
   void uncheck_active_current_year();
@@ -97,14 +118,29 @@ class DynamicModel : public sm::StaticModel {
 
    private:
     void setHSMCategoriesFromCode();
+    void setupBalanceSchedule();
+    void index_components();
     std::vector<std::string> region_codes_;
     std::vector<std::string> link_codes_;
     std::unordered_map<std::string, std::shared_ptr<Region> > regions_;
     std::unordered_map<std::string, std::shared_ptr<Link> > links_;
     std::unordered_map<std::string, std::shared_ptr<Global> > global_;
+    /** \name Balance schedule, see setupBalanceSchedule()*/
+    ///@{
+    std::vector<std::shared_ptr<Region> > local_parallel_regions_;
+    std::vector<std::shared_ptr<Region> > local_serial_regions_;
+    std::vector<std::vector<std::shared_ptr<Region> > > grid_balance_batches_;
+    ///@}
+    /** \name Dense views of the maps for the loops per tp, see index_components()*/
+    ///@{
+    std::vector<Region*> region_index_;
+    std::vector<Link*> link_index_;
+    std::vector<Global*> global_index_;
+    std::vector<Region*> grid_balance_order_; ///< serial grid balance in the order of region_codes_
+    ///@}
 
-    aux::TimeSeriesConstAddable annual_electricity_price_;
-    aux::TimeSeriesConstAddable annual_unsupplied_total_;
+    aux::TimeSeriesAccumulator annual_electricity_price_;
+    aux::TimeSeriesAccumulator annual_unsupplied_total_;
 };
 
 } /* namespace dm_hsm */
@@ -30,6 +30,8 @@
 // This file is part of the genesys-framework v.2
 #include <dynamic_model_hsm/global.h>
 
+#include <utility>
+
 namespace dm_hsm {
 
 
@@ -54,6 +56,8 @@ Global::Global(const sm::Global& origin)
   } else {
     //std::cout << "\t***DEBUG: dm::Global::Global ctor - found no global storage!" << std::endl;
   }
+  attach_storage_state();
+  index_components();
 }
 
 Global::Global(const Global& other)
@@ -69,6 +73,34 @@ Global::Global(const Global& other)
     for (const auto &it : other.primary_energy_ptrs_)
       primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(*it.second)));
   }
+  attach_storage_state();
+  index_components();
+}
+
+Global::Global(Global&& other)
+    : sm::Global(other) {
+  for (const auto &it : other.storage_ptrs_)
+    storage_ptrs_.emplace(it.first, std::shared_ptr<Storage>(new Storage(std::move(*it.second))));
+  for (const auto &it : other.primary_energy_ptrs_)
+    primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(std::move(*it.second))));
+  attach_storage_state();
+  index_components();
+}
+
+void Global::attach_storage_state() {
+  storage_state_ = std::make_shared<StorageState>();
+  for (auto& it : storage_ptrs_)
+    it.second->attach_state(storage_state_);
+}
+
+void Global::index_components() {
+  //map order is kept, the maps are only filled in the c'tors
+  primary_energy_index_.clear();
+  for (const auto& it : primary_energy_ptrs_)
+    primary_energy_index_.push_back(it.second.get());
+  storage_index_.clear();
+  for (const auto& it : storage_ptrs_)
+    storage_index_.push_back(it.second.get());
 }
 
 std::shared_ptr<PrimaryEnergy> Global::getCO2ptr() {
@@ -85,45 +117,101 @@ std::shared_ptr<PrimaryEnergy> Global::getCO2ptr() {
 	return std::shared_ptr<PrimaryEnergy> ();
 }
 void Global::resetCurrentTP(const aux::SimulationClock& clock) {
-	  if(!primary_energy_ptrs_.empty()) {
-	    for (auto&& it : primary_energy_ptrs_) {
-	      it.second->resetCurrentTP(clock);
-	    }
-	  }
-	  if(!storage_ptrs_.empty()){
-      for( auto&&it : storage_ptrs_){
-         it.second->ResetStorageCurrentTP(clock);
-      }
-	  }
+  for (auto primary_energy : primary_energy_index_)
+    primary_energy->resetCurrentTP(clock);
+  for (auto storage : storage_index_)
+    storage->ResetStorageCurrentTP(clock);
 }
 
-void Global::set_annual_lookups(const aux::SimulationClock& clock) {
-	if(!primary_energy_ptrs_.empty()) {
-	    for (auto& it : primary_energy_ptrs_) {
-	      it.second->set_annual_lookups(clock);
-	    }
-    }
-
-	if(!storage_ptrs_.empty()) {
-		for(const auto& it : storage_ptrs_){
-			it.second->set_annaul_lookups(clock);
+void Global::lowerKernel(aux::SimulationClock::time_point tp_start,
+                         aux::SimulationClock::time_point tp_end,
+                         aux::SimulationClock::duration tick_length) {
+  for (auto storage : storage_index_)
+    storage->lowerKernel(tp_start, tp_end, tick_length, false); //the capacity is kept in the StorageState
+}
 
-		}
-	}
+void Global::writeBackKernel() {
+  for (auto storage : storage_index_)
+    storage->writeBackKernel();
+}
 
+void Global::set_annual_lookups(const aux::SimulationClock& clock) {
+  for (auto primary_energy : primary_energy_index_)
+    primary_energy->set_annual_lookups(clock);
+  for (auto storage : storage_index_)
+    storage->set_annaul_lookups(clock);
 }
 
-void Global::resetSequencedGlobal(const aux::SimulationClock& clock) {
+void Global::resetSequencedGlobal(const aux::SimulationClock& clock, aux::SimulationClock::time_point tp_end_seq) {
   if (!storage_ptrs_.empty()) {
     //reset all storages
     for (auto &it : storage_ptrs_) {
-       it.second->ResetSequencedStorage(clock);
+       it.second->ResetSequencedStorage(clock, tp_end_seq);
     }
   }
   if(!primary_energy_ptrs_.empty()) {
     for (auto &it : primary_energy_ptrs_) {
-      it.second->resetSequencedPrimaryEnergy(clock);
+      it.second->resetSequencedPrimaryEnergy(clock, tp_end_seq);
+    }
+  }
+}
+
+void Global::resetParametrisedGlobal(const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                                        aux::SimulationClock::time_point,
+                                                                                        aux::SimulationClock::time_point,
+                                                                                        aux::SimulationClock::duration> >& installations) {
+  for (const auto& it : am::Global::storage_ptrs()) {
+    auto storage_pos = storage_ptrs_.find(it.first);
+    if (storage_pos == storage_ptrs_.end()) {
+      std::cerr << "ERROR in dm_hsm::Global::resetParametrisedGlobal : storage " << it.first << " not found" << std::endl;
+      std::terminate();
+    }
+    auto installation_pos = installations.find(it.first);
+    if (installation_pos != installations.end()) {
+      storage_pos->second->resetParametrisedSysComponent(*it.second, installation_pos->second);
+    } else {
+      storage_pos->second->resetParametrisedSysComponent(*it.second);
+    }
+    storage_pos->second->ResetParametrisedStorage();
+  }
+}
+
+void Global::resetOperationGlobal() {
+  for (auto& it : storage_ptrs_) {
+    it.second->resetOperationSysComponent();
+    it.second->ResetParametrisedStorage();
+  }
+}
+
+void Global::mergeOperationGlobal(const Global& other) {
+  for (auto& it : storage_ptrs_) {
+    auto other_pos = other.storage_ptrs_.find(it.first);
+    if (other_pos == other.storage_ptrs_.end()) {
+      std::cerr << "ERROR in dm_hsm::Global::mergeOperationGlobal : storage " << it.first << " not found" << std::endl;
+      std::terminate();
     }
+    it.second->MergeOperationStorage(*other_pos->second);
+  }
+}
+
+void Global::get_stored_energy_transfer(std::unordered_map<std::string, double>& transfer) const {
+  for (const auto& it : storage_ptrs_) {
+    transfer["global." + it.first] = it.second->stored_energy_transfer();
+  }
+}
+
+void Global::get_initial_stored_energy(aux::SimulationClock::time_point tp,
+                                       std::unordered_map<std::string, double>& stored_energy) const {
+  for (const auto& it : storage_ptrs_) {
+    stored_energy["global." + it.first] = it.second->initial_stored_energy(tp);
+  }
+}
+
+void Global::set_stored_energy_transfer(const std::unordered_map<std::string, double>& transfer) {
+  for (auto& it : storage_ptrs_) {
+    auto transfer_pos = transfer.find("global." + it.first);
+    if (transfer_pos != transfer.end())
+      it.second->set_stored_energy_transfer(transfer_pos->second);
   }
 }
 
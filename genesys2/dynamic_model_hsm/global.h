@@ -32,6 +32,8 @@
 #ifndef DYNAMIC_MODEL_HSM_GLOBAL_H_
 #define DYNAMIC_MODEL_HSM_GLOBAL_H_
 
+#include <vector>
+
 #include <static_model/global.h>
 
 #include <dynamic_model_hsm/primary_energy.h>
@@ -44,14 +46,28 @@ public:
 	Global() = delete;
   virtual ~Global() override = default;
   Global (const Global& other);
-  Global(Global&& other) = delete; //  if this move c'tor is needed, special implementation is necessary, taking care of correct handling of the weak pointers of the converter
+  Global(Global&& other);
   Global& operator=(const Global&) = delete;
   Global& operator=(Global&&) = delete;
   Global(const sm::Global& origin);
 
   void resetCurrentTP(const aux::SimulationClock& clock);
+  void lowerKernel(aux::SimulationClock::time_point tp_start,
+                   aux::SimulationClock::time_point tp_end,
+                   aux::SimulationClock::duration tick_length);
+  void writeBackKernel();
   void set_annual_lookups(const aux::SimulationClock& clock);
-  void resetSequencedGlobal(const aux::SimulationClock& clock);
+  void resetSequencedGlobal(const aux::SimulationClock& clock, aux::SimulationClock::time_point tp_end_seq);
+  void resetParametrisedGlobal(const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                        aux::SimulationClock::time_point,
+                                                                        aux::SimulationClock::time_point,
+                                                                        aux::SimulationClock::duration> >& installations);
+  void resetOperationGlobal();
+  void mergeOperationGlobal(const Global& other);
+  void get_stored_energy_transfer(std::unordered_map<std::string, double>& transfer) const;
+  void get_initial_stored_energy(aux::SimulationClock::time_point tp,
+                                 std::unordered_map<std::string, double>& stored_energy) const;
+  void set_stored_energy_transfer(const std::unordered_map<std::string, double>& transfer);
   std::shared_ptr<PrimaryEnergy> getCO2ptr();
 
   const std::unordered_map<std::string, std::shared_ptr<Storage>>& storage_ptrs() const { return storage_ptrs_; }
@@ -61,8 +77,17 @@ public:
     return primary_energy_ptrs_;}
 
 private:
+  void attach_storage_state();
+  void index_components();
+
   std::unordered_map<std::string, std::shared_ptr<PrimaryEnergy> > primary_energy_ptrs_;
   std::unordered_map<std::string, std::shared_ptr<Storage> > storage_ptrs_;
+  std::shared_ptr<StorageState> storage_state_; ///state of charge of all storage_ptrs_ in one block
+  /** \name Dense views of the component maps for the loops per tp, see index_components()*/
+  ///@{
+  std::vector<PrimaryEnergy*> primary_energy_index_;
+  std::vector<Storage*> storage_index_;
+  ///@}
 };
 
 } /* namespace dm_hsm */
@@ -31,12 +31,18 @@
 
 #include <dynamic_model_hsm/hsm_operation.h>
 
+#include <omp.h>
+
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <ratio>
 #include <string>
 #include <iomanip>
 #include <unordered_map>
+#include <utility>
 
+#include <benchmark/phase_profiler.h>
 #include <program_settings.h>
 
 namespace dm_hsm {
@@ -52,11 +58,43 @@ HSMOperation::HSMOperation(const sm::StaticModel& model)
       future_lookahead_time_(genesys::ProgramSettings::operation_get_LookAheadTime()),
       accumulated_penalties_unsupplied_load_(0.),
       accumulated_penalties_selfsupply_quota_(0.),
-      fitness_(0.0) {
+      fitness_(0.0),
+      sequence_operations_(),
+      sequence_installations_(nullptr),
+      sequence_operations_stale_(false) {
+}
+
+void HSMOperation::resetParametrisedOperation(const std::unordered_map<std::string,
+                                                                       std::unordered_map<std::string,
+                                                                                          std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                                          aux::SimulationClock::time_point,
+                                                                                          aux::SimulationClock::time_point,
+                                                                                          aux::SimulationClock::duration>
+                                                                                          >
+                                                                       >& installations) {
+  //reuse the model for a new set of installations (e.g. the next individual of the optimiser)
+  if (genesys::ProgramSettings::parallel_sequences()) {
+    //the operations of the parallel sequences are reparametrised on their next use only
+    sequence_installations_ = &installations;
+    sequence_operations_stale_ = true;
+  }
+  model_.resetParametrisedModel(installations);
+  accumulated_penalties_unsupplied_load_ = 0.;
+  accumulated_penalties_selfsupply_quota_ = 0.;
+  fitness_ = 0.0;
+}
+
+void HSMOperation::resetOperation() {
+  //restore the state after resetParametrisedOperation without changing the installations
+  model_.resetOperationModel();
+  accumulated_penalties_unsupplied_load_ = 0.;
+  accumulated_penalties_selfsupply_quota_ = 0.;
+  fitness_ = 0.0;
 }
 
 std::unordered_map<std::string, double > HSMOperation::CalculateFitnessMinCost(bool analyse){//, aux::SimulationClock::duration max_operation_duration){
   //  std::cout << "FUNC-ID: HSMOperation::CalculateFitnessMinCost()" << std::endl;
+  GENESYS_PROFILE_PHASE("evaluation");
   auto wall_time_timer = std::chrono::system_clock::now();
   startSequencer();
   std::unordered_map<std::string, double >result_map;
@@ -65,14 +103,15 @@ std::unordered_map<std::string, double > HSMOperation::CalculateFitnessMinCost(b
     model_.calculate_annual_electricity_prices(tp_start_operation_, tp_end_operation_);
     model_.calculate_annual_disc_capex(tp_start_operation_, tp_end_operation_);
   }
-  double capex = model_.getSumValue("CAPEX", tp_start_operation_, tp_end_operation_);
-  double fopex = model_.getSumValue("FOPEX", tp_start_operation_, tp_end_operation_);
-  double vopex = model_.getSumValue("VOPEX", tp_start_operation_, tp_end_operation_);
+  auto totals = model_.getCostMetricTotals(tp_start_operation_, tp_end_operation_);
+  double capex = totals.sum(CostMetric::CAPEX);
+  double fopex = totals.sum(CostMetric::FOPEX);
+  double vopex = totals.sum(CostMetric::VOPEX);
   double real_cost = capex + vopex + fopex;
 
   //Application of PENALTIES===========================================================================================
   //  auto sum_usload =   model_.getSumValue("unsupplied_load",  tp_start_operation_, tp_end_operation_);
-  auto sum_energy =  model_.getSumValue("ENERGY", tp_start_operation_, tp_end_operation_);
+  auto sum_energy =  totals.sum(CostMetric::ENERGY);
   //  auto penalties = calculate_penalties(total_cost, sum_usload,sum_energy);//return std::make_tuple(total_cost,sum_usload, penalties_SQ);
   //  total_cost += std::get<0>(penalties);
   //  sum_usload += std::get<1>(penalties);
@@ -91,10 +130,10 @@ std::unordered_map<std::string, double > HSMOperation::CalculateFitnessMinCost(b
   //CALCULATE LCOE=====================================================================================================
   double LCOE = 0.0;
   //calculate discounted values for lcoe calculation
-  auto disc_energy = model_.getDiscountedValue("ENERGY", tp_start_operation_, tp_end_operation_);
-  auto disc_capex  = model_.getDiscountedValue("CAPEX", tp_start_operation_, tp_end_operation_);
-  auto disc_fopex  = model_.getDiscountedValue("FOPEX", tp_start_operation_, tp_end_operation_);
-  auto disc_vopex  = model_.getDiscountedValue("VOPEX", tp_start_operation_, tp_end_operation_);
+  auto disc_energy = totals.discounted(CostMetric::ENERGY);
+  auto disc_capex  = totals.discounted(CostMetric::CAPEX);
+  auto disc_fopex  = totals.discounted(CostMetric::FOPEX);
+  auto disc_vopex  = totals.discounted(CostMetric::VOPEX);
 
 
   double all_realCost = disc_capex + disc_vopex + disc_fopex;
@@ -145,6 +184,7 @@ std::unordered_map<std::string, double > HSMOperation::CalculateFitnessMinCost(b
 
 std::unordered_map<std::string, double > HSMOperation::CalculateFitnessMinLCOE(bool analyse){//, aux::SimulationClock::duration max_operation_duration){
   //  std::cout << "FUNC-ID: HSMOperation::CalculateFitnessMinCost()" << std::endl;
+  GENESYS_PROFILE_PHASE("evaluation");
   auto wall_time_timer = std::chrono::system_clock::now();
   startSequencer();
   std::unordered_map<std::string, double >result_map;
@@ -153,13 +193,14 @@ std::unordered_map<std::string, double > HSMOperation::CalculateFitnessMinLCOE(b
     model_.calculate_annual_electricity_prices(tp_start_operation_, tp_end_operation_);
     model_.calculate_annual_disc_capex(tp_start_operation_, tp_end_operation_);
   }
-  double capex = model_.getSumValue("CAPEX", tp_start_operation_, tp_end_operation_);
-  double vopex = model_.getSumValue("FOPEX", tp_start_operation_, tp_end_operation_);
-  double fopex = model_.getSumValue("VOPEX", tp_start_operation_, tp_end_operation_);
+  auto totals = model_.getCostMetricTotals(tp_start_operation_, tp_end_operation_);
+  double capex = totals.sum(CostMetric::CAPEX);
+  double fopex = totals.sum(CostMetric::FOPEX);
+  double vopex = totals.sum(CostMetric::VOPEX);
   double real_cost = capex + vopex + fopex;
 
   //Application of PENALTIES===========================================================================================
-  auto sum_energy =  model_.getSumValue("ENERGY", tp_start_operation_, tp_end_operation_);
+  auto sum_energy =  totals.sum(CostMetric::ENERGY);
 
   auto penalties = calculate_penalties(real_cost, sum_energy);//return std::make_tuple(total_cost,sum_usload, penalties_SQ);
   auto pen0 = std::get<0>(penalties); //unsupplied load pen/energy
@@ -170,10 +211,10 @@ std::unordered_map<std::string, double > HSMOperation::CalculateFitnessMinLCOE(b
   //CALCULATE LCOE=====================================================================================================
   double LCOE = 0.0;
   //calculate discounted values for lcoe calculation
-  auto disc_energy = model_.getDiscountedValue("ENERGY", tp_start_operation_, tp_end_operation_);
-  auto disc_capex  = model_.getDiscountedValue("CAPEX", tp_start_operation_, tp_end_operation_);
-  auto disc_fopex  = model_.getDiscountedValue("FOPEX", tp_start_operation_, tp_end_operation_);
-  auto disc_vopex  = model_.getDiscountedValue("VOPEX", tp_start_operation_, tp_end_operation_);
+  auto disc_energy = totals.discounted(CostMetric::ENERGY);
+  auto disc_capex  = totals.discounted(CostMetric::CAPEX);
+  auto disc_fopex  = totals.discounted(CostMetric::FOPEX);
+  auto disc_vopex  = totals.discounted(CostMetric::VOPEX);
 
 
   double all_realCost = disc_capex + disc_vopex + disc_fopex;
@@ -335,6 +376,16 @@ void HSMOperation::set_annual_lookups(const aux::SimulationClock& clock){
 	model_.set_annual_lookups(clock);
 }
 
+void HSMOperation::lowerKernel(const aux::SimulationClock& clock, aux::SimulationClock::time_point tp_end_seq) {
+  //plain per tick records of the active components for the dispatch of this sequence
+  model_.lowerKernel(clock.now(), tp_end_seq, clock.tick_length());
+}
+
+void HSMOperation::writeBackKernel() {
+  //hands the operation collected in the records to the time series of the components
+  model_.writeBackKernel();
+}
+
 void HSMOperation::save_unsupplied_load(const aux::SimulationClock& clock) {
   //std::cout<<"DEBUG FUNC-ID = HSMOperation::add_penalties_unsupplied_load_()" <<std::endl;
   model_.save_unsupplied_load(clock);
@@ -352,6 +403,10 @@ void HSMOperation::add_energy_unsupplied_(const aux::SimulationClock& clock) {
 
 void HSMOperation::startSequencer() {
   //DEBUG std::cout << "FUNC-ID: HSMOperation::startSequencer() " << std::endl;
+  if (genesys::ProgramSettings::parallel_sequences() && !omp_in_parallel()) {
+    startSequencerParallel();
+    return;
+  }
 
   ///Sequencer to avoid memory problems
   for (int current_seq = 0; current_seq < num_operation_sequence_iterations_; current_seq++) {
@@ -376,17 +431,118 @@ void HSMOperation::startSequencer() {
   }
 }
 
+void HSMOperation::startSequencerParallel() {
+  //DEBUG std::cout << "FUNC-ID: HSMOperation::startSequencerParallel() " << std::endl;
+  //The only state passed from one sequence to the next is the stored energy. All sequences are solved concurrently from
+  //estimated storage levels at their start, which are then corrected with the levels reached at the end of the prior
+  //sequence (parareal, the coarse propagator keeps the storage level). Sequences whose start levels changed by more than
+  //parallel_sequences_tolerance are solved again. After sweep k the first k+1 sequences are exact, so the iteration ends
+  //after at most one sweep per sequence.
+  std::vector<std::pair<aux::SimulationClock::time_point, aux::SimulationClock::duration> > sequences;
+  for (int current_seq = 0; current_seq < num_operation_sequence_iterations_; current_seq++) {
+    sequences.emplace_back(tp_start_operation_ + current_seq*duration_operation_sequence_, duration_operation_sequence_);
+  }
+  if (aux::SimulationClock::duration(0) < duration_last_operation_sequence_) {
+    sequences.emplace_back(tp_start_operation_ + num_operation_sequence_iterations_*duration_operation_sequence_,
+                           duration_last_operation_sequence_);
+  }
+  if (sequences.size() < 2) {
+    for (const auto& it : sequences)
+      solveSequence(it.first, it.second);
+    return;
+  }
+  const auto num_sequences = sequences.size();
+  //the last sequence is solved by this operation, so model_ holds the hourly values of the last sequence as in startSequencer
+  setupSequenceOperations(num_sequences - 1);
+  std::vector<HSMOperation*> operations;
+  for (auto& it : sequence_operations_)
+    operations.push_back(it.get());
+  operations.push_back(this);
+
+  //storage levels at the start of each sequence, the first sequence always starts with the initial SOC
+  std::vector<std::unordered_map<std::string, double> > start_energy(num_sequences);
+  std::vector<std::unordered_map<std::string, double> > end_energy(num_sequences);
+  for (decltype(sequences.size()) i = 1; i < num_sequences; ++i)
+    start_energy[i] = operations[i]->model_.getInitialStoredEnergy(sequences[i].first);
+  std::vector<char> solve_sequence(num_sequences, true);
+
+  const double tolerance = genesys::ProgramSettings::parallel_sequences_tolerance();
+  for (decltype(sequences.size()) sweep = 0; sweep < num_sequences; ++sweep) {
+    #pragma omp parallel for schedule(dynamic)
+    for (long i = 0; i < static_cast<long>(num_sequences); ++i) {
+      if (!solve_sequence[i])
+        continue;
+      HSMOperation& operation = *operations[i];
+      if (sweep > 0)
+        operation.resetOperation();
+      operation.model_.setStoredEnergyTransfer(start_energy[i]);
+      operation.solveSequence(sequences[i].first, sequences[i].second);
+      end_energy[i] = operation.model_.getStoredEnergyTransfer();
+    }
+    //correction sweep: U_new[i+1] = U_new[i] + F(U[i]) - U[i], exact for the successor of the first sequence
+    std::vector<std::unordered_map<std::string, double> > new_start_energy(num_sequences);
+    new_start_energy[1] = end_energy[0];
+    for (decltype(sequences.size()) i = 1; i + 1 < num_sequences; ++i) {
+      for (const auto& it : end_energy[i]) {
+        double corrected = new_start_energy[i].at(it.first) + it.second - start_energy[i].at(it.first);
+        new_start_energy[i+1][it.first] = std::max(corrected, 0.);
+      }
+    }
+    bool converged = true;
+    solve_sequence[0] = false;
+    for (decltype(sequences.size()) i = 1; i < num_sequences; ++i) {
+      double max_change = 0.;
+      for (const auto& it : new_start_energy[i])
+        max_change = std::max(max_change, std::abs(it.second - start_energy[i].at(it.first)));
+      solve_sequence[i] = (max_change > tolerance);
+      if (solve_sequence[i]) {
+        //sequences within the tolerance keep their results and the start levels they were solved with
+        start_energy[i] = std::move(new_start_energy[i]);
+        converged = false;
+      }
+    }
+    //DEBUG std::cout << "HSM parallel sequences: sweep " << sweep << " converged=" << converged << std::endl;
+    if (converged)
+      break;
+  }
+
+  for (const auto& it : sequence_operations_) {
+    model_.mergeOperationResults(it->model_);
+    accumulated_penalties_unsupplied_load_ += it->accumulated_penalties_unsupplied_load_;
+    accumulated_penalties_selfsupply_quota_ += it->accumulated_penalties_selfsupply_quota_;
+  }
+}
+
+void HSMOperation::setupSequenceOperations(std::vector<std::unique_ptr<HSMOperation> >::size_type num_operations) {
+  //the operations are built once from the origin of model_ and afterwards only reset
+  while (sequence_operations_.size() < num_operations)
+    sequence_operations_.emplace_back(new HSMOperation(model_));
+  for (auto& it : sequence_operations_) {
+    if (sequence_operations_stale_) {
+      it->resetParametrisedOperation(*sequence_installations_);
+    } else {
+      it->resetOperation();
+    }
+  }
+  sequence_operations_stale_ = false;
+}
+
 void HSMOperation::solveSequence(aux::SimulationClock::time_point tp_start_sequence,
                                  aux::SimulationClock::duration duration) {
   //DEBUG  std::cout << "FUNC-ID: HSMOperation::solveSequence()"<< std::endl;
+  GENESYS_PROFILE_PHASE("solve_sequence");
    //Set up the Clock
   aux::SimulationClock main_clock(tp_start_sequence, genesys::ProgramSettings::simulation_step_length());
   aux::SimulationClock::time_point tp_end_seq = tp_start_sequence + duration;
   //Reset the operation variables from former sequence
-  resetSequencedModel(main_clock);//reset TSCsumable of hourly-basis, preserve annual values, set SOC from prior sequence
+  resetSequencedModel(main_clock, tp_end_seq);//reset TSCsumable of hourly-basis, preserve annual values, set SOC from prior sequence
   calculateResidualLoadTS(dm_hsm::HSMCategory::RE_GENERATOR, main_clock.now(), tp_end_seq, main_clock.tick_length());
+  lowerKernel(main_clock, tp_end_seq);
 
-	int current_year = main_clock.year();
+	//year boundaries as time points instead of clock.year() per tick
+	auto next_year_start = aux::SimulationClock::year_start(main_clock.now()) + aux::years(1);
+	const auto first_year_end = aux::SimulationClock::year_start(genesys::ProgramSettings::simulation_start())
+	                            + aux::years(1);
 	//	int counts = 0;
 	add_OaM_cost(main_clock.now()); //first year
 	set_annual_lookups(main_clock);
@@ -394,19 +550,20 @@ void HSMOperation::solveSequence(aux::SimulationClock::time_point tp_start_seque
   do { //std::cout << "TIME:" << aux::SimulationClock::time_point_to_string(main_clock.now()) << std::endl;
     resetCurrentTP(main_clock);//update RL etc.
     ///Things that should be updated annually
-    if (main_clock.year() - current_year != 0 ||  //or last year end of simulation
+    if (main_clock.now() >= next_year_start ||  //or last year end of simulation
         main_clock.now() + aux::minutes(genesys::ProgramSettings::simulation_step_length()) > tp_end_seq) {
       //DEBUG std::cout << "current year = " << current_year << std::endl;
       add_OaM_cost(main_clock.now());
+      writeBackKernel(); //the self-supply quota sums the generation of the past year
       calc_self_supply_quota_and_apply_penalties(main_clock);
       set_annual_lookups(main_clock);
       //print_current_model_capacities(main_clock);
-      current_year = main_clock.year();
+      next_year_start = aux::SimulationClock::year_start(main_clock.now()) + aux::years(1);
       //std::terminate();
 
     }
     //every year but not beginning first year
-    if ((main_clock.year() - aux::SimulationClock::year(genesys::ProgramSettings::simulation_start()))!= 0 ){
+    if (main_clock.now() >= first_year_end){
       //decommission_plants(); TODO: check if a strategy with memory parameter can be implemented!
       uncheck_active_current_year();
     } else {
@@ -453,9 +610,11 @@ void HSMOperation::solveSequence(aux::SimulationClock::time_point tp_start_seque
     */
 
     save_unsupplied_load(main_clock);
+    GENESYS_PROFILE_COUNT("ticks", 1);
     //    ++counts;
   } while (main_clock.tick() <= tp_end_seq);
   //std::cout << "counts= " << counts<< std::endl;
+  writeBackKernel();
   setTransferStoredEnergy(main_clock); //store longterm SOC in vector for transfer to next sequence
   //std::cout << "DEBUG: END HSMOperation::solveSequence()" << std::endl;
 }
@@ -465,13 +624,15 @@ void HSMOperation::solveSequence(aux::SimulationClock::time_point tp_start_seque
 //  model_.transfer_persisting_data(clock);
 //}
 
-void HSMOperation::resetSequencedModel(const aux::SimulationClock& clock) {
+void HSMOperation::resetSequencedModel(const aux::SimulationClock& clock,
+                                       aux::SimulationClock::time_point tp_end_seq) {
   //std::cout << "FUNC-ID: HSMOperation::resetSequencedModel()" << std::endl;
-  model_.resetSequencedModel(clock);
+  model_.resetSequencedModel(clock, tp_end_seq);
 }
 
 void HSMOperation::resetCurrentTP(const aux::SimulationClock& clock) {
   //std::cout << "FUNC-ID: HSMOperation::resetCurrentTP()" << std::endl;
+  GENESYS_PROFILE_PHASE("reset_current_tp");
   model_.resetCurrentTP(clock);
   //std::cout << "FUNC-END: HSMOperation::resetCurrentTP()" << std::endl;
 }
@@ -497,6 +658,7 @@ void HSMOperation::calculateResidualLoadTS(dm_hsm::HSMCategory hsm_cat,
                                            aux::SimulationClock::time_point tp_end_seq,
                                            aux::SimulationClock::duration  tick_length) {
   //DEBUG std::cout << "FUNC-ID: HSMOperation::calculateResidualLoad for TS" << std::endl;
+  GENESYS_PROFILE_PHASE("residual_load");
   model_.CalculateResidualLoad(hsm_cat, tp_start_seq, tp_end_seq, tick_length);
   //DEBUG std::cout << "FUNC-END: HSMOperation::calculateResidualLoad for TS" << std::endl;
 }
@@ -518,6 +680,7 @@ void HSMOperation::generalised_balance(bool local,
 void HSMOperation::add_OaM_cost(aux::SimulationClock::time_point tp_now) {
   //std::cout << "CALLED HSMOperation::add_OaM_cost - tp: " << aux::SimulationClock::time_point_to_string(tp_now) << std::endl;
 	//TODO if sys_component was not active before in the current year add OaM_cost
+	GENESYS_PROFILE_PHASE("add_OaM_cost");
 	model_.add_OaM_cost(tp_now);
 }
 
@@ -32,7 +32,10 @@
 #ifndef DYNAMIC_MODEL_HSM_HSM_OPERATION_H_
 #define DYNAMIC_MODEL_HSM_HSM_OPERATION_H_
 
+#include <memory>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <dynamic_model_hsm/dynamic_model.h>
 #include <dynamic_model_hsm/hsm_category.h>
@@ -50,22 +53,40 @@ class HSMOperation {
   //std::unordered_map<std::string, double > CalculateFitness(bool analyse);
   std::unordered_map<std::string, double > CalculateFitnessMinCost(bool analyse);
   std::unordered_map<std::string, double > CalculateFitnessMinLCOE(bool analyse);
+  /**
+   * @brief Reparametrises the model with new installations, e.g. for the next individual of the optimiser
+   *
+   * With parallel_sequences the operations of the sequences are reparametrised from installations when the parallel
+   * sequencer runs next, so installations have to stay valid until the next fitness calculation.
+   */
+  void resetParametrisedOperation(const std::unordered_map<std::string,
+                                                           std::unordered_map<std::string,
+                                                                              std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                                         aux::SimulationClock::time_point,
+                                                                                         aux::SimulationClock::time_point,
+                                                                                         aux::SimulationClock::duration>
+                                                                              >
+                                                           >& installations);
 
  protected:
   const DynamicModel& model() const {return model_;}
+  DynamicModel ReleaseModel() {return std::move(model_);} ///< Hands the operated model over, leaving this operation without one
   double fitness() {return fitness_;}
 
  private:
   /** \name Sequencer Functions.*/
   ///@{
   void startSequencer();
+  void startSequencerParallel(); /// Solves all sequences concurrently and corrects their initial storage levels (parareal).
+  void setupSequenceOperations(std::vector<std::unique_ptr<HSMOperation> >::size_type num_operations);
   void solveSequence(aux::SimulationClock::time_point start_year_sequence,
                      aux::SimulationClock::duration duration); /// Solves one sequence of the System for each hour independently.
   ///@}
 
   /** \name Reset Functions.*/
   ///@{
-  void resetSequencedModel(const aux::SimulationClock& sim_clock);
+  void resetSequencedModel(const aux::SimulationClock& sim_clock, aux::SimulationClock::time_point tp_end_seq);
+  void resetOperation();
   void resetCurrentTP(const aux::SimulationClock& clock);
 //  void transfer_persisting_data(const aux::SimulationClock& clock);
   //TODO FORESIGHT  void resetFuture(int lenghtforesight);
@@ -92,6 +113,8 @@ class HSMOperation {
                            const aux::SimulationClock& clock);
   void add_OaM_cost(aux::SimulationClock::time_point tp_now);
   void set_annual_lookups(const aux::SimulationClock& clock);
+  void lowerKernel(const aux::SimulationClock& clock, aux::SimulationClock::time_point tp_end_seq);
+  void writeBackKernel();
   void save_unsupplied_load(const aux::SimulationClock& clock);
   void add_penalties_selfsupply_quota_(const aux::SimulationClock& clock);
   void add_energy_unsupplied_(const aux::SimulationClock& clock);
@@ -114,6 +137,19 @@ class HSMOperation {
   double accumulated_penalties_unsupplied_load_;
   double accumulated_penalties_selfsupply_quota_;
   double fitness_;
+  /** \name Parallel sequences, see startSequencerParallel()*/
+  ///@{
+  std::vector<std::unique_ptr<HSMOperation> > sequence_operations_; ///< operations of all but the last sequence
+  const std::unordered_map<std::string,
+                           std::unordered_map<std::string,
+                                              std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                         aux::SimulationClock::time_point,
+                                                         aux::SimulationClock::time_point,
+                                                         aux::SimulationClock::duration>
+                                              >
+                           >* sequence_installations_; ///< installations of the last reparametrisation, not owned
+  bool sequence_operations_stale_;
+  ///@}
 };
 
 } /* namespace dm_hsm */
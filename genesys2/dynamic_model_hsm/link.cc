@@ -40,24 +40,36 @@ namespace dm_hsm {
 
 Link::Link(const Link& other)
     : sm::Link(other),
-      region_A_ptr_(),
-      region_B_ptr_() {
+      region_A_ptr_(nullptr),
+      region_B_ptr_(nullptr) {
   if(!other.converter_ptrs_.empty()) {
     for (const auto& it : other.converter_ptrs_)
         converter_ptrs_.emplace(it.first, std::shared_ptr<TransmissionConverter>(new TransmissionConverter(*(it.second))));
   }
+  index_components();
+}
+
+Link::Link(Link&& other)
+    : sm::Link(other),
+      region_A_ptr_(nullptr),
+      region_B_ptr_(nullptr) {
+  for (const auto& it : other.converter_ptrs_)
+    converter_ptrs_.emplace(it.first, std::shared_ptr<TransmissionConverter>(new TransmissionConverter(std::move(*(it.second)))));
+  index_components();
 }
 
 Link::Link(const sm::Link& origin,
            const std::unordered_map<std::string, std::shared_ptr<Region> >& input_region)
-    : sm::Link(origin) {
+    : sm::Link(origin),
+      region_A_ptr_(nullptr),
+      region_B_ptr_(nullptr) {
   if(!converter_ptrs_sm().empty()){
     for (const auto& it : converter_ptrs_sm())
         converter_ptrs_.emplace(it.first, std::shared_ptr<TransmissionConverter>(new TransmissionConverter(*(it.second))));
   }
   auto region_A_pos = input_region.find(region_A());
   if (region_A_pos != input_region.end()) {
-    region_A_ptr_ = region_A_pos->second;
+    region_A_ptr_ = region_A_pos->second.get();
   } else {
     std::cerr << "ERROR in dm_hsm::Link::Link :" << std::endl
         << "Region_A " << region_A() << " not found in Region list region" << std::endl;
@@ -65,26 +77,34 @@ Link::Link(const sm::Link& origin,
   }
   auto region_B_pos = input_region.find(region_B());
   if (region_B_pos != input_region.end()) {
-    region_B_ptr_ = region_B_pos->second;
+    region_B_ptr_ = region_B_pos->second.get();
   } else {
     std::cerr << "ERROR in dm_hsm::Link::Link :" << std::endl
         << "Region_B " << region_B() << " not found in Region list region" << std::endl;
     std::terminate();
   }
+  index_components();
+}
+
+void Link::index_components() {
+  //map order is kept, the map is only filled in the c'tors
+  converter_index_.clear();
+  for (const auto& it : converter_ptrs_)
+    converter_index_.push_back(it.second.get());
 }
 
-void Link::RegisterWithRegions(std::shared_ptr<Link> this_link) const {
-  region_A_ptr_.lock()->connectLink(std::weak_ptr<Link>(this_link), converter_ptrs_);
-  region_B_ptr_.lock()->connectLink(std::weak_ptr<Link>(this_link), converter_ptrs_);
+void Link::RegisterWithRegions() {
+  region_A_ptr_->connectLink(this, converter_ptrs_);
+  region_B_ptr_->connectLink(this, converter_ptrs_);
 }
 
 void Link::resetCurrentTP(const aux::SimulationClock& clock) {
   //std::cout << "FUNC-ID:  Link::resetCurrentTP() " << std::endl;
-  if(!converter_ptrs_.empty()){
-    for (auto&& it : converter_ptrs_) {
+  if(!converter_index_.empty()){
+    for (auto converter : converter_index_) {
         //TODO find out what has to be reset.
         //std::cout << "Link::resetCurrentTP on Link between " << region_A() <<"-"<< region_B() <<  std::endl;
-        it.second->resetCurrentTP(clock);//set active = 0
+        converter->resetCurrentTP(clock);//set active = 0
     }
   } else {
     std::cerr << "***Link::resetCurrentTP: No Converter on Link between " << region_A() <<"-"<< region_B() <<  std::endl;
@@ -92,12 +112,21 @@ void Link::resetCurrentTP(const aux::SimulationClock& clock) {
   //std::cout << "FUNC-END:  Link::resetCurrentTP() " << std::endl;
 }
 
+void Link::lowerKernel(aux::SimulationClock::time_point tp_start,
+                       aux::SimulationClock::time_point tp_end,
+                       aux::SimulationClock::duration tick_length) {
+  for (auto converter : converter_index_)
+    converter->lowerKernel(tp_start, tp_end, tick_length);
+}
+
+void Link::writeBackKernel() {
+  for (auto converter : converter_index_)
+    converter->writeBackKernel();
+}
+
 void Link::set_annual_lookups(const aux::SimulationClock& clock) {
-	if(!converter_ptrs_.empty()) {
-		for(const auto& it : converter_ptrs_){
-			it.second->set_annaul_lookups(clock);
-		}
-	}
+	for (auto converter : converter_index_)
+	  converter->set_annaul_lookups(clock);
 }
 
 void Link::resetSequencedLink(const aux::SimulationClock&) {
@@ -108,20 +137,54 @@ void Link::resetSequencedLink(const aux::SimulationClock&) {
 	}
 }
 
-void Link::uncheck_active_current_year(){
-	if(!converter_ptrs_.empty()){
-	    for (auto&& it : converter_ptrs_) {
-	    	it.second->uncheck_active_current_year();
-	    }
-	}
+void Link::resetParametrisedLink(const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                                      aux::SimulationClock::time_point,
+                                                                                      aux::SimulationClock::time_point,
+                                                                                      aux::SimulationClock::duration> >& installations) {
+  for (const auto& it : am::Link::converter_ptrs()) {
+    auto converter_pos = converter_ptrs_.find(it.first);
+    if (converter_pos == converter_ptrs_.end()) {
+      std::cerr << "ERROR in dm_hsm::Link::resetParametrisedLink :" << std::endl
+          << "Converter " << it.first << " not found on Link between " << region_A() << "-" << region_B() << std::endl;
+      std::terminate();
+    }
+    auto installation_pos = installations.find(it.first);
+    if (installation_pos != installations.end()) {
+      converter_pos->second->resetParametrisedSysComponent(*it.second, installation_pos->second);
+    } else {
+      converter_pos->second->resetParametrisedSysComponent(*it.second);
+    }
+    converter_pos->second->ResetParametrisedTransmConverter();
+  }
 }
 
-void Link::add_OaM_cost(aux::SimulationClock::time_point tp_now) {
-  if (!converter_ptrs_.empty()) {
-    for (const auto&it : converter_ptrs_) {
-      it.second->add_OaM_cost(tp_now);
+void Link::resetOperationLink() {
+  for (auto& it : converter_ptrs_) {
+    it.second->resetOperationSysComponent();
+    it.second->ResetParametrisedTransmConverter();
+  }
+}
+
+void Link::mergeOperationLink(const Link& other) {
+  for (auto& it : converter_ptrs_) {
+    auto other_pos = other.converter_ptrs_.find(it.first);
+    if (other_pos == other.converter_ptrs_.end()) {
+      std::cerr << "ERROR in dm_hsm::Link::mergeOperationLink :" << std::endl
+          << "Converter " << it.first << " not found on other Link between " << region_A() << "-" << region_B() << std::endl;
+      std::terminate();
     }
+    it.second->MergeOperationTransmConverter(*other_pos->second);
   }
+}
+
+void Link::uncheck_active_current_year(){
+	for (auto converter : converter_index_)
+	  converter->uncheck_active_current_year();
+}
+
+void Link::add_OaM_cost(aux::SimulationClock::time_point tp_now) {
+  for (auto converter : converter_index_)
+    converter->add_OaM_cost(tp_now);
 //	if (!converter_ptrs_.empty()) {
 //		for (auto&& it : converter_ptrs_) {
 //			if (it.second->active_current_year()) {
@@ -151,24 +214,23 @@ bool Link::useImportCapacity(const dm_hsm::HSMCategory cat,
                              const double import_request,
                              const aux::SimulationClock& clock,
                              const std::string& requesting_region_code,
-                             const std::weak_ptr<TransmissionConverter>& active_converter,
-                             const std::weak_ptr<Link>& active_Link) {
+                             TransmissionConverter* active_converter) {
   //std::cout << "\tLink::useImportCapacity called with request " << import_request << " GW from " << requesting_region_code << std::endl;
   if (import_request > 0) {
-    if (requesting_region_code != region_A_ptr_.lock()->code()) {//forward operation A-->B
+    if (requesting_region_code != region_A_ptr_->code()) {//forward operation A-->B
       //std::cout << "\tlink " << code() << "|" << active_converter.lock()->code()<< " operating request forward" << std::endl;
-      if(active_converter.lock()->activate_forward()){
+      if(active_converter->activate_forward()){
         //operate successfully
-        return active_converter.lock()->useTransmission(cat, import_request, clock, otherRegion(requesting_region_code), active_Link.lock() );
+        return active_converter->useTransmission(cat, import_request, clock, otherRegion(requesting_region_code), this);
       } else {
         std::cout << "\t\tDEBUG Link::useImportCapacity | TR-Converter reversed illegally" << std::endl;
         return false;
       }
     } else {//backward operation A<--B
       //std::cout << "\tlink " << code() << "|" << active_converter.lock()->code()<< " operating request backwards" << std::endl;
-      if(active_converter.lock()->activate_backwards()){
+      if(active_converter->activate_backwards()){
         //operate successfully
-        return active_converter.lock()->useTransmission(cat, import_request, clock, otherRegion(requesting_region_code), active_Link.lock() );
+        return active_converter->useTransmission(cat, import_request, clock, otherRegion(requesting_region_code), this);
       } else {
         std::cout << "\t\tDEBUG Link::useImportCapacity | TR-Converter reversed illegally" << std::endl;
         return false;
@@ -197,7 +259,7 @@ double Link::getDiscountedValue(std::string query,
                                 aux::SimulationClock::time_point end,
                                 const aux::SimulationClock::time_point discount_present) const {
   aux::SimulationClock::time_point present;
-  if (discount_present == aux::SimulationClock::time_point_from_string("1970-01-01_00:00")){
+  if (discount_present == aux::SimulationClock::time_point()){ // default 1970-01-01_00:00
     present = start;
   } else {
     present = discount_present;
@@ -225,6 +287,21 @@ double Link::getSumValue(std::string query,
 
 }
 
+void Link::accumulate_cost_metrics(aux::SimulationClock::time_point start,
+                                   aux::SimulationClock::time_point end,
+                                   const aux::SimulationClock::time_point discount_present,
+                                   CostMetricTotals& totals) const {
+  aux::SimulationClock::time_point present;
+  if (discount_present == aux::SimulationClock::time_point()){ // default 1970-01-01_00:00
+    present = start;
+  } else {
+    present = discount_present;
+  }
+  for (const auto& it : converter_ptrs_) {
+    it.second->accumulate_cost_metrics(start, end, present, totals);
+  }
+}
+
 void Link::calculated_annual_disc_capex(aux::SimulationClock::time_point start) {
   //std::cout << "FUNC-ID: Link::calculated_annual_capex" << std::endl;
   if (!converter_ptrs_.empty()) {
@@ -245,19 +322,19 @@ void Link::print_current_capacities() const {
 double Link::requestRegionExportLimit(const dm_hsm::HSMCategory cat,
                                   const aux::SimulationClock& clock,
                                   const double requested_export_infeed,
-                                  const std::weak_ptr<Region>& supply_region) {
-  return supply_region.lock()->getExportCapacity(cat, clock, requested_export_infeed);
+                                  Region* supply_region) {
+  return supply_region->getExportCapacity(cat, clock, requested_export_infeed);
 }
 
-std::weak_ptr<Region> Link::otherRegion(const std::string& requesting_region_code) {
-  if (region_A_ptr_.lock()->code() == requesting_region_code) {
-    return region_B_ptr_.lock();
-  } else if (region_B_ptr_.lock()->code() == requesting_region_code) {
-    return region_A_ptr_.lock();
+Region* Link::otherRegion(const std::string& requesting_region_code) {
+  if (region_A_ptr_->code() == requesting_region_code) {
+    return region_B_ptr_;
+  } else if (region_B_ptr_->code() == requesting_region_code) {
+    return region_A_ptr_;
   } else {
     std::cerr <<"Error in dm_hsm::Link::otherRegion - region not correctly identified" << std::endl;
     std::terminate();
-    return std::weak_ptr<Region>();
+    return nullptr;
   }
 }
 
@@ -265,24 +342,24 @@ std::weak_ptr<Region> Link::otherRegion(const std::string& requesting_region_cod
 double Link::getImportCapacity(const dm_hsm::HSMCategory cat,
                           const aux::SimulationClock& clock,
                           const std::string& requesting_region_code,
-                          const std::weak_ptr<TransmissionConverter>& active_converter,
+                          TransmissionConverter* active_converter,
                           const double requested_max_import)  {
   //transmittable pwr is inflated request / efficiency of link
-  double transmittablePwrInfeed = active_converter.lock()->get_transmittable_pwr_infeed(clock, requested_max_import);
+  double transmittablePwrInfeed = active_converter->get_transmittable_pwr_infeed(clock, requested_max_import);
   //  std::cout << "Link::getImportCapacity:------------- "<<std::endl;
   //  std::cout << "\t| new transmittablePwr = " << transmittablePwrInfeed << " GW" << std::endl;
   if (transmittablePwrInfeed  > genesys::ProgramSettings::approx_epsilon()) {
     //check transmission converter direction - if fails -> return 0 else continue
-      if (requesting_region_code != region_A_ptr_.lock()->code()) {//forward operation A-->B
-        if (active_converter.lock()->is_active()){
-          if (active_converter.lock()->direction_forward()) {
+      if (requesting_region_code != region_A_ptr_->code()) {//forward operation A-->B
+        if (active_converter->is_active()){
+          if (active_converter->direction_forward()) {
           } else {
             return 0;
           }
         } //else continue to check import capacity
       } else {//backwards operation A-->B
-        if (active_converter.lock()->is_active()){
-          if (!active_converter.lock()->direction_forward()) {//!forward = backwards
+        if (active_converter->is_active()){
+          if (!active_converter->direction_forward()) {//!forward = backwards
           } else {
             return 0;
           }
@@ -292,7 +369,7 @@ double Link::getImportCapacity(const dm_hsm::HSMCategory cat,
      transmittablePwrInfeed = requestRegionExportLimit(cat,clock,transmittablePwrInfeed,otherRegion(requesting_region_code) );
      if (transmittablePwrInfeed > genesys::ProgramSettings::approx_epsilon()) {
        //       std::cout << "\t\t\t"<<  otherRegion(requesting_region_code).lock()->code() << " can supply " << regio_limit << " GW" << std::endl;
-       return active_converter.lock()->reserveTransmission(clock,transmittablePwrInfeed);
+       return active_converter->reserveTransmission(clock,transmittablePwrInfeed);
      } else {
        //std::cout << "\t\t\t"<<otherRegion(requesting_region_code).lock()->code() << " has no capacity " << std::endl;
      }
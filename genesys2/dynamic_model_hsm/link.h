@@ -35,6 +35,8 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <dynamic_model_hsm/hsm_category.h>
 #include <dynamic_model_hsm/transmission_converter.h>
@@ -49,18 +51,28 @@ class Link : public sm::Link {
   Link() = delete;
   virtual ~Link() override = default;
   Link(const Link& other);
-  Link(Link&& other) = delete; // if this move c'tor is needed, special implementation is necessary, taking care of correct handling of the weak pointers
+  Link(Link&& other); // region pointers are dropped as in the copy c'tor
   Link& operator=(const Link&) = delete;
   Link& operator=(Link&&) = delete;
   Link(const sm::Link& origin,
        const std::unordered_map<std::string, std::shared_ptr<Region> >& region);
-  void RegisterWithRegions(std::shared_ptr<Link> this_link) const;
+  void RegisterWithRegions();
 
   /** \name Reset interface.*/
   ///@{
   void resetCurrentTP(const aux::SimulationClock& clock);
+  void lowerKernel(aux::SimulationClock::time_point tp_start,
+                   aux::SimulationClock::time_point tp_end,
+                   aux::SimulationClock::duration tick_length);
+  void writeBackKernel();
   void set_annual_lookups(const aux::SimulationClock& clock);
   void resetSequencedLink(const aux::SimulationClock& clock);
+  void resetParametrisedLink(const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                      aux::SimulationClock::time_point,
+                                                                      aux::SimulationClock::time_point,
+                                                                      aux::SimulationClock::duration> >& installations);
+  void resetOperationLink();
+  void mergeOperationLink(const Link& other);
   void uncheck_active_current_year();
   void add_OaM_cost(aux::SimulationClock::time_point tp_now);
   ///@}
@@ -68,6 +80,7 @@ class Link : public sm::Link {
   /** \name Region Connectivity interface.*/
   ///@{
   void updateConverterHSMCategory(std::unordered_map<std::string, dm_hsm::HSMCategory>& keymap);
+  std::pair<std::string, std::string> connected_regions() const {return std::make_pair(region_A(), region_B());}
   ///@}
 
   /** \name hsm_operation Interface.*/
@@ -77,15 +90,14 @@ class Link : public sm::Link {
   double getImportCapacity(const dm_hsm::HSMCategory cat,
                            const aux::SimulationClock& clock,
                            const std::string& requesting_region_code,
-                           const std::weak_ptr<TransmissionConverter>& active_converter,
+                           TransmissionConverter* active_converter,
                            const double requested_max_import);
 
   bool useImportCapacity(const dm_hsm::HSMCategory cat,
                          const double import_request,
                          const aux::SimulationClock& clock,
                          const std::string& requesting_region_code,
-                         const std::weak_ptr<TransmissionConverter>& active_converter,
-                         const std::weak_ptr<Link>& active_Link );
+                         TransmissionConverter* active_converter);
 //  double getDiscountedValue(std::string query,
 //                            aux::SimulationClock::time_point start,
 //                            aux::SimulationClock::time_point end) const;
@@ -93,10 +105,14 @@ class Link : public sm::Link {
                             aux::SimulationClock::time_point start,
                             aux::SimulationClock::time_point end,
                             const aux::SimulationClock::time_point discount_present =
-                                               aux::SimulationClock::time_point_from_string("1970-01-01_00:00")) const;
+                                               aux::SimulationClock::time_point()) const; // 1970-01-01_00:00, discount to start
   double getSumValue(std::string query,
                      aux::SimulationClock::time_point start,
                      aux::SimulationClock::time_point end) const;
+  void accumulate_cost_metrics(aux::SimulationClock::time_point start,
+                               aux::SimulationClock::time_point end,
+                               const aux::SimulationClock::time_point discount_present,
+                               CostMetricTotals& totals) const;
   ///@}
   void calculated_annual_disc_capex(aux::SimulationClock::time_point start);
 
@@ -112,13 +128,15 @@ class Link : public sm::Link {
   double requestRegionExportLimit(const dm_hsm::HSMCategory cat,
                                   const aux::SimulationClock& clock,
                                   const double requestedExport,
-                                  const std::weak_ptr<Region>& supply_region);
+                                  Region* supply_region);
 
-  std::weak_ptr<Region> otherRegion(const std::string& requesting_region_code); ///< Identifies the opposing region_ptr to code_ of destinationRegion
+  Region* otherRegion(const std::string& requesting_region_code); ///< Identifies the opposing region_ptr to code_ of destinationRegion
+  void index_components();
 
   std::unordered_map<std::string, std::shared_ptr<TransmissionConverter> > converter_ptrs_;
-  std::weak_ptr<Region> region_A_ptr_;
-  std::weak_ptr<Region> region_B_ptr_;
+  std::vector<TransmissionConverter*> converter_index_; ///dense view of converter_ptrs_ for the loops per tp
+  Region* region_A_ptr_; ///owned by the DynamicModel, resolved once in the c'tor
+  Region* region_B_ptr_;
 };
 
 } /* namespace dm_hsm */
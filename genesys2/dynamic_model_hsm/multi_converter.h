@@ -41,7 +41,7 @@ class MultiConverter : public virtual sm::MultiConverter, public virtual Convert
  public:
   MultiConverter() = delete;
   virtual ~MultiConverter() = default;
-  MultiConverter(const MultiConverter& other)  // correct handling of weak pointer members not possible in this context
+  MultiConverter(const MultiConverter& other)  // the connections are not copied, they are resolved again by the owner
       : builder::SysCompActPrototype(other), // virtual inheritance and deleted default c'tor
         builder::ConverterPrototype(other), // virtual inheritance and deleted default c'tor
         builder::MultiConverterProto(other), // virtual inheritance and deleted default c'tor
@@ -53,11 +53,26 @@ class MultiConverter : public virtual sm::MultiConverter, public virtual Convert
         sm::MultiConverter(other),
         SysComponentActive(other), // virtual inheritance and deleted default c'tor
         Converter(other),
-        co2ptr_(),
+        co2_(nullptr),
         primary_energy_wptrs_(),
         storage_wptrs_(),
         co2_connected_(false){} // no connected copy possible
-  MultiConverter(MultiConverter&& other) = delete; // maybe also ok as default, but consider again weak pointer members before!
+  MultiConverter(MultiConverter&& other)  // the connections are dropped as in the copy c'tor
+      : builder::SysCompActPrototype(other), // virtual inheritance and deleted default c'tor
+        builder::ConverterPrototype(other), // virtual inheritance and deleted default c'tor
+        builder::MultiConverterProto(other), // virtual inheritance and deleted default c'tor
+        am::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+        am::Converter(other), // virtual inheritance and deleted default c'tor
+        am::MultiConverter(other), // virtual inheritance and deleted default c'tor
+        sm::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+        sm::Converter(other), // virtual inheritance and deleted default c'tor
+        sm::MultiConverter(other),
+        SysComponentActive(std::move(other)), // virtual inheritance and deleted default c'tor
+        Converter(std::move(other)),
+        co2_(nullptr),
+        primary_energy_wptrs_(),
+        storage_wptrs_(),
+        co2_connected_(false){} // no connected move possible
   MultiConverter& operator=(const MultiConverter&) = delete;
   MultiConverter& operator=(MultiConverter&&) = delete;
   MultiConverter(const sm::MultiConverter& origin)
@@ -72,7 +87,7 @@ class MultiConverter : public virtual sm::MultiConverter, public virtual Convert
           sm::MultiConverter(origin),
           SysComponentActive(origin), // virtual inheritance and deleted default c'tor
           Converter(origin),
-          co2ptr_(),
+          co2_(nullptr),
           primary_energy_wptrs_(),
           storage_wptrs_(),
           co2_connected_(false) {}
@@ -98,7 +113,7 @@ class MultiConverter : public virtual sm::MultiConverter, public virtual Convert
     ///@}
 
  private:
-  std::weak_ptr<PrimaryEnergy> co2ptr_;
+  PrimaryEnergy* co2_; //owned by the region or global, resolved once by connectCo2Reservoir
   std::pair<std::string, std::weak_ptr<PrimaryEnergy>> primary_energy_wptrs_;
   std::pair<std::string, std::weak_ptr<Storage>> storage_wptrs_;
   bool co2_connected_ = false;
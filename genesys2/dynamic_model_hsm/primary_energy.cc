@@ -59,14 +59,17 @@ void PrimaryEnergy::set_annual_lookups(const aux::SimulationClock& clock){
   //  }
 }
 
-void PrimaryEnergy::resetSequencedPrimaryEnergy(const aux::SimulationClock& clck) {
+void PrimaryEnergy::resetSequencedPrimaryEnergy(const aux::SimulationClock& clck,
+                                                aux::SimulationClock::time_point tp_end_seq) {
   //std::cout << "PrimaryEnergy::resetSequencedPrimaryEnergy " << code()<< " : " << aux::SimulationClock::time_point_to_string(clck.now())<< std::endl;
   annual_potential_ = 0.;
   annual_vopex_ = 0.;
   potential_current_tp_ = 0.;
   reserved_capacity_current_tp_ = 0.;
-  consumed_energy_ = aux::TimeSeriesConstAddable();
-  internal_vopex_ = aux::TimeSeriesConstAddable();
+  consumed_energy_.clear();
+  internal_vopex_.clear();
+  consumed_energy_.reserve(clck.now(), tp_end_seq, clck.tick_length());
+  internal_vopex_.reserve(clck.now(), tp_end_seq, clck.tick_length());
   total_consumed_ = 0.;
 }
 
@@ -114,14 +117,14 @@ void PrimaryEnergy::add_internal_counters (double request,const aux::SimulationC
   double vopex = request*cost(clock.now(), request);
   //std::cout << "\t\t vopex: " << vopex << " | for " << code() << std::endl;
   if (vopex > 1) { //check if cost are defined for respective timepoint
-      internal_vopex_ += aux::TimeSeriesConst(std::vector<double>{vopex,0.}, clock.now(),  clock.tick_length());
+      internal_vopex_.add_pulse(vopex, clock.now(),  clock.tick_length());
       //consumed_energy_ += aux::TimeSeriesConst(request_vec, clock.now(), clock.tick_length());
     } else {
-      internal_vopex_ += aux::TimeSeriesConst(std::vector<double>{0.,0.}, clock.now(),  clock.tick_length());
+      internal_vopex_.add_pulse(0., clock.now(),  clock.tick_length());
       //consumed_energy_ += aux::TimeSeriesConst(std::vector<double>{0.,0.}, clock.now(), clock.tick_length());
     }
   annual_potential_ -= request;
-  consumed_energy_ += aux::TimeSeriesConst(std::vector<double>{request, 0.}, clock.now(), clock.tick_length());
+  consumed_energy_.add_pulse(request, clock.now(), clock.tick_length());
   total_consumed_ += request;
 }
 
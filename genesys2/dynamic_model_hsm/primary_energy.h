@@ -32,7 +32,10 @@
 #ifndef DYNAMIC_MODEL_HSM_PRIMARY_ENERGY_H_
 #define DYNAMIC_MODEL_HSM_PRIMARY_ENERGY_H_
 
+#include <utility>
+
 #include <abstract_model/primary_energy.h>
+#include <auxiliaries/time_series_accumulator.h>
 
 namespace dm_hsm {
 
@@ -52,7 +55,17 @@ class PrimaryEnergy : public am::PrimaryEnergy {
                 consumed_energy_(other.consumed_energy_),
                 internal_vopex_(other.internal_vopex_),
                 total_consumed_(other.total_consumed_){}
-  PrimaryEnergy(PrimaryEnergy&&) = default;
+  PrimaryEnergy(PrimaryEnergy&& other)
+              : am::PrimaryEnergy(other),
+                connected_(false),
+                num_connections_(0),
+                annual_potential_(0.),
+                annual_vopex_(0.),
+                potential_current_tp_(other.potential_current_tp_),
+                reserved_capacity_current_tp_(other.reserved_capacity_current_tp_),
+                consumed_energy_(std::move(other.consumed_energy_)),
+                internal_vopex_(std::move(other.internal_vopex_)),
+                total_consumed_(other.total_consumed_){}
   PrimaryEnergy& operator=(const PrimaryEnergy&) = delete;
   PrimaryEnergy& operator=(PrimaryEnergy&&) = delete;
   PrimaryEnergy(const am::PrimaryEnergy& origin)
@@ -70,7 +83,7 @@ class PrimaryEnergy : public am::PrimaryEnergy {
   ///@{
   void resetCurrentTP(const aux::SimulationClock& clock);
   void set_annual_lookups(const aux::SimulationClock& clock);
-  void resetSequencedPrimaryEnergy (const aux::SimulationClock& clock);
+  void resetSequencedPrimaryEnergy (const aux::SimulationClock& clock, aux::SimulationClock::time_point tp_end_seq);
   ///@}
 
   /** \name Hierarchical Operation Functions.*/
@@ -110,8 +123,8 @@ class PrimaryEnergy : public am::PrimaryEnergy {
   double annual_vopex_;
   double potential_current_tp_;
   double reserved_capacity_current_tp_;
-  aux::TimeSeriesConstAddable consumed_energy_;  //monitoring the used energy
-  aux::TimeSeriesConstAddable internal_vopex_;
+  aux::TimeSeriesAccumulator consumed_energy_;  //monitoring the used energy
+  aux::TimeSeriesAccumulator internal_vopex_;
   double total_consumed_;
 };
 
@@ -39,6 +39,7 @@
 #include <utility>
 #include <tuple>
 #include <thread>
+#include <unordered_set>
 
 #include <auxiliaries/functions.h>
 #include <io_routines/csv_all.h>
@@ -81,7 +82,9 @@ Region::Region(const sm::Region& origin)
       residual_heat_TP_(0.),
       reserved_residual_load_tp_(0.),
       available_power_for_export_(0.),
-      max_pwr_exchange_grid_tp_(0.){
+      max_pwr_exchange_grid_tp_(0.),
+      merit_order_(),
+      merit_order_outdated_(true) {
   //std::cout << "DEBUG: dm::region::region ctor" << std::endl;
   for (const auto& it : primary_energy_ptrs())
     primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(*it.second)));
@@ -100,6 +103,8 @@ Region::Region(const sm::Region& origin)
       storage_ptrs_.emplace(it.first, std::shared_ptr<Storage>(new Storage(*it.second)));
     }
   }
+  attach_storage_state();
+  index_components();
 }
 
 Region::Region(const Region& other)
@@ -135,7 +140,9 @@ Region::Region(const Region& other)
       residual_heat_TP_(other.residual_heat_TP_),
       reserved_residual_load_tp_(other.reserved_residual_load_tp_),
       available_power_for_export_(other.available_power_for_export_),
-      max_pwr_exchange_grid_tp_(other.max_pwr_exchange_grid_tp_){
+      max_pwr_exchange_grid_tp_(other.max_pwr_exchange_grid_tp_),
+      merit_order_(),
+      merit_order_outdated_(true) {
   //std::cout << "DEBUG: CopyC-Tor dm::Region::Region" << std::endl;
   if (!other.converter_ptrs_.empty()) {
     for (const auto &it : other.converter_ptrs_) {
@@ -150,11 +157,84 @@ Region::Region(const Region& other)
     for (const auto &it : other.storage_ptrs_)
         storage_ptrs_.emplace(it.first, std::shared_ptr<Storage>(new Storage(*it.second)));
   }
+  attach_storage_state();
   if (!other.primary_energy_ptrs_.empty()) {
       for (const auto &it : other.primary_energy_ptrs_)
         primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(
             new PrimaryEnergy(*it.second)));
   }
+  index_components();
+}
+
+Region::Region(Region&& other)
+    : sm::Region(other),
+      map_reserved_exports_tp_(),
+      annual_co2_emissions_(std::move(other.annual_co2_emissions_)),
+      annual_consumed_heat_GWh_(std::move(other.annual_consumed_heat_GWh_)),
+      annual_generated_heat_GWh_(std::move(other.annual_generated_heat_GWh_)),
+      annual_imported_electricity_GWh_(std::move(other.annual_imported_electricity_GWh_)),
+      annual_imported_gas_GWh_(std::move(other.annual_imported_gas_GWh_)),
+      annual_exported_electricity_GWh_(std::move(other.annual_exported_electricity_GWh_)),
+      annual_exported_gas_GWh_(std::move(other.annual_exported_gas_GWh_)),
+      annual_selfsupply_quota_(std::move(other.annual_selfsupply_quota_)),
+      annual_unsupplied_electricity_(std::move(other.annual_unsupplied_electricity_)),
+      residual_load_(std::move(other.residual_load_)),
+      residual_heat_(std::move(other.residual_heat_)),
+      remaining_residual_load_(std::move(other.remaining_residual_load_)),
+      remaining_residual_heat_load_(std::move(other.remaining_residual_heat_load_)),
+      co2_emissions_(std::move(other.co2_emissions_)),
+      exported_energy_(std::move(other.exported_energy_)),
+      exported_electricity_(std::move(other.exported_electricity_)),
+      exported_gas_(std::move(other.exported_gas_)),
+      imported_energy_(std::move(other.imported_energy_)),
+      imported_electricity_(std::move(other.imported_electricity_)),
+      imported_gas_(std::move(other.imported_gas_)),
+      import_for_local_balance_(std::move(other.import_for_local_balance_)),
+      RL_init_(other.RL_init_),
+      HEAT_init_(other.HEAT_init_),
+      connected_to_grid_(other.connected_to_grid_),
+      supply_region_(other.supply_region_),
+      balanced_(other.balanced_),
+      residual_load_TP_(other.residual_load_TP_),
+      residual_heat_TP_(other.residual_heat_TP_),
+      reserved_residual_load_tp_(other.reserved_residual_load_tp_),
+      available_power_for_export_(other.available_power_for_export_),
+      max_pwr_exchange_grid_tp_(other.max_pwr_exchange_grid_tp_),
+      merit_order_(),
+      merit_order_outdated_(true) {
+  for (const auto &it : other.converter_ptrs_) {
+    if (auto multi_conv = std::dynamic_pointer_cast<dm_hsm::MultiConverter>(it.second)) {
+      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(new MultiConverter(std::move(*multi_conv))));
+    } else {
+      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(new Converter(std::move(*it.second))));
+    }
+  }
+  for (const auto &it : other.storage_ptrs_)
+    storage_ptrs_.emplace(it.first, std::shared_ptr<Storage>(new Storage(std::move(*it.second))));
+  attach_storage_state();
+  for (const auto &it : other.primary_energy_ptrs_)
+    primary_energy_ptrs_.emplace(it.first, std::shared_ptr<PrimaryEnergy>(new PrimaryEnergy(std::move(*it.second))));
+  index_components();
+}
+
+void Region::attach_storage_state() {
+  storage_state_ = std::make_shared<StorageState>();
+  for (auto& it : storage_ptrs_)
+    it.second->attach_state(storage_state_);
+}
+
+void Region::index_components() {
+  //The maps own the components and serve the lookups by code, the loops per tp run over these views.
+  //Map order is kept, the maps are only filled in the c'tors.
+  primary_energy_index_.clear();
+  for (const auto& it : primary_energy_ptrs_)
+    primary_energy_index_.push_back(it.second.get());
+  converter_index_.clear();
+  for (const auto& it : converter_ptrs_)
+    converter_index_.push_back(it.second.get());
+  storage_index_.clear();
+  for (const auto& it : storage_ptrs_)
+    storage_index_.push_back(it.second.get());
 }
 
 void Region::updateConverterHSMCategory(std::unordered_map<std::string, dm_hsm::HSMCategory>& keymap) const {
@@ -264,6 +344,14 @@ void Region::connectGlobalReservoirs(std::string output_type,std::shared_ptr<Pri
 
 }
 
+bool Region::has_multi_converter() const {
+  for (const auto& it : converter_ptrs_) {
+    if (it.second->is_multi_converter())
+      return true;
+  }
+  return false;
+}
+
 void Region::connectReservoirs() {
   //  std::cout << "FUNC-ID:  Region::connectReservoirs() in " << code() << std::endl;
   if (!converter_ptrs_.empty()){
@@ -312,16 +400,16 @@ void Region::connectReservoirs() {
 	  }
 }
 
-void Region::connectLink(std::weak_ptr<Link> link,
+void Region::connectLink(Link* link,
                          const std::unordered_map<std::string,
                                                   std::shared_ptr<TransmissionConverter> >& converter_ptrs) {
   //DEBUG std::cout << "FUNC: Region::connectLink" << std::endl;
   for (const auto& it : converter_ptrs) {
     if (it.second->get_input() == "electric_energy") {
-      line_map_el_.emplace(link.lock()->code() + "." + it.first, std::make_pair(std::move(link.lock()), it.second));
+      line_map_el_.emplace(link->code() + "." + it.first, std::make_pair(link, it.second.get()));
     } else if (it.second->get_input() == "methane") {
       //std::cout << "connecting methane - link: "<< link.lock()->code() << std::endl;
-      line_map_ch4_.emplace(link.lock()->code() + "." + it.first, std::make_pair(std::move(link.lock()), it.second));
+      line_map_ch4_.emplace(link->code() + "." + it.first, std::make_pair(link, it.second.get()));
     }
   }
 }
@@ -341,25 +429,28 @@ void Region::calculateResidualLoad(dm_hsm::HSMCategory category,
   if (!RL_init_) {
     //simulationclock to iterate along timeseries
     aux::SimulationClock sub_sim_clock(tp_start_seq, tick_length);//tp_start_seq
-    std::vector<double> residual_load;
+    std::size_t ticks = 0;
     do {
-      ///Calculate residualLoad(RL) from the load and subtract the converter power of the activated category.
-      double generation_tp = 0;
-      if (!converter_ptrs_.empty()){
-		  for (auto& it : converter_ptrs_) {
-			if (it.second->get_HSMCategory() == category) {
-			  generation_tp += it.second->generation_fromPotential(sub_sim_clock);//generation = capcity * ts_generation_potential
-			}
-		  }
-		  // std::cout << "Demand: " << demand_electric(sub_sim_clock.now())  << " GW generation " << generation_tp << " GW " << std::endl;
-		  residual_load.push_back(demand_electric(sub_sim_clock.now()) - generation_tp);
-      }
-    // DEBUG
-	//       std::cout << "tick: " << aux::SimulationClock::time_point_to_string(sub_sim_clock.now())
-	//       	   	   	 << "generation = " << generation_tp << " and RL = "
-	//				 << residual_load.back() << std::endl;
-    //*/
+      ++ticks;
     } while (sub_sim_clock.tick() < tp_end_seq);
+    ///Calculate residualLoad(RL) from the load and subtract the converter power of the activated category.
+    ///Each converter delivers its generation for the whole sequence at once, summed per tick in map order.
+    std::vector<double> residual_load;
+    if (!converter_ptrs_.empty()) {
+      std::vector<double> generation(ticks, 0.);
+      std::vector<double> generation_conv(ticks);
+      for (auto& it : converter_ptrs_) {
+        if (it.second->get_HSMCategory() == category) {
+          it.second->generation_fromPotential(tp_start_seq, tick_length, generation_conv);
+          for (std::size_t i = 0; i < ticks; ++i)
+            generation[i] += generation_conv[i];
+        }
+      }
+      residual_load.resize(ticks);
+      demand_electric(tp_start_seq, tick_length, ticks, residual_load.data());
+      for (std::size_t i = 0; i < ticks; ++i)
+        residual_load[i] -= generation[i];
+    }
     residual_load.push_back(0.0);//end of the timeSeries=const=0
     residual_load_ += aux::TimeSeriesConst(residual_load, tp_start_seq, tick_length);
     RL_init_ = true;
@@ -391,7 +482,7 @@ void Region::init_heat_load(aux::SimulationClock::time_point tp_start_seq,
   //  std::cout << "REACHED END OF FUNC-ID: Region::init_heat_load\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<<std::endl;
 }
 
-void Region::resetSequencedRegion(const aux::SimulationClock& clock) {
+void Region::resetSequencedRegion(const aux::SimulationClock& clock, aux::SimulationClock::time_point tp_end_seq) {
   //std::cout << "FUNC-ID: Region::resetSequencedRegion"<< std::endl;
   //do not reset all variables!
 
@@ -404,12 +495,12 @@ void Region::resetSequencedRegion(const aux::SimulationClock& clock) {
   if (!storage_ptrs_.empty()) {
     //reset all storages
     for (auto &it : storage_ptrs_) {
-       it.second->ResetSequencedStorage(clock);
+       it.second->ResetSequencedStorage(clock, tp_end_seq);
     }
   }
   if(!primary_energy_ptrs_.empty()) {
     for (auto &it : primary_energy_ptrs_) {
-      it.second->resetSequencedPrimaryEnergy(clock);
+      it.second->resetSequencedPrimaryEnergy(clock, tp_end_seq);
     }
   }
    //reset variables in region with hourly values
@@ -422,34 +513,183 @@ void Region::resetSequencedRegion(const aux::SimulationClock& clock) {
      residual_heat_TP_ = 0;
    }
    //RESET TSCA Members to dummies
-   residual_load_ = aux::TimeSeriesConstAddable();
-   residual_heat_ = aux::TimeSeriesConstAddable();
-   remaining_residual_load_ = aux::TimeSeriesConstAddable();
-   remaining_residual_heat_load_ = aux::TimeSeriesConstAddable();
-   co2_emissions_ = aux::TimeSeriesConstAddable();
-   imported_energy_ = aux::TimeSeriesConstAddable();
-   exported_electricity_ = aux::TimeSeriesConstAddable();
-   exported_gas_ = aux::TimeSeriesConstAddable();
-   imported_electricity_ = aux::TimeSeriesConstAddable();
-   imported_gas_ = aux::TimeSeriesConstAddable();
+   residual_load_.clear();
+   residual_heat_.clear();
+   remaining_residual_load_.clear();
+   remaining_residual_heat_load_.clear();
+   co2_emissions_.clear();
+   imported_energy_.clear();
+   exported_electricity_.clear();
+   exported_gas_.clear();
+   imported_electricity_.clear();
+   imported_gas_.clear();
+   //the ledgers written in every tick keep their storage for all ticks of the sequence
+   exported_electricity_.reserve(clock.now(), tp_end_seq, clock.tick_length());
+   imported_electricity_.reserve(clock.now(), tp_end_seq, clock.tick_length());
 }
 
-void Region::resetCurrentTP(const aux::SimulationClock& clock){
-  if(!converter_ptrs_.empty()){
-    for( auto&&it : converter_ptrs_){
-      it.second->resetCurrentTP(clock);
+void Region::resetParametrisedRegion(const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                                                aux::SimulationClock::time_point,
+                                                                                                aux::SimulationClock::time_point,
+                                                                                                aux::SimulationClock::duration> >& installations) {
+  //std::cout << "FUNC-ID: Region::resetParametrisedRegion"<< std::endl;
+  //the components of the abstract model level hold the installations without parametrisation
+  std::unordered_set<std::string> applied_installations; //each entry is applied once, as by erasing it
+  for (const auto& it : am::Region::converter_ptrs()) {
+    auto conv = get_pointer_to<Converter>(converter_ptrs_, it.first);
+    if (!conv) {
+      std::cerr << "ERROR in dm_hsm::Region::resetParametrisedRegion :" << std::endl
+          << "converter " << it.first << " not found in region " << name() << ", " << code() << std::endl;
+      std::terminate();
+    }
+    auto converter_pos = installations.find(it.first);
+    if (converter_pos != installations.end() && applied_installations.insert(it.first).second) {
+      conv->resetParametrisedSysComponent(*it.second, converter_pos->second);
+    } else {
+      conv->resetParametrisedSysComponent(*it.second);
     }
+    conv->ResetParametrisedConverter();
   }
-  if(!storage_ptrs_.empty()){
-    for( auto&&it : storage_ptrs_){
-      it.second->ResetStorageCurrentTP(clock);
+  for (const auto& it : am::Region::multi_converter_ptrs()) {
+    auto conv = get_pointer_to<Converter>(converter_ptrs_, it.first);
+    if (!conv) {
+      std::cerr << "ERROR in dm_hsm::Region::resetParametrisedRegion :" << std::endl
+          << "converter " << it.first << " not found in region " << name() << ", " << code() << std::endl;
+      std::terminate();
+    }
+    auto multi_conv_pos = installations.find(it.first);
+    if (multi_conv_pos != installations.end() && applied_installations.insert(it.first).second) {
+      conv->resetParametrisedSysComponent(*it.second, multi_conv_pos->second);
+    } else {
+      conv->resetParametrisedSysComponent(*it.second);
     }
+    conv->ResetParametrisedConverter();
   }
-  if(!primary_energy_ptrs_.empty()) {
-    for (auto&& it : primary_energy_ptrs_) {
-      it.second->resetCurrentTP(clock);
+  for (const auto& it : am::Region::storage_ptrs()) {
+    auto storage = get_pointer_to<Storage>(storage_ptrs_, it.first);
+    if (!storage) {
+      std::cerr << "ERROR in dm_hsm::Region::resetParametrisedRegion :" << std::endl
+          << "storage " << it.first << " not found in region " << name() << ", " << code() << std::endl;
+      std::terminate();
+    }
+    auto storage_pos = installations.find(it.first);
+    if (storage_pos != installations.end() && applied_installations.insert(it.first).second) {
+      storage->resetParametrisedSysComponent(*it.second, storage_pos->second);
+    } else {
+      storage->resetParametrisedSysComponent(*it.second);
     }
+    storage->ResetParametrisedStorage();
+  }
+  if (applied_installations.size() != installations.size()) {
+    std::cerr << "ERROR in dm_hsm::Region::resetParametrisedRegion : installation list contained invalid entries for "
+              << code() << std::endl;
+    std::terminate();
+  }
+  resetPersistingValues();
+}
+
+void Region::resetOperationRegion() {
+  //same as resetParametrisedRegion, but the current installations are kept
+  for (auto& it : converter_ptrs_) {
+    it.second->resetOperationSysComponent();
+    it.second->ResetParametrisedConverter();
+  }
+  for (auto& it : storage_ptrs_) {
+    it.second->resetOperationSysComponent();
+    it.second->ResetParametrisedStorage();
+  }
+  resetPersistingValues();
+}
+
+void Region::mergeOperationRegion(const Region& other) {
+  //add the values kept between sequences from a copy of this region operated on a different time window
+  for (auto& it : converter_ptrs_) {
+    auto other_pos = other.converter_ptrs_.find(it.first);
+    if (other_pos == other.converter_ptrs_.end()) {
+      std::cerr << "ERROR in dm_hsm::Region::mergeOperationRegion : converter " << it.first << " not found in other "
+                << code() << std::endl;
+      std::terminate();
+    }
+    it.second->MergeOperationConverter(*other_pos->second);
+  }
+  for (auto& it : storage_ptrs_) {
+    auto other_pos = other.storage_ptrs_.find(it.first);
+    if (other_pos == other.storage_ptrs_.end()) {
+      std::cerr << "ERROR in dm_hsm::Region::mergeOperationRegion : storage " << it.first << " not found in other "
+                << code() << std::endl;
+      std::terminate();
+    }
+    it.second->MergeOperationStorage(*other_pos->second);
+  }
+  annual_co2_emissions_.add_series(other.annual_co2_emissions_);
+  annual_consumed_heat_GWh_.add_series(other.annual_consumed_heat_GWh_);
+  annual_generated_heat_GWh_.add_series(other.annual_generated_heat_GWh_);
+  annual_imported_electricity_GWh_.add_series(other.annual_imported_electricity_GWh_);
+  annual_imported_gas_GWh_.add_series(other.annual_imported_gas_GWh_);
+  annual_exported_electricity_GWh_.add_series(other.annual_exported_electricity_GWh_);
+  annual_exported_gas_GWh_.add_series(other.annual_exported_gas_GWh_);
+  annual_selfsupply_quota_.add_series(other.annual_selfsupply_quota_);
+  annual_unsupplied_electricity_.add_series(other.annual_unsupplied_electricity_);
+  remaining_excess_heat_.add_series(other.remaining_excess_heat_);
+  exported_energy_.add_series(other.exported_energy_);
+  import_for_local_balance_.add_series(other.import_for_local_balance_);
+}
+
+void Region::get_stored_energy_transfer(std::unordered_map<std::string, double>& transfer) const {
+  for (const auto& it : storage_ptrs_) {
+    transfer[code() + "." + it.first] = it.second->stored_energy_transfer();
   }
+}
+
+void Region::get_initial_stored_energy(aux::SimulationClock::time_point tp,
+                                       std::unordered_map<std::string, double>& stored_energy) const {
+  for (const auto& it : storage_ptrs_) {
+    stored_energy[code() + "." + it.first] = it.second->initial_stored_energy(tp);
+  }
+}
+
+void Region::set_stored_energy_transfer(const std::unordered_map<std::string, double>& transfer) {
+  for (auto& it : storage_ptrs_) {
+    auto transfer_pos = transfer.find(code() + "." + it.first);
+    if (transfer_pos != transfer.end())
+      it.second->set_stored_energy_transfer(transfer_pos->second);
+  }
+}
+
+void Region::resetPersistingValues() {
+  //reset all variables that are kept between sequences
+  map_reserved_exports_tp_.clear();
+  merit_order_outdated_ = true;
+  annual_co2_emissions_.clear();
+  annual_consumed_heat_GWh_.clear();
+  annual_generated_heat_GWh_.clear();
+  annual_imported_electricity_GWh_.clear();
+  annual_imported_gas_GWh_.clear();
+  annual_exported_electricity_GWh_.clear();
+  annual_exported_gas_GWh_.clear();
+  annual_selfsupply_quota_.clear();
+  annual_unsupplied_electricity_.clear();
+  remaining_excess_heat_.clear();
+  exported_energy_.clear();
+  import_for_local_balance_.clear();
+  RL_init_ = false;
+  HEAT_init_ = false;
+  supply_region_ = false;
+  balanced_ = false;
+  residual_load_TP_ = 0.;
+  residual_heat_TP_ = 0.;
+  reserved_residual_load_tp_ = 0.;
+  available_power_for_export_ = 0.;
+  max_pwr_exchange_grid_tp_ = 0.;
+}
+
+void Region::resetCurrentTP(const aux::SimulationClock& clock){
+  for (auto converter : converter_index_)
+    converter->resetCurrentTP(clock);
+  for (auto storage : storage_index_)
+    storage->ResetStorageCurrentTP(clock);
+  for (auto primary_energy : primary_energy_index_)
+    primary_energy->resetCurrentTP(clock);
   //copy RL to local double
   residual_load_TP_ = residual_load_[clock];
   //std::cout << "residual load original: " << residual_load_TP_ << std::endl;
@@ -462,27 +702,32 @@ void Region::resetCurrentTP(const aux::SimulationClock& clock){
   reserved_residual_load_tp_ = 0.;
   map_reserved_exports_tp_.clear();
   max_pwr_exchange_grid_tp_ = 0.;
+  grid_lines_current_ = false;
 }
 
-void Region::set_annual_lookups(const aux::SimulationClock& clock){
-	if(!primary_energy_ptrs_.empty()) {
-	    for (auto& it : primary_energy_ptrs_) {
-	      it.second->set_annual_lookups(clock);
-	    }
-    }
-	if(!converter_ptrs_.empty()) {
-		for(const auto& it : converter_ptrs_){
-			it.second->set_annaul_lookups(clock);
-
-		}
-	}
+void Region::lowerKernel(aux::SimulationClock::time_point tp_start,
+                         aux::SimulationClock::time_point tp_end,
+                         aux::SimulationClock::duration tick_length) {
+  for (auto converter : converter_index_)
+    converter->lowerKernel(tp_start, tp_end, tick_length);
+  for (auto storage : storage_index_)
+    storage->lowerKernel(tp_start, tp_end, tick_length, false); //the capacity is kept in the StorageState
+}
 
-	if(!storage_ptrs_.empty()) {
-		for(const auto& it : storage_ptrs_){
-			it.second->set_annaul_lookups(clock);
+void Region::writeBackKernel() {
+  for (auto converter : converter_index_)
+    converter->writeBackKernel();
+  for (auto storage : storage_index_)
+    storage->writeBackKernel();
+}
 
-		}
-	}
+void Region::set_annual_lookups(const aux::SimulationClock& clock){
+	for (auto primary_energy : primary_energy_index_)
+	  primary_energy->set_annual_lookups(clock);
+	for (auto converter : converter_index_)
+	  converter->set_annaul_lookups(clock);
+	for (auto storage : storage_index_)
+	  storage->set_annaul_lookups(clock);
 	//	if(max_demand_current_year_ > genesys::ProgramSettings::approx_epsilon()){// do not execute in first year!
 	//		annual_max_demand_ += aux::TimeSeriesConst(std::vector<double>{max_demand_current_year_, 0.0},
 	//		                                                                      clock.now()-aux::years(1),
@@ -490,13 +735,13 @@ void Region::set_annual_lookups(const aux::SimulationClock& clock){
 	//		std::cout << aux::SimulationClock::time_point_to_string(clock.now())<< "Region " << code() << " | max demand last year = " << max_demand_current_year_ << " GW" << std::endl;
 	//	}
 	//	max_demand_current_year_ = 0.;
-
+	merit_order_outdated_ = true; //sorted on next use, after the lookups of the global reservoirs are updated as well
 }
 
 void Region::set_annual_unsupplied(double unsupplied_el_gwh, aux::SimulationClock::time_point tp){
-  annual_unsupplied_electricity_ += aux::TimeSeriesConst(std::vector<double>{unsupplied_el_gwh,0.0},
-                                                   tp,
-                                                   aux::years(1));
+  annual_unsupplied_electricity_.add_pulse(unsupplied_el_gwh,
+                                           tp,
+                                           aux::years(1));
 }
 
 void Region::decommission_plants(){
@@ -507,30 +752,25 @@ void Region::decommission_plants(){
       it.second->check_for_decommission();
     }
   }
+  merit_order_outdated_ = true;
 
 }
 
 void Region::uncheck_active_current_year(){
-	if(!converter_ptrs_.empty()){
-	    for(const auto&it : converter_ptrs_){
-	      if (it.second->get_HSMCategory() != HSMCategory::UNAVAILABLE ){
-	    	  it.second->uncheck_active_current_year();
-	      }
-	    }
-	}
-	if(!storage_ptrs_.empty()){
-	    for(const auto&it : storage_ptrs_){
-	     it.second->uncheck_active_current_year();
-	    }
+	for (auto converter : converter_index_) {
+	  if (converter->get_HSMCategory() != HSMCategory::UNAVAILABLE )
+	    converter->uncheck_active_current_year();
 	}
+	for (auto storage : storage_index_)
+	  storage->uncheck_active_current_year();
 }
 
 void Region::add_OaM_cost(aux::SimulationClock::time_point tp_now) {
   //DEBUG std::cout << "add OaM for active component " << it.first << " tp: " << aux::SimulationClock::time_point_to_string((clock.now()-aux::years(1))) << std::endl;
   //std::cout << "add OaM for active component " << it.first << " tp: " << aux::SimulationClock::time_point_to_string((clock.now()-aux::years(1))) << std::endl;
-	if (!converter_ptrs_.empty()) {
-		for (const auto&it : converter_ptrs_) {
-		  it.second->add_OaM_cost(tp_now);
+	if (!converter_index_.empty()) {
+		for (auto converter : converter_index_) {
+		  converter->add_OaM_cost(tp_now);
 		  //TODO DECOMMISSIONING - use flag active_current_year to destinguish! ***CODE NOT FINISHED!
 		  //		  if (it.second->active_current_year()) {
       //		    std::cout << aux::SimulationClock::time_point_to_string(tp_now) << " = active_current_year : "<< it.second->code()  << " | in " <<code()<< std::endl;
@@ -548,9 +788,9 @@ void Region::add_OaM_cost(aux::SimulationClock::time_point tp_now) {
       //      }
 		}
   }
-	if (!storage_ptrs_.empty()) {
-		for (const auto&it : storage_ptrs_) {
-		  it.second->add_OaM_cost(tp_now);
+	if (!storage_index_.empty()) {
+		for (auto storage : storage_index_) {
+		  storage->add_OaM_cost(tp_now);
 		  //TODO DECOMMISSIONING - use flag active_current_year to destinguish!  ***CODE NOT FINISHED!
       //			if (it.second->active_current_year()) {
       //				it.second->add_OaM_cost(tp_now);
@@ -562,8 +802,8 @@ void Region::add_OaM_cost(aux::SimulationClock::time_point tp_now) {
 }
 
 void Region::activate_mustrun(const aux::SimulationClock& clock) {
-  for (auto&& it : converter_ptrs_) {
-    auto hsm_cat = it.second->get_HSMCategory();
+  for (auto converter : converter_index_) {
+    auto hsm_cat = converter->get_HSMCategory();
     if (hsm_cat == dm_hsm::HSMCategory::CONV_MUSTRUN) {
         std::cout << "Region::activate_mustrun - not implemented for CONV_MUSTRUN" << std::endl;
         //it.second->useConverterOutputMustrun(clock);
@@ -648,15 +888,33 @@ void Region::balance_start(int hops,
       auto import = balance(hops, std::min(max_pwr_exchange_grid_tp_, residual_load_TP_), cat, clock);
       residual_load_TP_ -= import;
       if(import > 0)
-        import_for_local_balance_ += aux::TimeSeriesConst(std::vector<double>{import, 0.0},
-                                  clock.now(),
-                                  clock.tick_length() );
+        import_for_local_balance_.add_pulse(import,
+                                            clock.now(),
+                                            clock.tick_length() );
 	  }
   } else {
     //DEBUG    std::cout << code() << " DEBUG: RL < 0 no balance necessary!" << std::endl;
   }
 }
 
+void Region::proposeGridLines(const aux::SimulationClock& clock) {
+  //Capacity and efficiency of the lines are fixed within a tp, so the candidates of all hop levels and categories are
+  //collected once per tp. With parallel_grid_balance DynamicModel::generalised_balance() calls this for all regions
+  //before the batches run, otherwise the first balance() of the tp does.
+  if (grid_lines_current_)
+    return;
+  grid_lines_.clear();
+  for (const auto& it : line_map_el_) {
+    auto converter = it.second.second;
+    if (converter->get_capacity(clock) > genesys::ProgramSettings::approx_epsilon()) //only if any capacity on the link
+      grid_lines_.push_back(GridLine{converter->get_efficiency(clock), it.second.first, converter});
+  }
+  //stable: lines of equal efficiency keep the order of line_map_el_
+  std::stable_sort(grid_lines_.begin(), grid_lines_.end(),
+                   [](const GridLine& a, const GridLine& b) {return a.efficiency > b.efficiency;});
+  grid_lines_current_ = true;
+}
+
 void Region::setTransferStoredEnergy(const aux::SimulationClock& clock) {
   for (auto &it : storage_ptrs_) {
     it.second->setTransferStoredEnergy(clock);
@@ -668,7 +926,7 @@ double Region::getDiscountedValue(std::string query,
                                   aux::SimulationClock::time_point end,
                                   const aux::SimulationClock::time_point discount_present) const{
   aux::SimulationClock::time_point present;
-    if (discount_present == aux::SimulationClock::time_point_from_string("1970-01-01_00:00")){
+    if (discount_present == aux::SimulationClock::time_point()){ // default 1970-01-01_00:00
       present = start;
     } else {
       present = discount_present;
@@ -739,6 +997,35 @@ double Region::get_sum(std::string query,
   return (sum_value);
 }
 
+void Region::accumulate_cost_metrics(aux::SimulationClock::time_point start,
+                                     aux::SimulationClock::time_point end,
+                                     const aux::SimulationClock::time_point discount_present,
+                                     CostMetricTotals& totals) const {
+  aux::SimulationClock::time_point present;
+  if (discount_present == aux::SimulationClock::time_point()){ // default 1970-01-01_00:00
+    present = start;
+  } else {
+    present = discount_present;
+  }
+  auto energy_data = calc_energy_vector(start, end);
+  auto annual_energy = aux::TimeSeriesConst(std::get<0>(energy_data),
+                                            std::get<1>(energy_data),
+                                            aux::years(1));
+  totals.add_sum(CostMetric::ENERGY, aux::sum(annual_energy, start, end, aux::years(1)));
+  totals.add_discounted(CostMetric::ENERGY, aux::DiscountFuture2(annual_energy,
+                                                                 start,
+                                                                 end,
+                                                                 aux::years(1),
+                                                                 genesys::ProgramSettings::interest_rate(),
+                                                                 present));
+  for (const auto& it : converter_ptrs_) {
+    it.second->accumulate_cost_metrics(start, end, present, totals);
+  }
+  for (const auto& it : storage_ptrs_) {
+    it.second->accumulate_cost_metrics(start, end, present, totals);
+  }
+}
+
 void Region::calculated_annual_disc_capex(aux::SimulationClock::time_point start) {
   //std::cout << "FUNC-ID: Region::calculated_annual_capex" << std::endl;
   if (!converter_ptrs_.empty()) {
@@ -767,19 +1054,20 @@ double Region::getExportCapacity(const dm_hsm::HSMCategory cat,
       //      std::cout << "\t\tDEBUG: RL-Reserved= " << reserved_residual_load_tp_ << std::endl;
     }
   } else {
-    std::multimap<double, std::weak_ptr<dm_hsm::Converter>, std::greater<double> > efficient_converters = collectConverter(cat,
-                                                                                                                           clock);
+    const auto& efficient_converters = collectConverter(cat, clock);
     double remaining_request = exportRequest;
     //    std::cout << "\tDEBUG: remaining_request= " << remaining_request << " | init"<< std::endl;
-    for (auto &it : efficient_converters) { //do not use it.first, for sorting purposes only!
+    for (auto &it : efficient_converters) {
+      if (!usable_in_merit_order(*it, cat, clock))
+        continue;
       if (remaining_request > genesys::ProgramSettings::approx_epsilon()){
-      auto storage_type = it.second.lock()->get_HSMSubCategory();
+      auto storage_type = it->get_HSMSubCategory();
         if ((storage_type == dm_hsm::HSMSubCategory::BICHARGER) || (storage_type == dm_hsm::HSMSubCategory::DISCHARGER)) {
           //check usable_power != usable capacity to consider the storage/primary energy source
-          auto power_output = it.second.lock()->reserveDischarger(clock, exportRequest);
+          auto power_output = it->reserveDischarger(clock, exportRequest);
           if (power_output > genesys::ProgramSettings::approx_epsilon()){
-            //          std::cout << "\tmap_reserved_export inserting: code: " << it.second.lock()->code() << " with capacity: " << power_output << " | of total " << it.second.lock()->usable_capacity_out_tp() << std::endl;
-            map_reserved_exports_tp_.emplace(power_output, it.second.lock());
+            //          std::cout << "\tmap_reserved_export inserting: code: " << it->code() << " with capacity: " << power_output << " | of total " << it->usable_capacity_out_tp() << std::endl;
+            map_reserved_exports_tp_.emplace(power_output, it.get());
             //std::cout << "\tmap_reserved_converter contains " << map_reserved_exports_tp_.size() << " elements!" << std::endl;
             remaining_request -= power_output;
           } //DEBUG else if (power_output != 0.){ std::cout << "***\t\tpower out small = " << power_output << std::endl;}
@@ -795,15 +1083,15 @@ double Region::getExportCapacity(const dm_hsm::HSMCategory cat,
 bool Region::useExportCapacity(const dm_hsm::HSMCategory cat,
                                    const double export_request,
                                    const aux::SimulationClock& clock,
-                                   const std::weak_ptr<Link>&) {
+                                   const Link*) {
   //std::cout << "FUNC-ID: Region::useExportCapacity with request = " << export_request << std::endl;
   bool request_ok = false;
   if (cat == dm_hsm::HSMCategory::RE_GENERATOR) {  //std::cout << "\tRE Generator: RL-Balancing" << std::endl;
     if (!(reserved_residual_load_tp_ < export_request ) || !(export_request > residual_load_TP_)) {
       residual_load_TP_ -= export_request;
-      exported_electricity_ += aux::TimeSeriesConst(std::vector<double>{export_request,0.0},
-                                                    clock.now(),
-                                                    clock.tick_length());
+      exported_electricity_.add_pulse(export_request,
+                                      clock.now(),
+                                      clock.tick_length());
       reserved_residual_load_tp_ = 0.;
       request_ok = true;
     }
@@ -817,11 +1105,11 @@ bool Region::useExportCapacity(const dm_hsm::HSMCategory cat,
             /* Heat Integrationsversuch: kja
             if (it.second.lock()->useConverterOutput(clock, remaining_request, "electric_energy")) {
             */
-            if (it.second.lock()->useConverterOutput(clock, remaining_request)) {
+            if (it.second->useConverterOutput(clock, remaining_request)) {
               remaining_request -=current_request;
             } else {
               std::cout <<aux::SimulationClock::time_point_to_string(clock.now())<<
-                          " => Region::useExportCapacity: failed in " << code() << " for " << it.second.lock()->code() << std::endl;
+                          " => Region::useExportCapacity: failed in " << code() << " for " << it.second->code() << std::endl;
             }
             map_reserved_exports_tp_.erase(it.first);//remove used item from map!
         } //all entries of map iterated. map shoudl have size 0 now
@@ -879,12 +1167,33 @@ std::shared_ptr<T> Region::get_pointer_to(const std::unordered_map<std::string,
 }
 
 
-std::multimap<double, std::weak_ptr<dm_hsm::Converter>, std::greater<double> >
-                                                        Region::collectConverter(dm_hsm::HSMCategory cat,
-                                                                                 const aux::SimulationClock& clock) {
+const std::vector<std::shared_ptr<Converter> >& Region::collectConverter(dm_hsm::HSMCategory cat,
+                                                                         const aux::SimulationClock& clock) {
   // std::cout << "\tFUNC-ID: Region::collectConverter with  HSMCategory: " << static_cast<std::underlying_type<dm_hsm::HSMCategory>::type>(cat) << std::endl;
-  std::multimap<double, std::weak_ptr<dm_hsm::Converter>, std::greater<double> > tmp_map_converter; //map with descending sorting
+  //returns the merit order of the category, converters without usable capacity in the current tp have to be skipped by
+  //the caller with usable_in_merit_order()
+  if (merit_order_outdated_)
+    updateMeritOrder(clock);
+  auto merit_order_pos = merit_order_.find(cat);
+  if (merit_order_pos == merit_order_.end()) {
+    std::cerr << "ERROR in Region::collectConverter - not defined for this HSM Category" << std::endl;
+    std::terminate();
+  }
+  return merit_order_pos->second;
+}
+
+bool Region::usable_in_merit_order(const Converter& converter,
+                                   dm_hsm::HSMCategory cat,
+                                   const aux::SimulationClock& clock) const {
+  //ignore converter with small capacity!
+  if (cat == HSMCategory::DISPATCHABLE_GENERATOR)
+    return (converter.usable_capacity_out_tp() > genesys::ProgramSettings::approx_epsilon());
+  return (converter.usable_capacity_el(clock) > genesys::ProgramSettings::approx_epsilon());
+}
 
+void Region::updateMeritOrder(const aux::SimulationClock& clock) {
+  //The sort keys (efficiency and specific vopex) only change with the installed units and the annual lookups, so the merit
+  //order is sorted once after set_annual_lookups()/decommission_plants() instead of every tp.
   //Working principle in pseudocode:
   //if cat =  ST_STORAGE, LT_STORAGE, LINE_CONVERTER
       //=> sort by std::greater<efficiency>
@@ -892,68 +1201,53 @@ std::multimap<double, std::weak_ptr<dm_hsm::Converter>, std::greater<double> >
       //=> sort by std::less<vopex> == std::greater<1/vopex>
   //else if cat = HEAT
     //=> sort by efficiency merit order
-  /* Heat Integrationsversuch: kja
-  if (cat == HSMCategory::LT_STORAGE || cat == HSMCategory::ST_STORAGE || cat == HSMCategory::LINE_CONVERTER || (cat == HSMCategory::HEAT_STORAGE && (genesys::ProgramSettings::modules().find("heat")->second)) || (cat == HSMCategory::EL2HEAT && (genesys::ProgramSettings::modules().find("heat")->second))) {// sort by std::greater<efficiency>
-  */
-  if (cat == HSMCategory::LT_STORAGE || cat == HSMCategory::ST_STORAGE || cat == HSMCategory::LINE_CONVERTER) {// sort by std::greater<efficiency>
-    for (const auto& it : converter_ptrs_) {
-      //select converter according category:
-      //std::cout << "==" << aux::SimulationClock::time_point_to_string(clock.now()) << "== storage search: " << it.second->code() << std::endl;
-      if (it.second->usable_capacity_el(clock) > genesys::ProgramSettings::approx_epsilon()) { //ignore converter with small capacity!
+  merit_order_.clear();
+  for (auto cat : {HSMCategory::LT_STORAGE, HSMCategory::ST_STORAGE, HSMCategory::LINE_CONVERTER,
+                   HSMCategory::DISPATCHABLE_GENERATOR}) {
+    std::multimap<double, std::shared_ptr<dm_hsm::Converter>, std::greater<double> > tmp_map_converter; //map with descending sorting
+    if (cat != HSMCategory::DISPATCHABLE_GENERATOR) {// sort by std::greater<efficiency>
+      for (const auto& it : converter_ptrs_) {
         if (cat == it.second->get_HSMCategory()) { //map is sorted by conv_efficiency
           double conv_efficiency = it.second->get_efficiency(clock); //get_efficiency>0 implies capacity>0!
           if ((genesys::ProgramSettings::approx_epsilon() <= conv_efficiency) &&
-              /* Heat Integrationsversuch: kja
-              ((conv_efficiency <= 1 + genesys::ProgramSettings::approx_epsilon()) || (cat == HSMCategory::EL2HEAT)))
-              */
               ((conv_efficiency <= 1 + genesys::ProgramSettings::approx_epsilon()))) {
-              tmp_map_converter.emplace(conv_efficiency, it.second);
-               //} else if (efficiency_max_power == 0) { //do not fill into map
-          } else {
-                 std::cerr << "ERROR in Region::collectEfficicentConverter: Efficiency_max corrupted for converter "
-                           << it.first << std::endl;
-                 std::terminate();
+            tmp_map_converter.emplace(conv_efficiency, it.second);
+          } else if (it.second->get_capacity(clock) > genesys::ProgramSettings::approx_epsilon()) {
+            std::cerr << "ERROR in Region::updateMeritOrder: Efficiency_max corrupted for converter "
+                      << it.first << std::endl;
+            std::terminate();
           }
-        }//get_HSMCat;l
-      }//usable_capacity>0
-    }//for
-  /* Heat Integrationsversuch: kja
-  } else if (cat == HSMCategory::DISPATCHABLE_GENERATOR || (cat == HSMCategory::HEAT_GENERATOR && (genesys::ProgramSettings::modules().find("heat")->second)) || (cat == HSMCategory::HEAT_AND_EL && (genesys::ProgramSettings::modules().find("heat")->second))) {//=> sort by std::less<vopex> == std::greater<1/vopex>
-  */
-  } else if (cat == HSMCategory::DISPATCHABLE_GENERATOR) {//=> sort by std::less<vopex> == std::greater<1/vopex>
-    for (const auto& it : converter_ptrs_) {
-
-      //std::cout << "==" << aux::SimulationClock::time_point_to_string(clock.now()) << "== converter search: " << it.second->code() << std::endl;
-      //select converter according category:
-      if (it.second->usable_capacity_out_tp() > genesys::ProgramSettings::approx_epsilon()) { //ignore converter with small capacity!
-        if (cat == it.second->get_HSMCategory()) { //check no CONV_MUSTRUN is selected
-        	//CBU: the following lines are obsolete... if usable_capacity > 0
-        	//double conv_efficiency = it.second->get_efficiency(clock); //implies capacity>0 Conversion from primary energy to electricity
-        	//// This procedure only works with converter efficiency > 0 and < 1
-        	//if (genesys::ProgramSettings::approx_epsilon() < conv_efficiency && conv_efficiency < 1+ genesys::ProgramSettings::approx_epsilon()){
-            double specf_vopex = it.second->get_spec_vopex(clock);//specific variable==emission dependent opex
-            if(specf_vopex > genesys::ProgramSettings::approx_epsilon() ) {
-              //std::cout << "\t economic_converter_map: inserting converter of code: " << it.second->code()  << " | specf_vopex = " << specf_vopex << " | eff= " << 1/specf_vopex << " | capacity = " << it.second->usable_capacity_el(clock) << std::endl;
-              tmp_map_converter.emplace(1/specf_vopex, it.second);
-            }// else skip converter!
-          //}// 0 < eff < 1
-        }//cat
-      }//usable_cap>0
-    }//for
-  } else {
-    std::cerr << "ERROR in Region::collectConverter - not defined for this HSM Category" << std::endl;
-    std::terminate();
+        }
+      }
+    } else {//=> sort by std::less<vopex> == std::greater<1/vopex>
+      for (const auto& it : converter_ptrs_) {
+        //check no CONV_MUSTRUN is selected, specific vopex is only defined for converter with capacity
+        if (cat == it.second->get_HSMCategory() &&
+            it.second->get_capacity(clock) > genesys::ProgramSettings::approx_epsilon()) {
+          double specf_vopex = it.second->get_spec_vopex(clock);//specific variable==emission dependent opex
+          if(specf_vopex > genesys::ProgramSettings::approx_epsilon() ) {
+            tmp_map_converter.emplace(1/specf_vopex, it.second);
+          }// else skip converter!
+        }
+      }
+    }
+    auto& merit_order = merit_order_[cat];
+    merit_order.reserve(tmp_map_converter.size());
+    for (auto& it : tmp_map_converter)
+      merit_order.push_back(it.second);
   }
-  return tmp_map_converter;
+  merit_order_outdated_ = false;
 }
 
 void Region::converter_balance(const dm_hsm::HSMCategory& category,
                                const aux::SimulationClock& clock) {
 	//std::cout << "FUNC-ID: Region::converter_balance in region " << code() << " |\t residual_load= " << residual_load_TP_ << " GW"<< std::endl;
-  std::multimap<double, std::weak_ptr<dm_hsm::Converter>, std::greater<double> > tmp_map_converter = collectConverter(category, clock);
+  const auto& merit_order = collectConverter(category, clock);
   //loop all converter in region
-  for (auto &it : tmp_map_converter) { //do not use it.first, for sorting purposes only!
-	  //DEBUG std::cout << "==" << aux::SimulationClock::time_point_to_string(clock.now()) << "== converter active: " << it.second.lock()->code() << std::endl;
+  for (auto &it : merit_order) {
+    if (!usable_in_merit_order(*it, category, clock))
+      continue;
+	  //DEBUG std::cout << "==" << aux::SimulationClock::time_point_to_string(clock.now()) << "== converter active: " << it->code() << std::endl;
 
 	///////////////////////////// Load
 	double remaining_request_load = 0.;
@@ -980,35 +1274,35 @@ void Region::converter_balance(const dm_hsm::HSMCategory& category,
 		if (category == dm_hsm::HSMCategory::HEAT_GENERATOR || category == dm_hsm::HSMCategory::HEAT_STORAGE || category == dm_hsm::HSMCategory::HEAT_AND_EL || category == dm_hsm::HSMCategory::EL2HEAT) {
 
 			//check if !storage charger
-			auto hsm_subcat = it.second.lock()->get_HSMSubCategory();
+			auto hsm_subcat = it->get_HSMSubCategory();
 
 			if (hsm_subcat != dm_hsm::HSMSubCategory::CHARGER) {//=discharger, bicharger, dispatchable generator
-			  //DEBUG  std::cout << "==" << aux::SimulationClock::time_point_to_string(clock.now()) << "== converter active: " << it.second.lock()->code() <<  "|power= "<< it.second.lock()->usable_capacity_out_tp() <<  " remaining request = " << remaining_request << std::endl;
+			  //DEBUG  std::cout << "==" << aux::SimulationClock::time_point_to_string(clock.now()) << "== converter active: " << it->code() <<  "|power= "<< it->usable_capacity_out_tp() <<  " remaining request = " << remaining_request << std::endl;
 				double reserved_pwr_from_converter_heat = 0.;
 				double reserved_pwr_from_converter_el = 0.;
 
-			  if(it.second.lock()->get_HSMCategory() != dm_hsm::HSMCategory::EL2HEAT && it.second.lock()->get_HSMCategory() != dm_hsm::HSMCategory::HEAT_AND_EL){
+			  if(it->get_HSMCategory() != dm_hsm::HSMCategory::EL2HEAT && it->get_HSMCategory() != dm_hsm::HSMCategory::HEAT_AND_EL){
 				  //case A: Dispachtable Converter  or conventional converter in must-run mode
-				  if(it.second.lock()->get_HSMCategory() == dm_hsm::HSMCategory::HEAT_GENERATOR){
+				  if(it->get_HSMCategory() == dm_hsm::HSMCategory::HEAT_GENERATOR){
 					//TODO check for correctly applied efficiencies
-					  reserved_pwr_from_converter_heat = it.second.lock()->usable_power_out_tp(clock, remaining_request_heat, "heat");//usable_power...overloaded for multi-conv!
+					  reserved_pwr_from_converter_heat = it->usable_power_out_tp(clock, remaining_request_heat, "heat");//usable_power...overloaded for multi-conv!
 					//case B: Storage Discharger / BiCharger
 				  }
-				  if(it.second.lock()->get_HSMCategory() == dm_hsm::HSMCategory::HEAT_STORAGE){
+				  if(it->get_HSMCategory() == dm_hsm::HSMCategory::HEAT_STORAGE){
 					  // Kevin => nimmt doch alle Speicher und dürfte doch nur Heat nehmen ???
-					reserved_pwr_from_converter_heat = it.second.lock()->reserveDischarger(clock, remaining_request_heat);//usable_power...overloaded for multi-conv!
+					reserved_pwr_from_converter_heat = it->reserveDischarger(clock, remaining_request_heat);//usable_power...overloaded for multi-conv!
 				  }
 
 				  if (reserved_pwr_from_converter_heat > genesys::ProgramSettings::approx_epsilon() ) {
 					  double balanceable_pwr_heat = std::min(reserved_pwr_from_converter_heat, residual_heat_TP_);
-						if (it.second.lock()->useConverterOutput_el2heat(clock, reserved_pwr_from_converter_heat, "heat")) {
+						if (it->useConverterOutput_el2heat(clock, reserved_pwr_from_converter_heat, "heat")) {
 							residual_heat_TP_ += -balanceable_pwr_heat;
 						}
 					}
 			  }
 
 			  ///////////////////////////////////////
-			  if(it.second.lock()->get_HSMCategory() == dm_hsm::HSMCategory::EL2HEAT){
+			  if(it->get_HSMCategory() == dm_hsm::HSMCategory::EL2HEAT){
 				// Collect HEAT_AND_EL
 				double request_heat_el2heat = 0;
 				double usable_capacity_heat_of_chp = 0;
@@ -1020,8 +1314,8 @@ void Region::converter_balance(const dm_hsm::HSMCategory& category,
 				for (auto &it2 : tmp_map_converter) {
 					usable_capacity_heat_of_chp += it2.second.lock()->usable_power_out_tp(clock, std::numeric_limits<double>::infinity(), "heat");//usable_power...overloaded for multi-conv!
 					usable_capacity_el_of_chp += (usable_capacity_heat_of_chp/it2.second.lock()->get_output_conversion("heat")) * it2.second.lock()->get_output_conversion("electric_energy");
-					if (lowest_efficiency_of_chp > it2.second.lock()->efficiency(clock.now())){
-						lowest_efficiency_of_chp = it2.second.lock()->efficiency(clock.now());
+					if (lowest_efficiency_of_chp > it2.second.lock()->get_efficiency(clock)){
+						lowest_efficiency_of_chp = it2.second.lock()->get_efficiency(clock);
 						lowest_conversion_of_chp_heat = it2.second.lock()->get_output_conversion("heat");
 						lowest_conversion_of_chp_el = it2.second.lock()->get_output_conversion("electric_energy");
 					}
@@ -1063,8 +1357,8 @@ void Region::converter_balance(const dm_hsm::HSMCategory& category,
 				}
 
 				//TODO check for correctly applied efficiencies
-				reserved_pwr_from_converter_heat = it.second.lock()->usable_power_out_tp_el2heat(clock, request_heat_el2heat);//usable_power...overloaded for multi-conv!
-				reserved_pwr_from_converter_el = reserved_pwr_from_converter_heat / it.second.lock()->efficiency(clock.now());
+				reserved_pwr_from_converter_heat = it->usable_power_out_tp_el2heat(clock, request_heat_el2heat);//usable_power...overloaded for multi-conv!
+				reserved_pwr_from_converter_el = reserved_pwr_from_converter_heat / it->get_efficiency(clock);
 				//case B: Storage Discharger / BiCharger
 
 				//std::multimap<double, std::weak_ptr<dm_hsm::Converter>, std::greater<double> > tmp_map_converter = collectConverter(dm_hsm::HSMCategory::HEAT_AND_EL, clock);
@@ -1075,25 +1369,25 @@ void Region::converter_balance(const dm_hsm::HSMCategory& category,
 				if (reserved_pwr_from_converter_heat > genesys::ProgramSettings::approx_epsilon() ) {
 					auto balanceable_pwr_heat = std::min(reserved_pwr_from_converter_heat, residual_heat_TP_);
 					auto balanceable_pwr_el = std::max(reserved_pwr_from_converter_el,0.);
-					if (it.second.lock()->useConverterOutput_el2heat(clock, reserved_pwr_from_converter_heat, "heat")) {
+					if (it->useConverterOutput_el2heat(clock, reserved_pwr_from_converter_heat, "heat")) {
 						residual_heat_TP_ += -balanceable_pwr_heat;
 						residual_load_TP_ += balanceable_pwr_el;
 					}
 				}
 		  }
 
-			  if(it.second.lock()->get_HSMCategory() == dm_hsm::HSMCategory::HEAT_AND_EL){
-				  reserved_pwr_from_converter_heat = it.second.lock()->usable_power_out_tp(clock, remaining_request_heat, "heat");//usable_power...overloaded for multi-conv!
-				  reserved_pwr_from_converter_el = (reserved_pwr_from_converter_heat/it.second.lock()->get_output_conversion("heat")) * it.second.lock()->get_output_conversion("electric_energy");
+			  if(it->get_HSMCategory() == dm_hsm::HSMCategory::HEAT_AND_EL){
+				  reserved_pwr_from_converter_heat = it->usable_power_out_tp(clock, remaining_request_heat, "heat");//usable_power...overloaded for multi-conv!
+				  reserved_pwr_from_converter_el = (reserved_pwr_from_converter_heat/it->get_output_conversion("heat")) * it->get_output_conversion("electric_energy");
 				  if (reserved_pwr_from_converter_heat > genesys::ProgramSettings::approx_epsilon() ) {
-					//std::cout << "===== converter active = " << it.second.lock()->code() << " with output power " << power_from_converter << std::endl;
+					//std::cout << "===== converter active = " << it->code() << " with output power " << power_from_converter << std::endl;
 					auto balanceable_pwr_heat = std::min(reserved_pwr_from_converter_heat, residual_heat_TP_);
-					auto balanceable_pwr_el = (balanceable_pwr_heat/it.second.lock()->get_output_conversion("heat")) * it.second.lock()->get_output_conversion("electric_energy");
-					if (it.second.lock()->useConverterOutput(clock, reserved_pwr_from_converter_heat, "heat")) {
+					auto balanceable_pwr_el = (balanceable_pwr_heat/it->get_output_conversion("heat")) * it->get_output_conversion("electric_energy");
+					if (it->useConverterOutput(clock, reserved_pwr_from_converter_heat, "heat")) {
 						residual_heat_TP_ += -balanceable_pwr_heat;
 						residual_load_TP_ += -balanceable_pwr_el;
 						// residual_heat_TP_ += balanceable_pwr; Kevin für Strom bei anderem
-					  //std::cout << "converter_balance() of " << balanceable_pwr << "GW succeeded in "<< code() << " with " << it.second.lock()->code()<< std::endl;
+					  //std::cout << "converter_balance() of " << balanceable_pwr << "GW succeeded in "<< code() << " with " << it->code()<< std::endl;
 					} else {
 					  std::cerr << "Region::converter_balance - balance with reserved power failed to useConverterOutput()" << std::endl;
 					  std::terminate();
@@ -1111,34 +1405,34 @@ void Region::converter_balance(const dm_hsm::HSMCategory& category,
 		//check if !storage charger
 
 		//check if !storage charger
-		auto hsm_subcat = it.second.lock()->get_HSMSubCategory();
+		auto hsm_subcat = it->get_HSMSubCategory();
 
 		if (hsm_subcat != dm_hsm::HSMSubCategory::CHARGER) {//=discharger, bicharger, dispatchable generator
-		  //DEBUG  std::cout << "==" << aux::SimulationClock::time_point_to_string(clock.now()) << "== converter active: " << it.second.lock()->code() <<  "|power= "<< it.second.lock()->usable_capacity_out_tp() <<  " remaining request = " << remaining_request << std::endl;
+		  //DEBUG  std::cout << "==" << aux::SimulationClock::time_point_to_string(clock.now()) << "== converter active: " << it->code() <<  "|power= "<< it->usable_capacity_out_tp() <<  " remaining request = " << remaining_request << std::endl;
 		  auto reserved_pwr_from_converter = 0.;
 
 		  //case A: Dispachtable Converter  or conventional converter in must-run mode
-		  if(it.second.lock()->get_HSMCategory() == dm_hsm::HSMCategory::DISPATCHABLE_GENERATOR
-			  ||it.second.lock()->get_HSMCategory() == dm_hsm::HSMCategory::CONV_MUSTRUN ){
+		  if(it->get_HSMCategory() == dm_hsm::HSMCategory::DISPATCHABLE_GENERATOR
+			  ||it->get_HSMCategory() == dm_hsm::HSMCategory::CONV_MUSTRUN ){
 			//TODO check for correctly applied efficiencies
 			/* Heat Integrationsversuch: kja
-      	  	  reserved_pwr_from_converter = it.second.lock()->usable_power_out_tp(clock, remaining_request_load, "electric_energy");//usable_power...overloaded for multi-conv!
+      	  	  reserved_pwr_from_converter = it->usable_power_out_tp(clock, remaining_request_load, "electric_energy");//usable_power...overloaded for multi-conv!
 			 */
-			reserved_pwr_from_converter = it.second.lock()->usable_power_out_tp(clock, remaining_request_load);//usable_power...overloaded for multi-conv!
+			reserved_pwr_from_converter = it->usable_power_out_tp(clock, remaining_request_load);//usable_power...overloaded for multi-conv!
 
 		  } else {//case B: Storage Discharger / BiCharger
-			reserved_pwr_from_converter = it.second.lock()->reserveDischarger(clock, remaining_request_load);//usable_power...overloaded for multi-conv!
+			reserved_pwr_from_converter = it->reserveDischarger(clock, remaining_request_load);//usable_power...overloaded for multi-conv!
 		  }
-		  //std::cout <<"\t *SUCESS Reserving "<<std::setw(20)<< it.second.lock()->code() << "\t| power_from_converter= "<<std::setw(10) << reserved_pwr_from_converter << " GW" << std::endl;
+		  //std::cout <<"\t *SUCESS Reserving "<<std::setw(20)<< it->code() << "\t| power_from_converter= "<<std::setw(10) << reserved_pwr_from_converter << " GW" << std::endl;
 		  if (reserved_pwr_from_converter > genesys::ProgramSettings::approx_epsilon() ) {
-			//std::cout << "===== converter active = " << it.second.lock()->code() << " with output power " << reserved_pwr_from_converter << std::endl;
+			//std::cout << "===== converter active = " << it->code() << " with output power " << reserved_pwr_from_converter << std::endl;
 			auto balanceable_pwr = std::min(reserved_pwr_from_converter, residual_load_TP_);
       /* Heat Integrationsversuch: kja
-      if (it.second.lock()->useConverterOutput(clock, balanceable_pwr, "electric_energy")) {
+      if (it->useConverterOutput(clock, balanceable_pwr, "electric_energy")) {
       */
-			if (it.second.lock()->useConverterOutput(clock, balanceable_pwr)) {
+			if (it->useConverterOutput(clock, balanceable_pwr)) {
 			  residual_load_TP_ += -balanceable_pwr;
-			  //std::cout << "converter_balance() of " << balanceable_pwr << "GW succeeded in "<< code() << " with " << it.second.lock()->code()<< std::endl;
+			  //std::cout << "converter_balance() of " << balanceable_pwr << "GW succeeded in "<< code() << " with " << it->code()<< std::endl;
 			  //std::cout << "\tremaining residual load: "<< residual_load_TP_ << " GW" << std::endl;
 			} else {
 			  std::cerr << "\tRegion::converter_balance - balance with reserved power failed to useConverterOutput()" << std::endl;
@@ -1156,19 +1450,21 @@ void Region::storage_charging(const dm_hsm::HSMCategory& category,
   //  std::cout << "FUNC-ID: Region::storage_charging in region "<<  code() << " "
   //          << aux::SimulationClock::time_point_to_string(clock.now())  << "\t|\t"
   //          << " residual load = " << residual_load_TP_ << std::endl;
-  std::multimap<double, std::weak_ptr<dm_hsm::Converter>, std::greater<double> > tmp_map_converter = collectConverter(category, clock);
+  const auto& merit_order = collectConverter(category, clock);
   double avail_chrg_pwr =0.;
-  for (auto &it : tmp_map_converter) {
+  for (auto &it : merit_order) {
+    if (!usable_in_merit_order(*it, category, clock))
+      continue;
     if (residual_load_TP_ < -genesys::ProgramSettings::approx_epsilon()) { //check for excess generation after each converter
       avail_chrg_pwr = std::abs(residual_load_TP_);
     } else {
       break;
     }
-    auto storage_conv_cat= it.second.lock()->get_HSMSubCategory();
+    auto storage_conv_cat= it->get_HSMSubCategory();
     if (storage_conv_cat == dm_hsm::HSMSubCategory::BICHARGER || storage_conv_cat == dm_hsm::HSMSubCategory::CHARGER) {
-      double max_chrg_pwr = it.second.lock()->reserveChargerInput(clock, std::abs(avail_chrg_pwr));
+      double max_chrg_pwr = it->reserveChargerInput(clock, std::abs(avail_chrg_pwr));
       if (max_chrg_pwr > 0 ) { //reduce RL with request to converter
-        if (it.second.lock()->useChargeStorage(max_chrg_pwr, clock)) {
+        if (it->useChargeStorage(max_chrg_pwr, clock)) {
           residual_load_TP_ += max_chrg_pwr;
         }
       }
@@ -1176,61 +1472,49 @@ void Region::storage_charging(const dm_hsm::HSMCategory& category,
   }
 }//END Region::storage_balance
 
-std::map<double,
-           std::pair<std::weak_ptr<Link>, std::weak_ptr<TransmissionConverter>>,
-           std::greater<double> > Region::createTempLinkMap(const std::weak_ptr<Link> hotlink,
-                                                              const aux::SimulationClock& clock){
-  //DEBUG std::cout << "\t\t" <<code()<< "Region::createTemporaryMap"<< std::endl;
-  //map sorted by desccending efficiency
-  std::map<double, std::pair<std::weak_ptr<Link>, std::weak_ptr<TransmissionConverter>>,
-                             std::greater<double> > direct_el_lines_map;
-  for (auto &it : line_map_el_){
-    if (!hotlink.expired()){
-      if (hotlink.lock() != it.second.first.lock()){ //exclusion of hotlink for balance - request
-        if(it.second.second.lock()->get_capacity(clock) > genesys::ProgramSettings::approx_epsilon()) //only if any capacity on the link
-        direct_el_lines_map.emplace(it.second.second.lock()->get_efficiency(clock),
-                                    std::make_pair(it. second.first, it.second.second));
-      }
-    } else {//no active hotlink = direct neighbour
-      if(it.second.second.lock()->get_capacity(clock) > genesys::ProgramSettings::approx_epsilon()) //only if any capacity on the link
-        direct_el_lines_map.emplace(it.second.second.lock()->get_efficiency(clock),
-                                          std::make_pair(it. second.first, it.second.second));
-    }
-  }
-  return direct_el_lines_map;
-}//END Region::createTemporaryMap
-
 double Region::balance(int hops,
                        const double balance_demand,
                        const dm_hsm::HSMCategory& cat,
                        const aux::SimulationClock& clock,
-                       const std::weak_ptr<Link>& hotlink) {
+                       const Link* hotlink) {
   //std::cout << "\t" <<code()<< "Region::balance - trying to balance " << balance_demand << " GW via " << hops << " hop-depth!" << std::endl;
   // This function should not be called with small values for balance_demand. Otherwise, return 0 since no balancing will be conducted
   if (balance_demand < genesys::ProgramSettings::approx_epsilon()) {
     return 0.0; //early return balance_demand
   }
 
+  proposeGridLines(clock);//no-op if proposed already in this tp
+  //lines by descending efficiency without the hotlink, of several lines with equal efficiency only the first is used
+  //(unique keys of the former temporary std::map)
+  bool any_line = false;
+  double last_efficiency = 0.;
+  auto skip_line = [&](const GridLine& grid_line) {
+    if ((hotlink != nullptr && grid_line.link == hotlink) || (any_line && grid_line.efficiency == last_efficiency))
+      return true;
+    any_line = true;
+    last_efficiency = grid_line.efficiency;
+    return false;
+  };
+
   if (hops == 0) {  //units in direct neighbours
-    std::map<double,
-                 std::pair<std::weak_ptr<Link>, std::weak_ptr<TransmissionConverter>>,
-                 std::greater<double> > lines_to_neighbours = createTempLinkMap(hotlink.lock(), clock); //map sorted by desccending efficiency
     double remaining_demand = balance_demand; //init
-    for (auto& it : lines_to_neighbours){
+    for (const auto& grid_line : grid_lines_){
+      if (skip_line(grid_line))
+        continue;
       if (remaining_demand > genesys::ProgramSettings::approx_epsilon()) {
-          double import =  it.second.first.lock()->getImportCapacity(cat, clock, code(), it.second.second, remaining_demand);
+          double import =  grid_line.link->getImportCapacity(cat, clock, code(), grid_line.converter, remaining_demand);
           if (import > 0){
         	  //std::cout << "\t\t could get potential import capacity to" << code() << " : GW= " << import << std::endl;
           }
           //Valid case
           if (import > genesys::ProgramSettings::approx_epsilon() && import != std::numeric_limits<double>::infinity() ){
-            if (it.second.first.lock()->useImportCapacity(cat, import, clock, code(), it.second.second, it.second.first)) {
+            if (grid_line.link->useImportCapacity(cat, import, clock, code(), grid_line.converter)) {
               remaining_demand -= import;
               //std::cout << "could import " << import << "GW to "<< code() << std::endl;
               //Update tracking variable
-              imported_electricity_ += aux::TimeSeriesConst(std::vector<double>{import, 0.0},
-                                                                                clock.now(),
-                                                                                clock.tick_length() );
+              imported_electricity_.add_pulse(import,
+                                              clock.now(),
+                                              clock.tick_length() );
             }
 			//else {
 			//std::cout << "**WARNING: could not useImportCapacity() - transmission converter operating in other direction or reservation failed!" << std::endl;
@@ -1249,13 +1533,12 @@ double Region::balance(int hops,
 
   } else {//hops > 0    /
     --hops;
-    std::map<double,
-             std::pair<std::weak_ptr<Link>, std::weak_ptr<TransmissionConverter>>,
-             std::greater<double> > direct_el_lines_map = createTempLinkMap(hotlink.lock(), clock); //map sorted by desccending efficiency
     double remaining_demand = balance_demand; //init
-    for (auto& it : direct_el_lines_map){
+    for (const auto& grid_line : grid_lines_){
+      if (skip_line(grid_line))
+        continue;
       if (remaining_demand > genesys::ProgramSettings::approx_epsilon()) {
-        remaining_demand -=  balance(hops, remaining_demand, cat, clock, it.second.first.lock());
+        remaining_demand -=  balance(hops, remaining_demand, cat, clock, grid_line.link);
         if (remaining_demand < genesys::ProgramSettings::approx_epsilon()) {
           remaining_demand = 0.;
           break;//breaks for-loop
@@ -1312,7 +1595,7 @@ double Region::calc_SelfSupplyQuota(const aux::SimulationClock& clock) {
     std::cout << "ERROR in Region::calc_SelfSupplyQuota()" << std::endl;
     std::cout << e.what(); // information from error printed
   }
-  annual_selfsupply_quota_ += aux::TimeSeriesConst(std::vector<double>{quota, 0.}, start_tp, clock.tick_length());
+  annual_selfsupply_quota_.add_pulse(quota, start_tp, clock.tick_length());
   //std::cout << "\t" << code() << " | Quota= " << quota << " | demand current year = "<< demand_year << " GWh" << std::endl;
 
   double barrier = 1.;//always transform to values > 1
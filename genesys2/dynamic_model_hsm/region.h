@@ -36,6 +36,7 @@
 #include <memory>
 #include <unordered_map>
 #include <thread>
+#include <vector>
 
 #include <auxiliaries/time_tools.h>
 #include <dynamic_model_hsm/multi_converter.h>
@@ -53,7 +54,7 @@ class Region : public sm::Region {
   Region() = delete;
   virtual ~Region() override = default;
   Region (const Region& other);
-  Region(Region&& other) = delete; //  if this move c'tor is needed, special implementation is necessary, taking care of correct handling of the weak pointers of the converter
+  Region(Region&& other); // weak pointers of the converter are dropped as in the copy c'tor
   Region& operator=(const Region&) = delete;
   Region& operator=(Region&&) = delete;
   Region(const sm::Region& origin);
@@ -65,12 +66,13 @@ class Region : public sm::Region {
   void autoSetHSMCategory();
   void connectReservoirs();
   void connectGlobalReservoirs(std::string output_type,std::shared_ptr<PrimaryEnergy> co2_ptr);
+  bool has_multi_converter() const;
   //  	void connectReservoirs(bool local = true);
-  void connectLink(std::weak_ptr<Link> link,
+  void connectLink(Link* link,
                    const std::unordered_map<std::string, std::shared_ptr<TransmissionConverter> >& converter_ptrs);
   void save_unsupplied_load(const aux::SimulationClock& clock) {
-    remaining_residual_load_ += aux::TimeSeriesConst(std::vector<double>{residual_load_TP_, 0.}, clock.now(), clock.tick_length());
-    remaining_residual_heat_load_ += aux::TimeSeriesConst(std::vector<double>{residual_heat_TP_, 0.}, clock.now(), clock.tick_length());
+    remaining_residual_load_.add_pulse(residual_load_TP_, clock.now(), clock.tick_length());
+    remaining_residual_heat_load_.add_pulse(residual_heat_TP_, clock.now(), clock.tick_length());
   }
     //return (residual_load_TP_ > 0.0+genesys::ProgramSettings::approx_epsilon() ? residual_load_TP_ : 0);}
   ///@}
@@ -83,8 +85,22 @@ class Region : public sm::Region {
   void init_heat_load(aux::SimulationClock::time_point tp_start_seq,
                       aux::SimulationClock::time_point tp_end_seq,
                       aux::SimulationClock::duration tick_length);
-  void resetSequencedRegion(const aux::SimulationClock& clock);
+  void resetSequencedRegion(const aux::SimulationClock& clock, aux::SimulationClock::time_point tp_end_seq);
+  void resetParametrisedRegion(const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                        aux::SimulationClock::time_point,
+                                                                        aux::SimulationClock::time_point,
+                                                                        aux::SimulationClock::duration> >& installations);
+  void resetOperationRegion();
+  void mergeOperationRegion(const Region& other);
+  void get_stored_energy_transfer(std::unordered_map<std::string, double>& transfer) const;
+  void get_initial_stored_energy(aux::SimulationClock::time_point tp,
+                                 std::unordered_map<std::string, double>& stored_energy) const;
+  void set_stored_energy_transfer(const std::unordered_map<std::string, double>& transfer);
   void resetCurrentTP(const aux::SimulationClock& clock);
+  void lowerKernel(aux::SimulationClock::time_point tp_start,
+                   aux::SimulationClock::time_point tp_end,
+                   aux::SimulationClock::duration tick_length);
+  void writeBackKernel();
   void set_annual_lookups(const aux::SimulationClock& clock);
   void set_annual_unsupplied(double unsupplied_el_wh, aux::SimulationClock::time_point tp);
   void decommission_plants();
@@ -98,6 +114,7 @@ class Region : public sm::Region {
   void balance_start(int hops,
                const dm_hsm::HSMCategory& hsm_cat,
                const aux::SimulationClock& clock);
+  void proposeGridLines(const aux::SimulationClock& clock);
   ///@}
   /** \name GridBalance Interface to Request */
   ///@{
@@ -107,7 +124,7 @@ class Region : public sm::Region {
   bool useExportCapacity(const dm_hsm::HSMCategory cat,
                          const double export_request,
                          const aux::SimulationClock& clock,
-                         const std::weak_ptr<Link>& active_Link);
+                         const Link* active_Link);
   ///@}
   void setTransferStoredEnergy(const aux::SimulationClock& clock);
   //  double getDiscountedValue(std::string query,
@@ -117,10 +134,14 @@ class Region : public sm::Region {
                             aux::SimulationClock::time_point start,
                             aux::SimulationClock::time_point end,
                             const aux::SimulationClock::time_point discount_present =
-                                               aux::SimulationClock::time_point_from_string("1970-01-01_00:00")) const;
+                                               aux::SimulationClock::time_point()) const; // 1970-01-01_00:00, discount to start
   double get_sum(std::string query,
                      aux::SimulationClock::time_point start,
                      aux::SimulationClock::time_point end) const;
+  void accumulate_cost_metrics(aux::SimulationClock::time_point start,
+                               aux::SimulationClock::time_point end,
+                               const aux::SimulationClock::time_point discount_present,
+                               CostMetricTotals& totals) const;
 
   void calculated_annual_disc_capex(aux::SimulationClock::time_point start);
   double calc_SelfSupplyQuota(const aux::SimulationClock& clock);
@@ -169,10 +190,15 @@ class Region : public sm::Region {
   std::shared_ptr<T> get_pointer_to(const std::unordered_map<std::string, std::shared_ptr<T> >& ptr_map,
                                     const std::string& query);
 
-  std::multimap<double,
-                std::weak_ptr<dm_hsm::Converter>,
-                std::greater<double> >collectConverter(dm_hsm::HSMCategory cat,
-                                                       const aux::SimulationClock& clock);
+  /** \name Merit order of converters, see updateMeritOrder()*/
+  ///@{
+  const std::vector<std::shared_ptr<Converter> >& collectConverter(dm_hsm::HSMCategory cat,
+                                                                   const aux::SimulationClock& clock);
+  bool usable_in_merit_order(const Converter& converter,
+                             dm_hsm::HSMCategory cat,
+                             const aux::SimulationClock& clock) const;
+  void updateMeritOrder(const aux::SimulationClock& clock);
+  ///@}
   std::multimap<double,
                 std::weak_ptr<dm_hsm::Storage>,
                 std::greater<double> >collectStorages(dm_hsm::HSMCategory cat,
@@ -183,11 +209,7 @@ class Region : public sm::Region {
                  const double balance_demand,
                  const dm_hsm::HSMCategory& cat,
                  const aux::SimulationClock& clock,
-                 const std::weak_ptr<Link>& hotlink = std::weak_ptr<Link>()  );
-
-  std::map<double, std::pair<std::weak_ptr<Link>, std::weak_ptr<TransmissionConverter>>,
-                             std::greater<double> > createTempLinkMap(const std::weak_ptr<Link> hotlink,
-                                                                        const aux::SimulationClock& clock);
+                 const Link* hotlink = nullptr);
   ///@}
 
   /** \name LocalBalance Private Functions */
@@ -198,6 +220,8 @@ class Region : public sm::Region {
                        const aux::SimulationClock& clock);
   ///@}
 
+  void resetPersistingValues();
+
   std::tuple<std::vector<double>, aux::SimulationClock::time_point> calc_energy_vector(aux::SimulationClock::time_point start,
                                                                                        aux::SimulationClock::time_point end) const;
   double collect_generation(const aux::SimulationClock::time_point start,
@@ -211,44 +235,54 @@ class Region : public sm::Region {
 
   void discharge_heat_storage(const dm_hsm::HSMCategory& category,
                               const aux::SimulationClock& clock);
+  void attach_storage_state();
+  void index_components();
 
   std::unordered_map<std::string, std::shared_ptr<PrimaryEnergy> > primary_energy_ptrs_;
   std::unordered_map<std::string, std::shared_ptr<Converter> > converter_ptrs_;
   std::unordered_map<std::string, std::shared_ptr<Storage> > storage_ptrs_;
-  std::unordered_map<std::string, std::pair<std::weak_ptr<Link>, std::weak_ptr<TransmissionConverter> > > line_map_el_;
-  std::unordered_map<std::string, std::pair<std::weak_ptr<Link>, std::weak_ptr<TransmissionConverter> > > line_map_ch4_;
+  std::shared_ptr<StorageState> storage_state_; ///state of charge of all storage_ptrs_ in one block
+  /** \name Dense views of the component maps for the loops per tp, see index_components()*/
+  ///@{
+  std::vector<PrimaryEnergy*> primary_energy_index_;
+  std::vector<Converter*> converter_index_;
+  std::vector<Storage*> storage_index_;
+  ///@}
+  ///lines to the neighbours, links and converters are owned by the DynamicModel and resolved once in connectLink()
+  std::unordered_map<std::string, std::pair<Link*, TransmissionConverter*> > line_map_el_;
+  std::unordered_map<std::string, std::pair<Link*, TransmissionConverter*> > line_map_ch4_;
 //  std::map<double, std::weak_ptr<Link>> map_indirect_imports_;
 //  std::map<double, std::pair<std::weak_ptr<Link>, std::weak_ptr<TransmissionConverter> > > map_indirect_imports1_;
-  std::map<double, std::weak_ptr<Converter>> map_reserved_exports_tp_;
+  std::map<double, Converter*> map_reserved_exports_tp_;
   ///only annual values
       //cost related
 //  aux::TimeSeriesConstAddable annual_capex_;
-  aux::TimeSeriesConstAddable annual_co2_emissions_;
-  aux::TimeSeriesConstAddable annual_consumed_heat_GWh_;
-  aux::TimeSeriesConstAddable annual_generated_heat_GWh_;
+  aux::TimeSeriesAccumulator annual_co2_emissions_;
+  aux::TimeSeriesAccumulator annual_consumed_heat_GWh_;
+  aux::TimeSeriesAccumulator annual_generated_heat_GWh_;
       //energy related
-  aux::TimeSeriesConstAddable annual_imported_electricity_GWh_;
-  aux::TimeSeriesConstAddable annual_imported_gas_GWh_;
-  aux::TimeSeriesConstAddable annual_exported_electricity_GWh_;
-  aux::TimeSeriesConstAddable annual_exported_gas_GWh_;
-  aux::TimeSeriesConstAddable annual_selfsupply_quota_;
-  aux::TimeSeriesConstAddable annual_unsupplied_electricity_; //GWh
+  aux::TimeSeriesAccumulator annual_imported_electricity_GWh_;
+  aux::TimeSeriesAccumulator annual_imported_gas_GWh_;
+  aux::TimeSeriesAccumulator annual_exported_electricity_GWh_;
+  aux::TimeSeriesAccumulator annual_exported_gas_GWh_;
+  aux::TimeSeriesAccumulator annual_selfsupply_quota_;
+  aux::TimeSeriesAccumulator annual_unsupplied_electricity_; //GWh
   //aux::TimeSeriesConstAddable annual_max_demand_;
   ///highly dynamic values
            //should be resetSequence()
-  aux::TimeSeriesConstAddable residual_load_;         ///< Stores the amount of local residual electricity load (unmet demand > 0).
-  aux::TimeSeriesConstAddable residual_heat_;
-  aux::TimeSeriesConstAddable remaining_residual_load_;
-  aux::TimeSeriesConstAddable remaining_residual_heat_load_;
-  aux::TimeSeriesConstAddable remaining_excess_heat_;
-  aux::TimeSeriesConstAddable co2_emissions_;         ///< Stores annual values of co2 Emissions in the region
-  aux::TimeSeriesConstAddable exported_energy_;
-  aux::TimeSeriesConstAddable exported_electricity_;
-  aux::TimeSeriesConstAddable exported_gas_;
-  aux::TimeSeriesConstAddable imported_energy_;
-  aux::TimeSeriesConstAddable imported_electricity_;
-  aux::TimeSeriesConstAddable imported_gas_;
-  aux::TimeSeriesConstAddable import_for_local_balance_;
+  aux::TimeSeriesAccumulator residual_load_;         ///< Stores the amount of local residual electricity load (unmet demand > 0).
+  aux::TimeSeriesAccumulator residual_heat_;
+  aux::TimeSeriesAccumulator remaining_residual_load_;
+  aux::TimeSeriesAccumulator remaining_residual_heat_load_;
+  aux::TimeSeriesAccumulator remaining_excess_heat_;
+  aux::TimeSeriesAccumulator co2_emissions_;         ///< Stores annual values of co2 Emissions in the region
+  aux::TimeSeriesAccumulator exported_energy_;
+  aux::TimeSeriesAccumulator exported_electricity_;
+  aux::TimeSeriesAccumulator exported_gas_;
+  aux::TimeSeriesAccumulator imported_energy_;
+  aux::TimeSeriesAccumulator imported_electricity_;
+  aux::TimeSeriesAccumulator imported_gas_;
+  aux::TimeSeriesAccumulator import_for_local_balance_;
   bool RL_init_;
   bool HEAT_init_;
   bool connected_to_grid_;
@@ -259,6 +293,18 @@ class Region : public sm::Region {
   double reserved_residual_load_tp_;
   double available_power_for_export_;
   double max_pwr_exchange_grid_tp_;
+  std::map<dm_hsm::HSMCategory, std::vector<std::shared_ptr<Converter> > > merit_order_; ///< sorted converters per category
+  bool merit_order_outdated_;
+  /**
+   * @brief Electric line to a neighbour region, offered to the grid balance of the current tp
+   */
+  struct GridLine {
+    double efficiency;
+    Link* link; ///< also identifies the hotlink
+    TransmissionConverter* converter;
+  };
+  std::vector<GridLine> grid_lines_; ///< lines with capacity by descending efficiency, see proposeGridLines()
+  bool grid_lines_current_ = false;
   //double max_demand_current_year_;
 
 };
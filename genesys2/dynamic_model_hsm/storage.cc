@@ -40,61 +40,78 @@
 
 namespace dm_hsm {
 
-void Storage::ResetSequencedStorage(const aux::SimulationClock& clock) {
+void Storage::ResetSequencedStorage(const aux::SimulationClock& clock,
+                                    aux::SimulationClock::time_point tp_end_seq) {
   resetSequencedSysComponent();
   if (stored_energy_transfer_ != (-1.0)) { //transfer SOC from prior sequence
-    charged_energy_ = aux::TimeSeriesConstAddable();
+    charged_energy_.clear();
+    state_->set_charged_energy(state_index_, 0.);
     if (capacity(clock.now()) < stored_energy_transfer_){ //violation of capacity if energy is not reduced
       //correction of energy in storage: min(stored_energy_transfer_, capacity(clock.now()))
-      charged_energy_ += aux::TimeSeriesConst(std::vector<double>{std::min(stored_energy_transfer_, capacity(clock.now()))},
-                                              clock.now(),
-                                              clock.tick_length());
+      add_charged_energy(std::min(stored_energy_transfer_, capacity(clock.now())), clock);
       //record of the lost energy
-      energy_lost_by_transfer_ += aux::TimeSeriesConst(std::vector<double>{std::abs(stored_energy_transfer_- capacity(clock.now())), 0.},
-                                                       clock.now(),
-                                                       clock.tick_length());
+      energy_lost_by_transfer_.add_pulse(std::abs(stored_energy_transfer_- capacity(clock.now())),
+                                         clock.now(),
+                                         clock.tick_length());
     } else {
-    charged_energy_ += aux::TimeSeriesConst(std::vector<double>{stored_energy_transfer_},
-                                            clock.now(),
-                                            clock.tick_length());
+    add_charged_energy(stored_energy_transfer_, clock);
     }
   } else {//no transferSOC from prior sequence
-    charged_energy_ += aux::TimeSeriesConst(std::vector<double>{initial_SOC_* capacity(clock.now())},
-                                            clock.now(),
-                                            clock.tick_length());
+    add_charged_energy(initial_SOC_* capacity(clock.now()), clock);
   }
+  charged_energy_.reserve(clock.now(), tp_end_seq, clock.tick_length());
 }
 
 void Storage::ResetStorageCurrentTP(const aux::SimulationClock& clock){
 	//std::cout << "FUNC-ID: Storage::ResetStorageCurrentTP" << aux::SimulationClock::time_point_to_string(clock.now()) << std::endl;
-    if (capacity(clock.now()) < charged_energy_[clock]){
+    const StorageState& state = state_tp(clock);
+    set_capacity_tp(clock, state.capacity(state_index_));
+    if (state.capacity(state_index_) < state.charged_energy(state_index_)){
     	//DEBUG std::cout << "FUNC-ID: Storage::ResetStorageCurrentTP violation in TP: "<< aux::SimulationClock::time_point_to_string(clock.now()) << std::endl;
-    	double old_charge = charged_energy_[clock];
-    	charged_energy_ += aux::TimeSeriesConst(std::vector<double>{(capacity(clock.now()) - old_charge)},
-    	                                        clock.now(),
-    	                                        clock.tick_length());
+    	double old_charge = state.charged_energy(state_index_);
+    	add_charged_energy((state.capacity(state_index_) - old_charge), clock);
       //record of the lost energy
-      energy_lost_by_transfer_ += aux::TimeSeriesConst(std::vector<double>{std::abs(old_charge - capacity(clock.now())),0.},
-                                                         clock.now(),
-                                                         clock.tick_length());
+      energy_lost_by_transfer_.add_pulse(std::abs(old_charge - state.capacity(state_index_)),
+                                         clock.now(),
+                                         clock.tick_length());
 	}
-  set_usable_capacity_tp(charged_energy_[clock]);
+  set_usable_capacity_tp(state.charged_energy(state_index_));
   set_reserve_capacity_tp(clock,0.);
 }
 
-void Storage::setTransferStoredEnergy(const aux::SimulationClock& clock) {
-  if (std::abs(charged_energy_[clock]) < genesys::ProgramSettings::approx_epsilon()){
+void Storage::ResetParametrisedStorage() {
+  stored_energy_transfer_ = -1.0;
+  charged_energy_.clear();
+  energy_lost_by_transfer_.clear();
+  state_->set_charged_energy(state_index_, 0.);
+  state_->invalidate(state_index_); //capacity and efficiency of the previous installation
+}
+
+void Storage::MergeOperationStorage(const Storage& other) {
+  mergeOperationSysComponent(other);
+  energy_lost_by_transfer_.add_series(other.energy_lost_by_transfer_);
+}
+
+void Storage::attach_state(std::shared_ptr<StorageState> state) {
+  state_index_ = state->add(state_->charged_energy(state_index_));
+  state_ = std::move(state);
+}
+
+void Storage::setTransferStoredEnergy(const aux::SimulationClock& /*clock*/) {
+  const double charged_energy = state_->charged_energy(state_index_);
+  if (std::abs(charged_energy) < genesys::ProgramSettings::approx_epsilon()){
     stored_energy_transfer_ = 0.;
   } else {
-    stored_energy_transfer_ = charged_energy_[clock];
+    stored_energy_transfer_ = charged_energy;
   }
 } ///<sets the persistend_energy_ for transfer between sequences
 
 
 double Storage::getCapacityCharge (const double InputEnergyRequest, const aux::SimulationClock& clock) const {
   //	std::cout << "\t\t|FUNC-ID:  Storage::getCapacityCharge with chargeRequst= " << InputEnergyRequest   << " storage=" << code() << std::endl;
-  if (capacity(clock.now()) > genesys::ProgramSettings::approx_epsilon()) {
-    double emptyCapacityCharge = capacity(clock.now()) - charged_energy_[clock]*efficiency(clock.now());
+  const StorageState& state = state_tp(clock);
+  if (state.capacity(state_index_) > genesys::ProgramSettings::approx_epsilon()) {
+    double emptyCapacityCharge = state.charge_limit(state_index_);
     //std::cout << "\t\t|capacityCharge = " << emptyCapacityCharge  << " current SOC = "<< charged_energy_[clock]/capacity(clock.now()) << std::endl;
     //std::cout << "\t\t|current losses = "<< charged_energy_[clock]*efficiency(clock.now()) << std::endl;
     double acceptedCharge = std::min(InputEnergyRequest, emptyCapacityCharge);
@@ -111,8 +128,9 @@ double Storage::getCapacityDischarge (const double OutputEnergyRequest, const au
   //  std::cout << "\t\t| efficiency     = " <<  efficiency(clock.now()) << std::endl;
   //  std::cout << "\t\t| oldSOC     = " <<  charged_energy_[clock]/capacity(clock.now()) << std::endl;
   double rval_reservableCapacityDischarge =0.;
-  if (capacity(clock.now()) > genesys::ProgramSettings::approx_epsilon()) {
-    double reduced_charged_energy = charged_energy_[clock]*efficiency(clock.now());
+  const StorageState& state = state_tp(clock);
+  if (state.capacity(state_index_) > genesys::ProgramSettings::approx_epsilon()) {
+    double reduced_charged_energy = state.discharge_limit(state_index_);
     rval_reservableCapacityDischarge = std::min(OutputEnergyRequest, reduced_charged_energy);
     return rval_reservableCapacityDischarge;
   }
@@ -128,7 +146,7 @@ bool Storage::reserveCapacityDischarge(double OutputEnergyReserve,
     std::cout << "Clock: " << aux::SimulationClock::time_point_to_string(clock.now()) << std::endl;
     std::terminate();
   }
-  if (set_reserve_capacity_tp(clock,std::min(OutputEnergyReserve, charged_energy_[clock]))){
+  if (set_reserve_capacity_tp(clock,std::min(OutputEnergyReserve, state_->charged_energy(state_index_)))){
     return true;
   }
   //std::cout << "FUNC-ID: Storage::reserveCapacityDischarge reserved " << std::min(OutputEnergyReserve, charge)  << " GWh"<< std::endl;
@@ -138,8 +156,9 @@ bool Storage::reserveCapacityDischarge(double OutputEnergyReserve,
 bool Storage::reserveCapacityCharge(const aux::SimulationClock& clock,
                                     double energyInput) {
   //  std::cout << "\t|FUNC-ID: Storage::reserveCapacityCharge with energyInput " << energyInput << " GWh" << std::endl;
-  if (capacity(clock.now()) > genesys::ProgramSettings::approx_epsilon()
-      && energyInput <= (capacity(clock.now()) - charged_energy_[clock]*efficiency(clock.now()))) {
+  const StorageState& state = state_tp(clock);
+  if (state.capacity(state_index_) > genesys::ProgramSettings::approx_epsilon()
+      && energyInput <= state.charge_limit(state_index_)) {
     return set_reserve_capacity_tp(clock, energyInput);
   } else {
     std::cerr << "ERROR in Storage::reserveCapacityCharge --- Input exceeeds chargeAcceptance or capacity = 0 ? = " << capacity(clock.now()) << std::endl;
@@ -183,9 +202,10 @@ bool Storage::useCapacityDischarge(const double energyOutput,
      std::terminate();
    }
   //good conditions:
-  double old_charge = charged_energy_[clock];
+  const StorageState& state = state_tp(clock);
+  double old_charge = state.charged_energy(state_index_);
   //Apply Losses
-    double reduced_charged_energy = charged_energy_[clock]*efficiency(clock.now());
+    double reduced_charged_energy = state.discharge_limit(state_index_);
     //std::cout << "\t\t| reduced_charged_energy     = " << reduced_charged_energy << " GWh" << std::endl;
     double losses = old_charge - reduced_charged_energy;
     //std::cout << "\t\t| losses     = " << losses << " GWh" << std::endl;
@@ -197,12 +217,10 @@ bool Storage::useCapacityDischarge(const double energyOutput,
       charged_energy_new = 0.;//reset if small
     }
   }
-  charged_energy_ += aux::TimeSeriesConst(std::vector<double>{(charged_energy_new - old_charge)},
-                                          clock.now(),
-                                          clock.tick_length());
-  energy_lost_by_transfer_ += aux::TimeSeriesConst(std::vector<double>{losses , 0.},
-                                                   clock.now(),
-                                                   clock.tick_length());
+  add_charged_energy((charged_energy_new - old_charge), clock);
+  energy_lost_by_transfer_.add_pulse(losses,
+                                     clock.now(),
+                                     clock.tick_length());
   //std::cout << "\t"<< code() << "\t\t|new soc = " << charged_energy_[clock]/capacity(clock.now())*100 << "%" << std::endl;
   //Return status of useCapacity, update state variables in SysComponentActive
   return (SysComponentActive::useCapacity(energyOutput, clock, false));
@@ -225,9 +243,9 @@ bool Storage::useCapacityCharge(double inputEnergyRated,
     std::terminate();
   }
   //good conditions:
-  if (charged_energy_[clock] + inputEnergyRated - capacity(clock.now()) <= 0){
-    charged_energy_ += aux::TimeSeriesConst(std::vector<double>{(inputEnergyRated)}, clock.now(),
-                                            clock.tick_length());
+  const StorageState& state = state_tp(clock);
+  if (state.charged_energy(state_index_) + inputEnergyRated - state.capacity(state_index_) <= 0){
+    add_charged_energy(inputEnergyRated, clock);
     add_used_capacity(clock, -inputEnergyRated);
     add_usable_capacity(inputEnergyRated, clock);
     set_reserve_capacity_tp(clock,0.);
@@ -242,9 +260,20 @@ void Storage::print_current_capacities(const aux::SimulationClock& clock){
   std::cout << "\t\t\t | \t "<< std::setw(12)<< initial_SOC_ << "\t initial_SOC_" << std::endl;
   std::cout << "\t\t\t | \t "<< std::setw(12)<< initial_SOC_ << "\t initial_SOC_" << std::endl;
   std::cout << "\t\t\t | \t "<< std::setw(12)<< stored_energy_transfer_ << "\t stored_energy_transfer_" << std::endl;
-  std::cout << "\t\t\t | \t "<< std::setw(12)<< charged_energy_[clock] << "\t charged_energy_[tp]" << std::endl;
+  std::cout << "\t\t\t | \t "<< std::setw(12)<< state_->charged_energy(state_index_) << "\t charged_energy_[tp]" << std::endl;
   SysComponentActive::print_current_capacities(clock);
   std::cout << "\t\t\t | \t--------------------------------" << std::endl;
 }
 
+const StorageState& Storage::state_tp(const aux::SimulationClock& clock) const {
+  if (!state_->current(state_index_, clock.now()))
+    state_->set_current(state_index_, clock.now(), capacity(clock.now()), efficiency(clock.now()));
+  return *state_;
+}
+
+void Storage::add_charged_energy(double value, const aux::SimulationClock& clock) {
+  charged_energy_.add_step(value, clock.now(), clock.tick_length());
+  state_->add_charged_energy(state_index_, value);
+}
+
 } /* namespace dm_hsm */
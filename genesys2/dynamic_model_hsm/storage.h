@@ -32,9 +32,11 @@
 #ifndef DYNAMIC_MODEL_HSM_STORAGE_H_
 #define DYNAMIC_MODEL_HSM_STORAGE_H_
 
+#include <memory>
 #include <utility>
 
-#include <auxiliaries/time_series_const_addable.h>
+#include <auxiliaries/time_series_accumulator.h>
+#include <dynamic_model_hsm/storage_state.h>
 #include <dynamic_model_hsm/sys_component_active.h>
 
 namespace dm_hsm {
@@ -49,8 +51,18 @@ class Storage : public virtual SysComponentActive {
         sm::SysComponentActive(other), // virtual inheritance and deleted default c'tor
         SysComponentActive(other),
         charged_energy_(other.charged_energy_),
-        energy_lost_by_transfer_(other.energy_lost_by_transfer_) {}
-  Storage(Storage&&) = default;
+        energy_lost_by_transfer_(other.energy_lost_by_transfer_),
+        state_(std::make_shared<StorageState>()),
+        state_index_(state_->add(other.state_->charged_energy(other.state_index_))) {}
+  Storage(Storage&& other)
+      : builder::SysCompActPrototype(other), // virtual inheritance and deleted default c'tor
+        am::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+        sm::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+        SysComponentActive(std::move(other)),
+        charged_energy_(std::move(other.charged_energy_)),
+        energy_lost_by_transfer_(std::move(other.energy_lost_by_transfer_)),
+        state_(std::make_shared<StorageState>()),
+        state_index_(state_->add(other.state_->charged_energy(other.state_index_))) {}
   Storage& operator=(const Storage&) = delete;
   Storage& operator=(Storage&&) = delete;
   Storage(const sm::SysComponentActive& origin)
@@ -61,13 +73,26 @@ class Storage : public virtual SysComponentActive {
         initial_SOC_(0.),
         stored_energy_transfer_(-1.),
         charged_energy_(),
-        energy_lost_by_transfer_() {}
+        energy_lost_by_transfer_(),
+        state_(std::make_shared<StorageState>()),
+        state_index_(state_->add(0.)) {}
 
   /** \name Reset interface.*/
     ///@{
-  void ResetSequencedStorage(const aux::SimulationClock& clock); ///< Reset for new sequence
+  void ResetSequencedStorage(const aux::SimulationClock& clock,
+                             aux::SimulationClock::time_point tp_end_seq); ///< Reset for new sequence
   void ResetStorageCurrentTP(const aux::SimulationClock& clock); ///< Reset for new tp
   void setTransferStoredEnergy(const aux::SimulationClock& clock);
+  void ResetParametrisedStorage(); ///< Reset for new parametrisation of the model
+  void MergeOperationStorage(const Storage& other); ///< Add results of other, operated on a different time window
+  void attach_state(std::shared_ptr<StorageState> state); ///< Move the current state into the state block of the owning region
+  ///@}
+
+  /** \name Sequence transfer interface.*/
+    ///@{
+  double stored_energy_transfer() const {return stored_energy_transfer_;}
+  void set_stored_energy_transfer(double stored_energy) {stored_energy_transfer_ = stored_energy;}
+  double initial_stored_energy(aux::SimulationClock::time_point tp) const {return initial_SOC_ * capacity(tp);}
   ///@}
 
   /** \name Converter interface.*/
@@ -118,11 +143,15 @@ class Storage : public virtual SysComponentActive {
 
  private:
   double calculate_soc(const aux::SimulationClock& clock);
+  const StorageState& state_tp(const aux::SimulationClock& clock) const;
+  void add_charged_energy(double value, const aux::SimulationClock& clock);
   std::pair <bool, bool> connected_;
   double initial_SOC_ = 0.0;
   double stored_energy_transfer_ = -1.0; //energy transfer between sequences
-  aux::TimeSeriesConstAddable charged_energy_;  //monitoring the state_of_charge
-  aux::TimeSeriesConstAddable energy_lost_by_transfer_;//not used atm
+  aux::TimeSeriesAccumulator charged_energy_;  //monitoring the state_of_charge
+  aux::TimeSeriesAccumulator energy_lost_by_transfer_;//not used atm
+  std::shared_ptr<StorageState> state_; //current state of charge, shared with the other storages of the region
+  StorageState::index_type state_index_;
 };
 
 } /* namespace dm_hsm */
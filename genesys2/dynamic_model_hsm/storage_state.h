@@ -0,0 +1,100 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// storage_state.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef DYNAMIC_MODEL_HSM_STORAGE_STATE_H_
+#define DYNAMIC_MODEL_HSM_STORAGE_STATE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <auxiliaries/simulation_clock.h>
+
+namespace dm_hsm {
+
+/**
+ * @brief Structure-of-arrays block holding the per time point state of all storages of one region
+ *
+ * The stored energy is kept as a plain value, so the hot loop of the hsm reads the state of charge
+ * in O(1) instead of searching the recorded time series. Capacity and efficiency are looked up once
+ * per storage and time point and cached alongside.
+ */
+class StorageState {
+ public:
+  typedef std::size_t index_type;
+
+  StorageState() = default;
+  StorageState(const StorageState&) = delete;
+  StorageState& operator=(const StorageState&) = delete;
+
+  index_type add(double charged_energy) {
+    charged_energy_.push_back(charged_energy);
+    capacity_.push_back(0.);
+    efficiency_.push_back(0.);
+    tp_.push_back(aux::SimulationClock::time_point::min());
+    return charged_energy_.size() - 1;
+  }
+  index_type size() const {return charged_energy_.size();}
+
+  /** \name Stored energy.*/
+  ///@{
+  double charged_energy(const index_type index) const {return charged_energy_[index];}
+  void set_charged_energy(const index_type index, const double value) {charged_energy_[index] = value;}
+  void add_charged_energy(const index_type index, const double value) {charged_energy_[index] += value;}
+  ///@}
+
+  /** \name Cached lookups of the current time point.*/
+  ///@{
+  bool current(const index_type index, const aux::SimulationClock::time_point tp) const {return tp_[index] == tp;}
+  void set_current(const index_type index,
+                   const aux::SimulationClock::time_point tp,
+                   const double capacity,
+                   const double efficiency) {
+    tp_[index] = tp;
+    capacity_[index] = capacity;
+    efficiency_[index] = efficiency;
+  }
+  void invalidate(const index_type index) {tp_[index] = aux::SimulationClock::time_point::min();}
+  double capacity(const index_type index) const {return capacity_[index];}
+  double efficiency(const index_type index) const {return efficiency_[index];}
+  double discharge_limit(const index_type index) const {return charged_energy_[index] * efficiency_[index];}
+  double charge_limit(const index_type index) const {return capacity_[index] - discharge_limit(index);}
+  ///@}
+
+ private:
+  std::vector<double> charged_energy_;
+  std::vector<double> capacity_;
+  std::vector<double> efficiency_;
+  std::vector<aux::SimulationClock::time_point> tp_;
+};
+
+} /* namespace dm_hsm */
+
+#endif /* DYNAMIC_MODEL_HSM_STORAGE_STATE_H_ */
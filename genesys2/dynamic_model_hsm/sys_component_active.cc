@@ -30,30 +30,32 @@
 // This file is part of the genesys-framework v.2
 
 #include <dynamic_model_hsm/sys_component_active.h>
+#include <auxiliaries/discount_table.h>
 #include <auxiliaries/functions.h>
 #include <program_settings.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 
 namespace dm_hsm {
 
 double SysComponentActive::usable_capacity_out_tp(const aux::SimulationClock& clock, double reqInput) const {
-  if (capacity(clock.now()) > 0) {
-    return std::min(reqInput*efficiency(clock.now()),usable_capacity_tp());
+  if (capacity_tp(clock) > 0) {
+    return std::min(reqInput*efficiency_tp(clock),usable_capacity_tp());
   }
   return 0.0;
 }
 
 double SysComponentActive::usable_capacity_el(const aux::SimulationClock& clock) const {
-  if (capacity(clock.now()) > genesys::ProgramSettings::approx_epsilon()) {
+  if (capacity_tp(clock) > genesys::ProgramSettings::approx_epsilon()) {
     return usable_capacity_el_tp_;
   }
   return 0.; //else
 }
 
 double SysComponentActive::usable_capacity_in_tp(const aux::SimulationClock& clock, double requestedOutput) const {
-  if (capacity(clock.now()) > genesys::ProgramSettings::approx_epsilon()) {
+  if (capacity_tp(clock) > genesys::ProgramSettings::approx_epsilon()) {
     //CBU forstorage not correct: return (std::min(requestedOutput/efficiency(clock.now()), usable_capacity_in_tp(clock))) ;
     return (std::min(requestedOutput, usable_capacity_el(clock))) ;
   }
@@ -62,10 +64,83 @@ double SysComponentActive::usable_capacity_in_tp(const aux::SimulationClock& clo
 
 void SysComponentActive::resetCurrentTP(const aux::SimulationClock& clock) {
   //DEBUG  std::cout << aux::SimulationClock::time_point_to_string(clock.now()) <<"\t converter/componentActive = " << std::setw(20)<< code() << " | capacity= " << capacity(clock.now()) << std::endl;
-  set_usable_capacity_tp(capacity(clock.now()));
+  set_kernel_tp(clock.now());
+  kernel_.capacity_tp = (kernel_.tick != KernelRecord::npos && !kernel_.capacity.empty()) ? kernel_.capacity[kernel_.tick]
+                                                                                         : capacity(clock.now());
+  set_usable_capacity_tp(capacity_tp(clock));
   set_reserve_capacity_tp(clock,0.);
 }
 
+void SysComponentActive::set_capacity_tp(const aux::SimulationClock& clock, double capacity) {
+  set_kernel_tp(clock.now());
+  kernel_.capacity_tp = capacity;
+}
+
+void SysComponentActive::set_kernel_tp(aux::SimulationClock::time_point tp) {
+  kernel_.tp = tp;
+  kernel_.tick = KernelRecord::npos;
+  if (kernel_.ticks > 0 && !(tp < kernel_.first_tp)) {
+    auto offset = tp - kernel_.first_tp;
+    auto tick = static_cast<std::size_t>(offset / kernel_.tick_length);
+    if (tick < kernel_.ticks && offset % kernel_.tick_length == aux::SimulationClock::duration::zero())
+      kernel_.tick = tick;
+  }
+}
+
+void SysComponentActive::add_used_capacity(const aux::SimulationClock& clock, double value) {
+  if (clock.now() == kernel_.tp && kernel_.tick != KernelRecord::npos && !kernel_.used.empty()) {
+    kernel_.used[kernel_.tick] += value;
+    kernel_.used_begin = std::min(kernel_.used_begin, kernel_.tick);
+    kernel_.used_end = std::max(kernel_.used_end, kernel_.tick + 1);
+    return;
+  }
+  used_capacity_.add_pulse(value, clock.now(), clock.tick_length());
+  //std::cout << code() << " | " << aux::SimulationClock::time_point_to_string(clock.now()) << " used_capacity = " << value << std::endl;
+}
+
+void SysComponentActive::lowerKernel(aux::SimulationClock::time_point tp_start,
+                                     aux::SimulationClock::time_point tp_end,
+                                     aux::SimulationClock::duration tick_length,
+                                     const bool sample_capacity) {
+  //the ticks of a sequence run from tp_start up to and including tp_end, see HSMOperation::solveSequence()
+  kernel_.first_tp = tp_start;
+  kernel_.tick_length = tick_length;
+  kernel_.ticks = (tp_end < tp_start) ? 0 : static_cast<std::size_t>((tp_end - tp_start) / tick_length) + 1;
+  kernel_.capacity.clear();
+  if (sample_capacity && kernel_.ticks > 0) {
+    kernel_.capacity.resize(kernel_.ticks);
+    get_capacity_().sample(tp_start, tick_length, kernel_.ticks, kernel_.capacity.data());
+  }
+  //pulses added before the dispatch (generation from the potential) stay in front, the operation of these components
+  //is added to the accumulator directly so that the values of a tick are summed in the same order
+  kernel_.used.assign(used_capacity_.empty() ? kernel_.ticks : 0, 0.);
+  kernel_.used_begin = KernelRecord::npos;
+  kernel_.used_end = 0;
+  kernel_.tp = aux::SimulationClock::time_point::min();
+  kernel_.tick = KernelRecord::npos;
+}
+
+void SysComponentActive::writeBackKernel() {
+  //untouched ticks within the range add zero, as the gaps between two pulses of the accumulator
+  if (kernel_.used_begin < kernel_.used_end) {
+    auto first_tp = kernel_.first_tp
+                    + static_cast<aux::SimulationClock::duration::rep>(kernel_.used_begin) * kernel_.tick_length;
+    used_capacity_.add_pulses(&kernel_.used[kernel_.used_begin], kernel_.used_end - kernel_.used_begin,
+                              first_tp, kernel_.tick_length);
+    std::fill(kernel_.used.begin() + kernel_.used_begin, kernel_.used.begin() + kernel_.used_end, 0.);
+  }
+  kernel_.used_begin = KernelRecord::npos;
+  kernel_.used_end = 0;
+}
+
+double SysComponentActive::efficiency_tp(const aux::SimulationClock& clock) const {
+  //same result as am::SysComponentActive::efficiency(tp), without the second capacity lookup
+  if (capacity_tp(clock) > genesys::ProgramSettings::approx_epsilon() &&
+      mean_efficiency() > genesys::ProgramSettings::approx_epsilon())
+    return mean_efficiency();
+  return efficiency(clock.now()); //-1 without capacity, terminates on a corrupted mean efficiency
+}
+
 void SysComponentActive::set_annaul_lookups(const aux::SimulationClock& clock) {
 	set_mean_efficiency(clock);
 }
@@ -90,18 +165,61 @@ bool SysComponentActive::useCapacity(double capacity_request,
 
 void SysComponentActive::resetSequencedSysComponent() {
   //reset all information that is stored on high resolution from operation simulation.
-  used_capacity_ = aux::TimeSeriesConstAddable();
+  used_capacity_.clear();
+}
+
+void SysComponentActive::resetParametrisedSysComponent(const am::SysComponentActive& origin) {
+  //restore the state of a newly constructed component without additional installations
+  ResetInstallation(origin);
+  resetOperationSysComponent();
+  bake_lookup_tables();
 }
 
+void SysComponentActive::resetOperationSysComponent() {
+  //reset all results of the operation simulation, the installation is kept
+  active_current_year_ = true;
+  vopex_.clear();
+  fopex_.clear();
+  used_capacity_.clear();
+  discounted_capex_.clear();
+  usable_capacity_el_tp_ = 0.;
+  reserved_capacity_el_tp_ = 0.;
+  kernel_ = KernelRecord();
+}
+
+void SysComponentActive::mergeOperationSysComponent(const SysComponentActive& other) {
+  //add the values that are kept between sequences, other was operated on a different time window
+  vopex_.add_series(other.vopex_);
+  fopex_.add_series(other.fopex_);
+  discounted_capex_.add_series(other.discounted_capex_);
+}
+
+void SysComponentActive::resetParametrisedSysComponent(const am::SysComponentActive& origin,
+                                                       const std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                                        aux::SimulationClock::time_point,
+                                                                        aux::SimulationClock::time_point,
+                                                                        aux::SimulationClock::duration>& installation) {
+  ResetInstallation(origin);
+  resetOperationSysComponent();
+  MapInstallation(std::move((*std::get<0>(installation)).clone()), std::get<1>(installation),
+                  std::get<2>(installation), std::get<3>(installation));
+  kernel_ = KernelRecord(); //capacity changed by the installation
+  bake_lookup_tables();
+}
+
+void SysComponentActive::bake_lookup_tables() {
+  //sample the efficiency table for the simulation window, see aux::TBDLookupTable::bake
+  if (genesys::ProgramSettings::bake_lookup_tables())
+    BakeEfficiency(genesys::ProgramSettings::simulation_start(), genesys::ProgramSettings::simulation_end());
+}
 
 void SysComponentActive::add_OaM_cost(aux::SimulationClock::time_point tp_now) {
 	//std::cout << "SysComponentActive::add_OaM_cost for converter " << code() << " with ";
 	double fopex = capex(tp_now) * OaM_rate(tp_now);
 	//	std::cout << "\t\t fopex" << code() << " fuer: " << aux::SimulationClock::time_point_to_string(tp_now)  <<" : " << fopex<< std::endl;
-	auto year = aux::SimulationClock::year(tp_now);
-	auto new_tp = aux::SimulationClock::time_point_from_string(std::to_string(year)+"-01-01_00:00");
+	auto new_tp = aux::SimulationClock::year_start(tp_now);
 	//std::cout << aux::SimulationClock::time_point_to_string(new_tp) << std::endl;
-	fopex_ += aux::TimeSeriesConst(std::vector<double>{fopex, 0.}, new_tp, aux::years(1));
+	fopex_.add_pulse(fopex, new_tp, aux::years(1));
  	//std::cout << "\tfopex" << code() << " : "<< fopex_.PrintToString() << std::endl;
 }
 
@@ -117,7 +235,7 @@ void SysComponentActive::add_vopex(double value,
         std::cerr << "EXIT" << std::endl;
         std::terminate();
       }
-      vopex_ += aux::TimeSeriesConst(std::vector<double>{value, 0.}, clock.now(), clock.tick_length());
+      vopex_.add_pulse(value, clock.now(), clock.tick_length());
       //std::cout << "VOPEX = " << value << " \t" << aux::SimulationClock::time_point_to_string(tp_now) << std::endl;
     }
     //std::cout << "END FUNC SysComponentActive::add_vopex for "<< code() << std::endl;
@@ -206,28 +324,7 @@ double SysComponentActive::getDiscountedValue(std::string query,
     //std::cerr << "SysComponentActive::getDiscountedValue - not implemented for ENERGY query > " << query << std::endl;
   } else if (query == "VOPEX") {
      //   std::cout << "\t VOPEX \t Component=  " << code() <<  std::endl;
-    std::vector<double> annual_vopex_vec;
-    aux::SimulationClock printClock(start, aux::years(1));
-    do {
-      //Mean per hour of the year from total sum of TBD
-      double current_val = 8760*vopex_.Mean(printClock.now(), printClock.now()+aux::years(1));
-      if (current_val >= 1) {
-        annual_vopex_vec.push_back(current_val);
-      } else {
-        //std::cout << "value was : " << current_val << std::endl;
-        annual_vopex_vec.push_back(0.);
-      }
-    } while (printClock.tick() < end);
-    ;
-
-    discounted_value += aux::DiscountFuture2(aux::TimeSeriesConst(annual_vopex_vec,
-                                                                 start,
-                                                                 aux::years(1)),
-                                                                 start,
-                                                                 end,
-                                                                 aux::years(1),
-                                                                 genesys::ProgramSettings::interest_rate(),
-                                                                 present);
+    discounted_value += discounted_vopex(start, end, present);
    } else {
      std::cerr << "ERROR in dm_hsm::SysComponentActive::getDiscountedValue() : query " << query
                 <<" could not be identified!" << std::endl;
@@ -238,6 +335,58 @@ double SysComponentActive::getDiscountedValue(std::string query,
 
 }
 
+void SysComponentActive::accumulate_cost_metrics(aux::SimulationClock::time_point start,
+                                                 aux::SimulationClock::time_point end,
+                                                 const aux::SimulationClock::time_point present,
+                                                 CostMetricTotals& totals) const {
+  //std::cout << "FUNC-ID: SysComponentActive::accumulate_cost_metrics in " << code() << std::endl;
+  //same results as get_sum/getDiscountedValue for CAPEX, FOPEX and VOPEX, but capex and irr are evaluated once
+  auto capex_series = capex(start, end);
+  totals.add_sum(CostMetric::CAPEX, aux::sum(capex_series, start, end, aux::years(1)));
+  if (!fopex_.empty()) {
+    totals.add_sum(CostMetric::FOPEX, aux::sum(fopex_, start, end, aux::years(1)));
+  }
+  //capex and fopex are discounted with the same rate in one pass over the annual values
+  auto count = aux::DiscountTable::periods(start, end, aux::years(1));
+  std::vector<double> annual_values(2 * count);
+  double discounted[2] = {0., 0.};
+  if (count > 0) {
+    capex_series.sample(start, aux::years(1), count, &annual_values[0]);
+    fopex_.sample(start, aux::years(1), count, &annual_values[count]);
+    aux::DiscountTable(internal_rate_of_return(start)).discounted_sums(annual_values.data(), count, 2,
+                                                                       aux::DiscountTable::first_step(start, present),
+                                                                       discounted);
+  }
+  totals.add_discounted(CostMetric::CAPEX, discounted[0]);
+  totals.add_discounted(CostMetric::FOPEX, discounted[1]);
+  if (!vopex_.empty()) {
+    totals.add_sum(CostMetric::VOPEX, 8760*aux::sum_means(vopex_, start, end, aux::years(1)));
+  }
+  totals.add_discounted(CostMetric::VOPEX, discounted_vopex(start, end, present));
+}
+
+double SysComponentActive::discounted_vopex(aux::SimulationClock::time_point start,
+                                            aux::SimulationClock::time_point end,
+                                            const aux::SimulationClock::time_point present) const {
+  std::vector<double> annual_vopex_vec;
+  aux::SimulationClock printClock(start, aux::years(1));
+  do {
+    //Mean per hour of the year from total sum of TBD
+    double current_val = 8760*vopex_.Mean(printClock.now(), printClock.now()+aux::years(1));
+    if (current_val >= 1) {
+      annual_vopex_vec.push_back(current_val);
+    } else {
+      //std::cout << "value was : " << current_val << std::endl;
+      annual_vopex_vec.push_back(0.);
+    }
+  } while (printClock.tick() < end);
+
+  //one value per year from start, so the vector is discounted directly
+  return (aux::DiscountTable(genesys::ProgramSettings::interest_rate()).discounted_sum(
+      annual_vopex_vec.data(), aux::DiscountTable::periods(start, end, aux::years(1)),
+      aux::DiscountTable::first_step(start, present)));
+}
+
 void SysComponentActive::calculated_annual_disc_capex(aux::SimulationClock::time_point start) {
   //std::cout << "FUNC-ID SysComponentActive::calculated_annual_disc_capex for " << code() << std::endl;
   double discounted_value = 0.;
@@ -247,7 +396,7 @@ void SysComponentActive::calculated_annual_disc_capex(aux::SimulationClock::time
                                                aux::years(1),
                                                internal_rate_of_return(start),
                                                genesys::ProgramSettings::simulation_start());
-  discounted_capex_ += aux::TimeSeriesConst(std::vector<double>{discounted_value, 0.}, start, aux::years(1));
+  discounted_capex_.add_pulse(discounted_value, start, aux::years(1));
 }
 
 bool SysComponentActive::set_reserve_capacity_tp(const aux::SimulationClock& clock, double capacity_to_reserve) {
@@ -255,7 +404,7 @@ bool SysComponentActive::set_reserve_capacity_tp(const aux::SimulationClock& clo
 	// std::cout << "SysComponentActive::set_reserve_capacity_tp : trying to reserve small cap for " << code() << std::endl;
     reserved_capacity_el_tp_ = 0.;
     return false;//case reset to zero!
-  } else if ( capacity_to_reserve > capacity(clock.now())+ genesys::ProgramSettings::approx_epsilon()) {
+  } else if ( capacity_to_reserve > capacity_tp(clock)+ genesys::ProgramSettings::approx_epsilon()) {
     std::cerr << "ERROR in SysComponentActive::set_reserve_capacity_tp " << code() << " - reserving "<< capacity_to_reserve << " >100% capacity!"<< capacity(clock.now()) << std::endl;
     std::terminate();
   } else {
@@ -32,9 +32,15 @@
 #ifndef DYNAMIC_MODEL_HSM_SYS_COMPONENT_ACTIVE_H_
 #define DYNAMIC_MODEL_HSM_SYS_COMPONENT_ACTIVE_H_
 
-#include <auxiliaries/time_series_const_addable.h>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <auxiliaries/time_series_accumulator.h>
 #include <static_model/sys_component_active.h>
 #include <auxiliaries/functions.h>
+#include <dynamic_model_hsm/cost_metric.h>
 #include <program_settings.h>
 
 namespace dm_hsm {
@@ -51,6 +57,19 @@ class SysComponentActive : public virtual sm::SysComponentActive {
     void resetCurrentTP(const aux::SimulationClock& clock);
     void set_annaul_lookups(const aux::SimulationClock& clock);
     void resetSequencedSysComponent();
+    void resetParametrisedSysComponent(const am::SysComponentActive& origin);
+    void resetParametrisedSysComponent(const am::SysComponentActive& origin,
+                                       const std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                        aux::SimulationClock::time_point,
+                                                        aux::SimulationClock::time_point,
+                                                        aux::SimulationClock::duration>& installation);
+    void resetOperationSysComponent();
+    void mergeOperationSysComponent(const SysComponentActive& other);
+    void lowerKernel(aux::SimulationClock::time_point tp_start,
+                     aux::SimulationClock::time_point tp_end,
+                     aux::SimulationClock::duration tick_length,
+                     const bool sample_capacity = true);
+    void writeBackKernel();
   ///@}
 
   /** \name Hierarchical Operation Functions.*/
@@ -81,6 +100,10 @@ class SysComponentActive : public virtual sm::SysComponentActive {
                               aux::SimulationClock::time_point start,
                               aux::SimulationClock::time_point end,
                               const aux::SimulationClock::time_point present) const;
+    void accumulate_cost_metrics(aux::SimulationClock::time_point start,
+                                 aux::SimulationClock::time_point end,
+                                 const aux::SimulationClock::time_point present,
+                                 CostMetricTotals& totals) const;
   ///@}
 
   /** \name Operation Status.*/
@@ -102,7 +125,16 @@ class SysComponentActive : public virtual sm::SysComponentActive {
     discounted_capex_(other.discounted_capex_),
     usable_capacity_el_tp_(0.),
     reserved_capacity_el_tp_(0.){}//DEBUG std::cout << "dm_hsm::SCA::CopyC'tor called for " << code() << std::endl;}
-  SysComponentActive(SysComponentActive&&) = default;
+  SysComponentActive(SysComponentActive&& other) // static data is copied, the operation histories are handed over
+  : builder::SysCompActPrototype(other), // virtual inheritance and deleted default c'tor
+    am::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+    sm::SysComponentActive(other),
+    vopex_(std::move(other.vopex_)),
+    fopex_(std::move(other.fopex_)),
+    used_capacity_(std::move(other.used_capacity_)),
+    discounted_capex_(std::move(other.discounted_capex_)),
+    usable_capacity_el_tp_(0.),
+    reserved_capacity_el_tp_(0.){}
   SysComponentActive(const sm::SysComponentActive& origin)
       : builder::SysCompActPrototype(origin), // virtual inheritance and deleted default c'tor
         am::SysComponentActive(origin), // virtual inheritance and deleted default c'tor
@@ -113,20 +145,29 @@ class SysComponentActive : public virtual sm::SysComponentActive {
         used_capacity_(),
         discounted_capex_(),
         usable_capacity_el_tp_(0.),
-        reserved_capacity_el_tp_(0.) {}//DEBUGstd::cout << "dm_hsm::SCA::C'tor called for " << code() << std::endl;}
+        reserved_capacity_el_tp_(0.) {bake_lookup_tables();}//DEBUGstd::cout << "dm_hsm::SCA::C'tor called for " << code() << std::endl;}
 
   void set_active_current_year(bool state) {active_current_year_ = state;}
+  /** \name Lookups of the current tp, see KernelRecord*/
+  ///@{
+  double capacity_tp(const aux::SimulationClock& clock) const {
+    return (clock.now() == kernel_.tp) ? kernel_.capacity_tp : capacity(clock.now());}
+  double efficiency_tp(const aux::SimulationClock& clock) const;
+  void set_capacity_tp(const aux::SimulationClock& clock, double capacity);
+  ///@}
   double used_capacity( aux::SimulationClock::time_point tp) const {return used_capacity_[tp];}
-  void add_used_capacity(const aux::SimulationClock& clock, double value) {
-              used_capacity_ += aux::TimeSeriesConst(std::vector<double>{value, 0.}, clock.now(), clock.tick_length());
-              //std::cout << code() << " | " << aux::SimulationClock::time_point_to_string(clock.now()) << " used_capacity = " << value << std::endl;
+  void add_used_capacity(const aux::SimulationClock& clock, double value);
+  void add_used_capacity(aux::SimulationClock::time_point tp_start,
+                         aux::SimulationClock::duration tick_length,
+                         const std::vector<double>& values) {
+              used_capacity_.add_pulses(values.data(), values.size(), tp_start, tick_length);
   }
   void set_usable_capacity_tp(double usable_capacity) {usable_capacity_el_tp_ = usable_capacity;}
   void add_usable_capacity(double added_used_capcity, const aux::SimulationClock& clock) {
     if (0 > (added_used_capcity + usable_capacity_tp()) ) {
       std::cerr << "WARNING add_usable_capacity: resulting in negative capacity " << added_used_capcity  << " | usable_cap=" << usable_capacity_tp()<< std::endl;
-    } else if (aux::cmp_equal(capacity(clock.now()), (added_used_capcity + usable_capacity_tp()), genesys::ProgramSettings::approx_epsilon())) {
-      usable_capacity_el_tp_ = capacity(clock.now());
+    } else if (aux::cmp_equal(capacity_tp(clock), (added_used_capcity + usable_capacity_tp()), genesys::ProgramSettings::approx_epsilon())) {
+      usable_capacity_el_tp_ = capacity_tp(clock);
       return;
     }
     usable_capacity_el_tp_ += added_used_capcity;}
@@ -144,16 +185,44 @@ class SysComponentActive : public virtual sm::SysComponentActive {
     ///@}
 
  private:
+  /**
+   * @brief Plain record of the component for the dispatch of one sequence, see lowerKernel()
+   *
+   * The installed capacity of every tick is sampled once when the sequence starts, the dispatch reads it by the tick
+   * of the current tp instead of looking it up through the virtual bases and the installation time series. The
+   * operation is collected per tick in used and handed to used_capacity_ by writeBackKernel(). Time points outside
+   * of the sequence fall back to the lookup and the accumulator.
+   */
+  struct KernelRecord {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    aux::SimulationClock::time_point first_tp = aux::SimulationClock::time_point::min();
+    aux::SimulationClock::duration tick_length = aux::SimulationClock::duration::zero();
+    std::size_t ticks = 0; ///< ticks of the sequence, 0 if not lowered
+    std::vector<double> capacity; ///< installed capacity per tick, empty if set per tp by the owner
+    std::vector<double> used; ///< operation per tick not yet in used_capacity_, empty if added there directly
+    std::size_t used_begin = npos; ///< first tick of used that was written since the last write back
+    std::size_t used_end = 0; ///< one past the last tick of used that was written since the last write back
+    aux::SimulationClock::time_point tp = aux::SimulationClock::time_point::min(); ///< current tp
+    std::size_t tick = npos; ///< tick of the current tp, npos outside of the sequence
+    double capacity_tp = 0.; ///< installed capacity at the current tp
+  };
+
   void add_vopex_zero(aux::SimulationClock::time_point tp_now, aux::SimulationClock::duration tick_length) {
-                      vopex_ += aux::TimeSeriesConst(std::vector<double>{1.,0.}, tp_now, tick_length); }
+                      vopex_.add_pulse(1., tp_now, tick_length); }
+  void bake_lookup_tables();
+  double discounted_vopex(aux::SimulationClock::time_point start,
+                          aux::SimulationClock::time_point end,
+                          const aux::SimulationClock::time_point present) const;
   double usable_capacity_tp() const ;//{return usable_capacity_tp_;}
+  void set_kernel_tp(aux::SimulationClock::time_point tp);
   bool active_current_year_ = true;
-  aux::TimeSeriesConstAddable vopex_;
-  aux::TimeSeriesConstAddable fopex_;
-  aux::TimeSeriesConstAddable used_capacity_; ///stores the operation information in detail
-  aux::TimeSeriesConstAddable discounted_capex_;
+  aux::TimeSeriesAccumulator vopex_;
+  aux::TimeSeriesAccumulator fopex_;
+  aux::TimeSeriesAccumulator used_capacity_; ///stores the operation information in detail
+  aux::TimeSeriesAccumulator discounted_capex_;
   double usable_capacity_el_tp_;  /// possible amount of deliverable capacity for current time point
   double reserved_capacity_el_tp_; /// stores amount of capacity which could be requested for transport to other region
+  KernelRecord kernel_;
 };
 
 } /* namespace dm_hsm */
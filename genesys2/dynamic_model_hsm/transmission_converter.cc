@@ -44,8 +44,20 @@ void TransmissionConverter::ResetSequencedTransmConverter() {
 	ResetSequencedConverter();
 }
 
+void TransmissionConverter::ResetParametrisedTransmConverter() {
+  ResetParametrisedConverter();
+  delivered_energy_.clear();
+  active_ = false;
+  forward_ = false;
+}
+
+void TransmissionConverter::MergeOperationTransmConverter(const TransmissionConverter& other) {
+  MergeOperationConverter(other);
+  delivered_energy_.add_series(other.delivered_energy_);
+}
+
 double TransmissionConverter::get_transmittable_pwr_infeed(const aux::SimulationClock& clock, double req_output) const {
-   if (capacity(clock.now()) > genesys::ProgramSettings::approx_epsilon()) {
+   if (capacity_tp(clock) > genesys::ProgramSettings::approx_epsilon()) {
      double maxOutput = std::min(usable_capacity_el(clock), req_output);
      double request_transformed_to_infeed  = maxOutput/efficiency(clock.now(),maxOutput);
      return request_transformed_to_infeed;
@@ -70,14 +82,14 @@ double TransmissionConverter::reserveTransmission(const aux::SimulationClock& cl
 bool TransmissionConverter::useTransmission(const dm_hsm::HSMCategory cat,
                                             const double import_request,
                                             const aux::SimulationClock& clock,
-                                            const std::weak_ptr<Region>& supply_region,
-                                            const std::weak_ptr<Link>& active_Link){
+                                            Region* supply_region,
+                                            const Link* active_Link){
   //std::cout << "call FUNC-ID: TransmissionConverter::useTransmission" << std::endl;
   bool transmission_succeedes = false;
   if (!(import_request > reserved_capacity_tp())) {
     //inflate import to infeed
     double requested_infeed = import_request / efficiency(clock.now(), import_request);
-    transmission_succeedes = supply_region.lock()->useExportCapacity(cat, requested_infeed, clock, active_Link.lock());
+    transmission_succeedes = supply_region->useExportCapacity(cat, requested_infeed, clock, active_Link);
     if (!transmission_succeedes){
       //          std::cout << "**WARNING : "<< supply_region.lock()->code() <<" failed in useExportCapacity() TP:\t\t"<<
       //                    aux::SimulationClock::time_point_to_string(clock.now()) << std::endl;
@@ -106,15 +118,12 @@ bool TransmissionConverter::update_current_state(const bool region_provide_statu
     } else {
       signed_pwr_transfer = -pwr_transfer;
     }
-    delivered_energy_ += aux::TimeSeriesConst(std::vector<double>{signed_pwr_transfer, 0.},
-                                              clock.now(),
-                                              clock.tick_length());
+    delivered_energy_.add_pulse(signed_pwr_transfer,
+                                clock.now(),
+                                clock.tick_length());
     //DEBUG std::cout << pwr_transfer << std::endl;
     double losses = pwr_transfer * (-1 + 1/efficiency(clock.now(), pwr_transfer));
-    auto TSA_losses = aux::TimeSeriesConst(std::vector<double>{losses, 0.},
-                                           clock.now(),
-                                           clock.tick_length());
-    set_losses(TSA_losses);
+    set_losses(losses, clock);
     set_reserve_capacity_tp(clock,0.);
     set_active_current_year(true);
     add_used_capacity(clock, pwr_transfer);
@@ -65,7 +65,20 @@ class TransmissionConverter : public virtual Converter {
     delivered_energy_(other.delivered_energy_),
     active_ (0),
     forward_(0){}
-  TransmissionConverter(TransmissionConverter&&) = default;
+  TransmissionConverter(TransmissionConverter&& other)
+  : builder::SysCompActPrototype(other), // virtual inheritance and deleted default c'tor
+    builder::ConverterPrototype(other), // virtual inheritance and deleted default c'tor
+    am::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+    am::Converter(other), // virtual inheritance and deleted default c'tor
+    sm::SysComponentActive(other), // virtual inheritance and deleted default c'tor
+    sm::Converter(other), // virtual inheritance and deleted default c'tor
+    SysComponentActive(std::move(other)), // virtual inheritance and deleted default c'tor
+    Converter(std::move(other)),
+    hsm_category_(other.hsm_category_),
+    hsm_sub_category_(other.hsm_sub_category_),
+    delivered_energy_(std::move(other.delivered_energy_)),
+    active_ (0),
+    forward_(0){}
   TransmissionConverter& operator=(const TransmissionConverter&) = delete;
   TransmissionConverter& operator=(TransmissionConverter&&) = delete;
   TransmissionConverter(const sm::Converter& origin)
@@ -85,6 +98,8 @@ class TransmissionConverter : public virtual Converter {
   /** \name Reset interface.*/
     ///@{
     void ResetSequencedTransmConverter();
+    void ResetParametrisedTransmConverter();
+    void MergeOperationTransmConverter(const TransmissionConverter& other);
     void resetCurrentTP(const aux::SimulationClock& clock) {
       SysComponentActive::resetCurrentTP(clock);
       active_ = false; }
@@ -107,8 +122,8 @@ class TransmissionConverter : public virtual Converter {
   bool useTransmission(const dm_hsm::HSMCategory cat,
                            const double import_request,
                            const aux::SimulationClock& clock,
-                           const std::weak_ptr<Region>& supply_region,
-                           const std::weak_ptr<Link>& active_Link);
+                           Region* supply_region,
+                           const Link* active_Link);
   ///@}
   void print_current_capacities() const;
   //  double getDiscountedLosses(aux::SimulationClock::time_point start,
@@ -143,7 +158,7 @@ class TransmissionConverter : public virtual Converter {
   dm_hsm::HSMCategory hsm_category_;
   dm_hsm::HSMSubCategory hsm_sub_category_ = dm_hsm::HSMSubCategory::UNAVAILABLE;
   ///Dynamic information
-  aux::TimeSeriesConstAddable delivered_energy_;
+  aux::TimeSeriesAccumulator delivered_energy_;
   bool active_;
   bool forward_; //forward A->B
 };
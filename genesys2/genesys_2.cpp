@@ -35,9 +35,13 @@
 #include <program_settings.h>
 #include <abstract_model/abstract_model.h>
 #include <analysis_hsm/hsm_analysis.h>
+#include <benchmark/hsm_benchmark.h>
+#include <benchmark/phase_profiler.h>
+#include <benchmark/scenario_generator.h>
 #include <builder/model_builder.h>
 #include <optim_cmaes/cma_connect.h>
 #include <optim_cmaes/installation_list.h>
+#include <optim_cmaes/mpi_evaluator.h>
 #include <io_routines/xml_writer.h>
 
 #include <auxiliaries/time_tools.h>
@@ -56,9 +60,31 @@ int main( int argc, const char* argv[]) {
 //First Input are  the command line arguments to choose --mode= and --threads=//
 genesys::CmdParameters MyCmdParameters(argc, argv);
 
+if (MyCmdParameters.Mode() == "generate") {
+  //writes a synthetic scenario including its ProgramSettings.dat, nothing else to do
+  benchmark::ScenarioGenerator(genesys::CmdParameters::generator_regions(),
+                               genesys::CmdParameters::generator_links(),
+                               genesys::CmdParameters::generator_technologies(),
+                               genesys::CmdParameters::generator_years()).Write(genesys::CmdParameters::GetScenarioName());
+  std::cout <<"End Main Function!" << std::endl;
+  return (0);
+}
+
 //Second Input is the ProgramSettings.dat file(or other .dat specified by --settings= argument//
 genesys::ProgramSettings MySettings(MyCmdParameters.getProgramSettingsFile());
 
+if (MyCmdParameters.Mode() == "benchmark") {
+  //model construction is part of the measurement
+  benchmark::HSMBenchmark MyBenchmark(genesys::CmdParameters::benchmark_evaluations());
+  MyBenchmark.Run(MyCmdParameters.InputFile());
+  MyBenchmark.Print();
+#ifdef GENESYS_PROFILE
+  benchmark::PhaseProfiler::Write(MyCmdParameters.OutputFile());
+#endif
+  std::cout <<"End Main Function!" << std::endl;
+  return (0);
+}
+
 //Third is the initialisation of the abstract model
 auto TheModel = builder::ModelBuilder().Create();
 
@@ -69,14 +95,30 @@ if (MyCmdParameters.Mode() == "optimisation") {
   //use the given optimisation algorithm to calculate system evolution
   optim_cmaes::CMA_connect MyCMA_Connect("InstallationList.csv", TheModel);
   std::cout << "Number of CPU-threads used = " << omp_get_max_threads() << std::endl;
+#ifdef GENESYS_USE_MPI
+  //every rank holds its own model, rank 0 optimises and the others only evaluate candidates
+  optim_cmaes::MpiEvaluator MyMpiEvaluator;
+  MyCMA_Connect.RunOptimiser(MyMpiEvaluator);
+  if (!MyMpiEvaluator.root()) {
+    std::cout <<"End Main Function!" << std::endl;
+    return (0);
+  }
+#else
   MyCMA_Connect.RunOptimiser();
+#endif
   analysis_hsm::HSMAnalysis MyAnalysis(MyCMA_Connect.installation_list(), TheModel);
   MyAnalysis.RunAnalysis(MyCmdParameters.OutputFile());
+#ifdef GENESYS_PROFILE
+  benchmark::PhaseProfiler::Write(MyCmdParameters.OutputFile());
+#endif
 }
 
 if (MyCmdParameters.Mode() == "analysis") {
   analysis_hsm::HSMAnalysis MyAnalysis(optim_cmaes::InstallationList(MyCmdParameters.InputFile()), TheModel);
   MyAnalysis.RunAnalysis(MyCmdParameters.OutputFile());
+#ifdef GENESYS_PROFILE
+  benchmark::PhaseProfiler::Write(MyCmdParameters.OutputFile());
+#endif
 }
 if (MyCmdParameters.Mode() == "test") {
   std::cout << "test mode - doing nothing for now!" << std::endl;
@@ -0,0 +1,101 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// async_file_writer.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <io_routines/async_file_writer.h>
+
+#include <exception>
+#include <iostream>
+#include <utility>
+
+namespace io_routines {
+
+AsyncFileWriter::AsyncFileWriter(const std::string& filename, std::size_t max_queued_chunks)
+    : filename_(filename),
+      output_(filename),
+      max_queued_chunks_(max_queued_chunks > 0 ? max_queued_chunks : 1),
+      queue_(),
+      mutex_(),
+      queue_changed_(),
+      closing_(false),
+      worker_() {
+  if (!output_.is_open()) {
+    std::cerr << "ERROR in io_routines::AsyncFileWriter::AsyncFileWriter : Cannot write to " << filename_ << std::endl;
+    std::terminate();
+  }
+  worker_ = std::thread(&AsyncFileWriter::run, this);
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+  close();
+}
+
+void AsyncFileWriter::write(std::string chunk) {
+  if (chunk.empty())
+    return;
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (closing_) {
+    std::cerr << "ERROR in io_routines::AsyncFileWriter::write : " << filename_ << " is already closed" << std::endl;
+    std::terminate();
+  }
+  //bounded queue: the producer waits for the disk instead of piling up the whole file in memory
+  queue_changed_.wait(lock, [this] {return queue_.size() < max_queued_chunks_;});
+  queue_.push_back(std::move(chunk));
+  queue_changed_.notify_all();
+}
+
+void AsyncFileWriter::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closing_ = true;
+  }
+  queue_changed_.notify_all();
+  if (worker_.joinable())
+    worker_.join();
+  if (output_.is_open())
+    output_.close();
+}
+
+void AsyncFileWriter::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    queue_changed_.wait(lock, [this] {return closing_ || !queue_.empty();});
+    if (queue_.empty())
+      return; // closing and nothing left to write
+    std::string chunk(std::move(queue_.front()));
+    queue_.pop_front();
+    queue_changed_.notify_all();
+    lock.unlock();
+    output_ << chunk;
+    lock.lock();
+  }
+}
+
+} /* namespace io_routines */
@@ -0,0 +1,83 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// async_file_writer.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef IO_ROUTINES_ASYNC_FILE_WRITER_H_
+#define IO_ROUTINES_ASYNC_FILE_WRITER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace io_routines {
+
+class AsyncFileWriter {
+ public:
+  AsyncFileWriter() = delete;
+  /**
+   * @brief Opens filename and starts the background thread writing the queued chunks in order
+   *
+   * @param[in] max_queued_chunks Number of chunks which may wait for the disk before write() blocks
+   */
+  AsyncFileWriter(const std::string& filename, std::size_t max_queued_chunks = 4);
+  ~AsyncFileWriter();
+  AsyncFileWriter(const AsyncFileWriter&) = delete;
+  AsyncFileWriter(AsyncFileWriter&&) = delete;
+  AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+  AsyncFileWriter& operator=(AsyncFileWriter&&) = delete;
+
+  void write(std::string chunk);
+  /**
+   * @brief Writes all queued chunks, closes the file and joins the background thread
+   */
+  void close();
+
+  const std::string& filename() const {return filename_;}
+
+ private:
+  void run();
+
+  std::string filename_;
+  std::ofstream output_;
+  std::size_t max_queued_chunks_;
+  std::deque<std::string> queue_;
+  std::mutex mutex_;
+  std::condition_variable queue_changed_;
+  bool closing_;
+  std::thread worker_;
+};
+
+} /* namespace io_routines */
+
+#endif /* IO_ROUTINES_ASYNC_FILE_WRITER_H_ */
@@ -31,9 +31,11 @@
 
 #include "io_routines/csv_input.h"
 
+#include <cstdint>
+#include <cstring>
 #include <exception>
-#include <fstream>
 #include <iostream>
+#include <utility>
 
 namespace io_routines {
 
@@ -42,49 +44,52 @@ CsvInput::CsvInput()
                      line_count_(0),
                      current_line_(0),
                      current_field_(0),
-                     lines_() {}
+                     files_(),
+                     fields_(),
+                     line_begin_(1, 0) {}
 
 CsvInput::CsvInput(const std::string& filename)
                    : filename_(filename),
                      line_count_(0),
                      current_line_(0),
                      current_field_(0),
-                     lines_() {
+                     files_(),
+                     fields_(),
+                     line_begin_(1, 0) {
   std::cout << "io_routines::CsvInput::CsvInput reading file " << filename_ << std::endl;
-  std::ifstream filestream(filename_);
-  if(!filestream.is_open()) {
+  std::shared_ptr<const MappedFile> file(new MappedFile(filename_));
+  if(!file->is_open()) {
     std::cerr << "ERROR in io_routines::CsvInput::CsvInput : Cannot read " << filename_ << std::endl;
     std::terminate();
   } else {
-    std::string line;
-    while (std::getline(filestream, line)) {
+    files_.push_back(file);
+    const char* line = file->begin();
+    while (line < file->end()) {
+      auto line_end = static_cast<const char*>(std::memchr(line, '\n', file->end() - line));
+      if (!line_end)
+        line_end = file->end();
       //allow segmentation into sub-files:
-      if (line.substr(0,9) == "/include(") {
-        std::size_t fn_length = line.find_first_of(")") -9;
-        std::string input_file = line.substr(9, fn_length);
+      std::string input_file;
+      if (IncludeDirective(line, line_end, input_file)) {
         std::cout << "\tFound /include() external file:" << std::endl;
         std::cout << "\topen external file= " << input_file << std::endl;
-        std::ifstream ext_fstream(input_file);
-        if(!ext_fstream.is_open()) {
+        std::shared_ptr<const MappedFile> ext_file(new MappedFile(input_file));
+        if(!ext_file->is_open()) {
             std::cerr << "ERROR in io_routines::CsvInput::CsvInput : Cannot read " << filename_ << std::endl;
             std::cerr << "\tCursor position: line=" << line_count_ << std::endl;//<< " field=" << current_field()
             std::cerr << "\tERROR in external sub file: "<< input_file << std::endl;
             std::terminate();
         } else {
-          std::string ext_line;
-          int ext_line_count = 0;
-          while (std::getline(ext_fstream, ext_line)) {
-            lines_.push_back(CsvInputLine(ext_line));
-            ++line_count_;
-            ++ext_line_count;
-          }
-          std::cout << "\t\t found "<< ext_line_count << " lines in " << input_file << std::endl;
+          files_.push_back(ext_file);
+          auto ext_line_start = line_count_;
+          Tokenise(*ext_file);
+          std::cout << "\t\t found "<< line_count_ - ext_line_start << " lines in " << input_file << std::endl;
         }
       // usual read-in of line
-      } else { //do not push '/include' statement to lines_
-        lines_.push_back(CsvInputLine(line));
-        ++line_count_;
+      } else { //do not push '/include' statement to the lines
+        AddLine(line, line_end);
       }
+      line = line_end + 1;
     }
   }
   if (line_count_ > 0) {
@@ -95,16 +100,78 @@ CsvInput::CsvInput(const std::string& filename)
   }
 }
 
+std::uint64_t CsvInput::Fingerprint(const std::string& filename) {
+  MappedFile file(filename);
+  if (!file.is_open())
+    return 0;
+  auto hash = file.fingerprint();
+  const char* line = file.begin();
+  while (line < file.end()) {
+    auto line_end = static_cast<const char*>(std::memchr(line, '\n', file.end() - line));
+    if (!line_end)
+      line_end = file.end();
+    std::string input_file;
+    if (IncludeDirective(line, line_end, input_file))
+      hash = (hash ^ MappedFile(input_file).fingerprint()) * 1099511628211ULL;
+    line = line_end + 1;
+  }
+  return hash;
+}
+
+bool CsvInput::IncludeDirective(const char* line, const char* line_end, std::string& input_file) {
+  if (line_end - line < 9 || std::strncmp(line, "/include(", 9) != 0)
+    return false;
+  auto fn_end = static_cast<const char*>(std::memchr(line + 9, ')', line_end - line - 9));
+  input_file.assign(line + 9, fn_end ? fn_end : line_end);
+  return true;
+}
+
+void CsvInput::Tokenise(const MappedFile& file) {
+  const char* line = file.begin();
+  while (line < file.end()) {
+    auto line_end = static_cast<const char*>(std::memchr(line, '\n', file.end() - line));
+    if (!line_end)
+      line_end = file.end();
+    AddLine(line, line_end);
+    line = line_end + 1;
+  }
+}
+
+void CsvInput::AddLine(const char* begin, const char* end) {
+  //fields are separated by ';', duplicates from editing in e.g. libre office are skipped
+  //a trailing separator does not open an empty field
+  const char* field = begin;
+  while (field < end) {
+    auto field_end = static_cast<const char*>(std::memchr(field, ';', end - field));
+    if (!field_end)
+      field_end = end;
+    fields_.push_back(Field{field, static_cast<std::size_t>(field_end - field)});
+    field = field_end;
+    while (field < end && *field == ';')
+      ++field;
+  }
+  line_begin_.push_back(fields_.size());
+  ++line_count_;
+}
+
+const CsvInput::Field* CsvInput::current() const {
+  if (current_line_ < line_count_ && current_field_ < field_count(current_line_))
+    return &fields_[line_begin_[current_line_] + current_field_];
+  return nullptr;
+}
+
 void CsvInput::Print() const {
   std::cout << "Printing input file: " << filename_ << std::endl;
-  for (CsvInputLine line : lines_) {
-    line.Print();
+  for (index_type line = 0; line < line_count_; ++line) {
+    for (auto field = line_begin_[line]; field < line_begin_[line + 1]; ++field)
+      std::cout << std::string(fields_[field].begin, fields_[field].length) << ";";
+    std::cout << std::endl;
     }
   std::cout << "------------------------------------END OF FILE---------------" << std::endl;
 }
 
 bool CsvInput::next_field() {
-  if (current_field_ + 1 < lines_[current_line_].get_field_count()) {
+  if (current_field_ + 1 < field_count(current_line_)) {
     ++current_field_;
     return true;
   } else {
@@ -122,6 +189,20 @@ bool CsvInput::next_line() {
   }
 }
 
+std::string CsvInput::get_field() const {
+  auto field = current();
+  return field ? std::string(field->begin, field->length) : std::string();
+}
+
+CsvInputLine CsvInput::get_line() const {
+  std::vector<std::string> fields;
+  if (current_line_ < line_count_) {
+    for (auto field = line_begin_[current_line_]; field < line_begin_[current_line_ + 1]; ++field)
+      fields.emplace_back(fields_[field].begin, fields_[field].length);
+  }
+  return CsvInputLine(std::move(fields));
+}
+
 std::vector<std::string> CsvInput::GetFieldsUpToEOL() {
   std::vector<std::string> return_vector;
   do {
@@ -130,4 +211,83 @@ std::vector<std::string> CsvInput::GetFieldsUpToEOL() {
   return return_vector;
 }
 
+std::vector<double> CsvInput::GetValuesUpToEOL() {
+  std::vector<double> return_vector;
+  if (current_line_ < line_count_)
+    return_vector.reserve(field_count(current_line_) - current_field_);
+  do {
+    auto field = current();
+    return_vector.push_back(field ? ParseDouble(*field) : std::stod(std::string()));
+  } while (next_field());
+  return return_vector;
+}
+
+double CsvInput::ParseDouble(const Field& field) {
+  // Plain decimals with up to 19 significant digits, a mantissa below 2^53 and a power of ten
+  // that is exact as double are converted with a single correctly rounded multiplication or
+  // division (Clinger's fast path). Everything else is left to std::stod, so results and errors
+  // are identical to std::stod in either case.
+  static const double kPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const char* pos = field.begin;
+  const char* end = field.begin + field.length;
+  bool negative = false;
+  if (pos < end && (*pos == '-' || *pos == '+')) {
+    negative = (*pos == '-');
+    ++pos;
+  }
+  std::uint64_t mantissa = 0;
+  int significant_digits = 0;
+  int exponent = 0;
+  bool has_digits = false;
+  for (; pos < end && *pos >= '0' && *pos <= '9'; ++pos) {
+    has_digits = true;
+    if (mantissa != 0 || *pos != '0') {
+      mantissa = mantissa * 10 + (*pos - '0');
+      ++significant_digits;
+    }
+    if (significant_digits > 19)
+      return std::stod(std::string(field.begin, field.length));
+  }
+  if (pos < end && *pos == '.') {
+    for (++pos; pos < end && *pos >= '0' && *pos <= '9'; ++pos) {
+      has_digits = true;
+      if (mantissa != 0 || *pos != '0') {
+        mantissa = mantissa * 10 + (*pos - '0');
+        ++significant_digits;
+      }
+      --exponent;
+      if (significant_digits > 19)
+        return std::stod(std::string(field.begin, field.length));
+    }
+  }
+  if (has_digits && pos < end && (*pos == 'e' || *pos == 'E')) {
+    ++pos;
+    bool negative_exponent = false;
+    if (pos < end && (*pos == '-' || *pos == '+')) {
+      negative_exponent = (*pos == '-');
+      ++pos;
+    }
+    int exponent_value = 0;
+    bool has_exponent_digits = false;
+    for (; pos < end && *pos >= '0' && *pos <= '9'; ++pos) {
+      has_exponent_digits = true;
+      if (exponent_value < 10000)
+        exponent_value = exponent_value * 10 + (*pos - '0');
+    }
+    if (!has_exponent_digits)
+      return std::stod(std::string(field.begin, field.length));
+    exponent += negative_exponent ? -exponent_value : exponent_value;
+  }
+  if (!has_digits || pos != end || mantissa > (std::uint64_t(1) << 53) || exponent < -22 || exponent > 22)
+    return std::stod(std::string(field.begin, field.length));
+  double value = static_cast<double>(mantissa);
+  if (exponent < 0)
+    value /= kPowersOfTen[-exponent];
+  else
+    value *= kPowersOfTen[exponent];
+  return negative ? -value : value;
+}
+
 } /* namespace io_routines */
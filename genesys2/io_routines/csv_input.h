@@ -32,10 +32,14 @@
 #ifndef IO_ROUTINES_CSV_INPUT_H_
 #define IO_ROUTINES_CSV_INPUT_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <io_routines/csv_input_line.h>
+#include <io_routines/mapped_file.h>
 
 namespace io_routines {
 
@@ -51,6 +55,9 @@ public:
   /**
    * @brief Constructor
    *
+   * The file (and its /include() sub-files) is memory mapped and split into fields in place, copies of
+   * the CsvInput share the mapped files.
+   *
    * @param[in] filename Name of the CsvInput-file to read
    */
   CsvInput(const std::string& filename);
@@ -72,19 +79,46 @@ public:
 
   bool next_field();
   bool next_line();
-  std::string get_field() const {return (lines_[current_line_].get_field(current_field_));}
-  CsvInputLine get_line() const {return lines_[current_line_];}
+  std::string get_field() const;
+  CsvInputLine get_line() const;
   std::vector<std::string> GetFieldsUpToEOL();
+  /**
+   * @brief Parses the current and all following fields of the line as numbers
+   *
+   * @return Values of the fields, identical to std::stod of each field
+   */
+  std::vector<double> GetValuesUpToEOL();
   std::string filename() const {return filename_;}
+  /**
+   * @brief Hash over the content of a CsvInput-file and its /include() sub-files, without tokenising it
+   *
+   * @param[in] filename Name of the CsvInput-file
+   * @return 0 if the file cannot be read
+   */
+  static std::uint64_t Fingerprint(const std::string& filename);
   std::string current_line() const {return std::to_string(current_line_);}
   std::string current_field() const {return std::to_string(current_field_);}
 
 private:
+  struct Field {
+    const char* begin;
+    std::size_t length;
+  };
+
+  static bool IncludeDirective(const char* line, const char* line_end, std::string& input_file);
+  void Tokenise(const MappedFile& file);
+  void AddLine(const char* begin, const char* end);
+  index_type field_count(index_type line) const {return line_begin_[line + 1] - line_begin_[line];}
+  const Field* current() const;
+  static double ParseDouble(const Field& field);
+
   std::string filename_;
   index_type line_count_;
   index_type current_line_;
   index_type current_field_;
-  std::vector<CsvInputLine> lines_;
+  std::vector<std::shared_ptr<const MappedFile> > files_; ///< keeps the memory of fields_ alive
+  std::vector<Field> fields_;
+  std::vector<std::vector<Field>::size_type> line_begin_; ///< first field of each line, plus end of the last line
 };
 
 } /* namespace io_routines */
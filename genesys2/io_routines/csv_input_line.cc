@@ -35,6 +35,7 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <utility>
 
 namespace io_routines {
 
@@ -55,6 +56,10 @@ CsvInputLine::CsvInputLine(std::string& line_string)
   }
 }
 
+CsvInputLine::CsvInputLine(std::vector<std::string>&& fields)
+                 : field_count_(static_cast<index_type>(fields.size())),
+                   fields_(std::move(fields)) {}
+
 void CsvInputLine::Print() const {
   for (const auto& field : fields_) {
     std::cout << field << ";";
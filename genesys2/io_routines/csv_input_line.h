@@ -52,6 +52,12 @@ public:
    * @param[in] line_string String containing the data of a hole line
    */
   CsvInputLine(std::string& line_string);
+  /**
+   * @brief Constructor from fields, which are already divided
+   *
+   * @param[in] fields Data of the fields of a line
+   */
+  CsvInputLine(std::vector<std::string>&& fields);
   ~CsvInputLine() = default;
 
   /**
@@ -51,14 +51,12 @@ void CsvOutput::writeToDisk(const std::string& filename) const {
   } else if (lines_.empty()) {
     // do nothing
   } else {
-    auto lines = lines_;
-    auto last_line = lines.back();
-    lines.pop_back();
-    for (const auto& i : lines) {
-      i.write(filestream);
-      filestream << std::endl;
+    // written in place, copying lines_ would hold the whole file in memory twice
+    for (auto it = lines_.begin(); it != lines_.end(); ++it) {
+      if (it != lines_.begin())
+        filestream << '\n';
+      it->write(filestream);
     }
-    last_line.write(filestream);
   }
   // filestream.flush; // should be implicitly called, if not (incomplete output-file.csv), uncomment
 }
@@ -0,0 +1,89 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// mapped_file.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <io_routines/mapped_file.h>
+
+#include <fstream>
+#include <iterator>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace io_routines {
+
+MappedFile::MappedFile(const std::string& filename)
+    : data_(nullptr),
+      size_(0),
+      open_(false),
+      mapped_(false),
+      buffer_() {
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return;
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+    void* address = ::mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (address != MAP_FAILED) {
+      ::madvise(address, static_cast<std::size_t>(file_stat.st_size), MADV_SEQUENTIAL);
+      data_ = static_cast<const char*>(address);
+      size_ = static_cast<std::size_t>(file_stat.st_size);
+      mapped_ = true;
+    }
+  }
+  ::close(fd);
+  if (!mapped_) { // empty files, pipes etc.
+    std::ifstream filestream(filename, std::ifstream::binary);
+    if (!filestream.is_open())
+      return;
+    buffer_.assign(std::istreambuf_iterator<char>(filestream), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+  }
+  open_ = true;
+}
+
+MappedFile::~MappedFile() {
+  if (mapped_)
+    ::munmap(const_cast<char*>(data_), size_);
+}
+
+std::uint64_t MappedFile::fingerprint() const {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const char* c = begin(); c != end(); ++c) {
+    hash ^= static_cast<unsigned char>(*c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+} /* namespace io_routines */
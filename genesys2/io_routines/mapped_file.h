@@ -0,0 +1,72 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// mapped_file.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef IO_ROUTINES_MAPPED_FILE_H_
+#define IO_ROUTINES_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace io_routines {
+
+/**
+ * @brief Read-only view of a whole file, memory mapped if possible and read into a buffer otherwise
+ */
+class MappedFile {
+ public:
+  MappedFile() = delete;
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool is_open() const {return open_;}
+  const char* begin() const {return data_;}
+  const char* end() const {return data_ + size_;}
+  std::size_t size() const {return size_;}
+  /**
+   * @brief 64 bit FNV-1a hash of the file content
+   */
+  std::uint64_t fingerprint() const;
+
+ private:
+  const char* data_;
+  std::size_t size_;
+  bool open_;
+  bool mapped_;
+  std::vector<char> buffer_;
+};
+
+} /* namespace io_routines */
+
+#endif /* IO_ROUTINES_MAPPED_FILE_H_ */
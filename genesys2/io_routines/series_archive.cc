@@ -0,0 +1,124 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// series_archive.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <io_routines/series_archive.h>
+
+#include <cstring>
+#include <utility>
+
+namespace io_routines {
+
+namespace {
+const char kMagicHeader[8] = {'G', 'S', 'Y', 'S', '_', 'S', 'E', 'R'};
+const char kMagicTrailer[8] = {'G', 'S', 'Y', 'S', '_', 'E', 'N', 'D'};
+const std::uint32_t kVersion = 1;
+const std::uint32_t kEndianMark = 0x01020304;
+}
+
+SeriesArchive::SeriesArchive(const std::string& filename, bool compress)
+    : file_(filename),
+      compress_(compress),
+      closed_(false),
+      offset_(0),
+      index_() {
+  std::string header(kMagicHeader, sizeof(kMagicHeader));
+  append(header, kVersion);
+  append(header, kEndianMark);
+  write(std::move(header));
+}
+
+SeriesArchive::~SeriesArchive() {
+  close();
+}
+
+std::size_t SeriesArchive::add(const std::string& key,
+                               const std::string& start,
+                               const std::string& interval,
+                               const double* values,
+                               std::size_t count) {
+  IndexEntry entry{key, start, interval, Encoding::raw, offset_, count, 0};
+  std::string column;
+  if (compress_) {
+    //run-length encoding pays off for the many piecewise constant series (capacities, unused converters)
+    for (std::size_t i = 0; i < count;) {
+      std::size_t j = i + 1;
+      while (j < count && std::memcmp(&values[j], &values[i], sizeof(double)) == 0)
+        ++j;
+      append(column, values[i]);
+      append(column, static_cast<std::uint64_t>(j - i));
+      i = j;
+      if (column.size() >= count * sizeof(double))
+        break; // no gain, stored raw
+    }
+    if (column.size() < count * sizeof(double))
+      entry.encoding = Encoding::run_length;
+  }
+  if (entry.encoding == Encoding::raw)
+    column.assign(reinterpret_cast<const char*>(values), count * sizeof(double));
+  entry.bytes = column.size();
+  write(std::move(column));
+  index_.push_back(std::move(entry));
+  return index_.size() - 1;
+}
+
+void SeriesArchive::close() {
+  if (closed_)
+    return;
+  std::string index;
+  for (const auto& entry : index_) {
+    append(index, entry.key);
+    append(index, entry.start);
+    append(index, entry.interval);
+    append(index, static_cast<std::uint32_t>(entry.encoding));
+    append(index, entry.offset);
+    append(index, entry.count);
+    append(index, entry.bytes);
+  }
+  const std::uint64_t index_offset = offset_;
+  append(index, index_offset);
+  append(index, static_cast<std::uint64_t>(index_.size()));
+  index.append(kMagicTrailer, sizeof(kMagicTrailer));
+  write(std::move(index));
+  file_.close();
+  closed_ = true;
+}
+
+void SeriesArchive::append(std::string& buffer, const std::string& value) {
+  append(buffer, static_cast<std::uint32_t>(value.size()));
+  buffer.append(value);
+}
+
+void SeriesArchive::write(std::string chunk) {
+  offset_ += chunk.size();
+  file_.write(std::move(chunk));
+}
+
+} /* namespace io_routines */
@@ -0,0 +1,109 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// series_archive.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef IO_ROUTINES_SERIES_ARCHIVE_H_
+#define IO_ROUTINES_SERIES_ARCHIVE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <io_routines/async_file_writer.h>
+
+namespace io_routines {
+
+/**
+ * @brief Columnar binary file for the dynamic (hourly) time series of the analysis output
+ *
+ * Layout, all integers and doubles in the byte order of the writing machine (see endian mark):
+ *   header   : char[8] "GSYS_SER", uint32 version, uint32 endian mark 0x01020304
+ *   columns  : one block per series, starting at a multiple of 8 bytes
+ *              raw         -> count * double
+ *              run_length  -> runs * (double value, uint64 run length)
+ *   index    : per series uint32 length + key, uint32 length + start, uint32 length + interval,
+ *              uint32 encoding, uint64 offset, uint64 count, uint64 bytes
+ *   trailer  : uint64 offset of index, uint64 number of series, char[8] "GSYS_END"
+ *
+ * Raw columns can be memory mapped and read in place, the index is found through the fixed size trailer.
+ */
+class SeriesArchive {
+ public:
+  enum Encoding : std::uint32_t {raw = 0, run_length = 1};
+
+  SeriesArchive() = delete;
+  SeriesArchive(const std::string& filename, bool compress = false);
+  ~SeriesArchive();
+  SeriesArchive(const SeriesArchive&) = delete;
+  SeriesArchive& operator=(const SeriesArchive&) = delete;
+
+  /**
+   * @brief Appends one series as a column, run-length encoded if the archive is compressed and this saves space
+   *
+   * @return Position of the series in the index
+   */
+  std::size_t add(const std::string& key,
+                  const std::string& start,
+                  const std::string& interval,
+                  const double* values,
+                  std::size_t count);
+  void close(); ///< writes index and trailer
+
+  const std::string& filename() const {return file_.filename();}
+
+ private:
+  struct IndexEntry {
+    std::string key;
+    std::string start;
+    std::string interval;
+    Encoding encoding;
+    std::uint64_t offset;
+    std::uint64_t count;
+    std::uint64_t bytes;
+  };
+
+  template <typename T>
+  static void append(std::string& buffer, const T& value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  static void append(std::string& buffer, const std::string& value);
+  void write(std::string chunk);
+
+  AsyncFileWriter file_;
+  bool compress_;
+  bool closed_;
+  std::uint64_t offset_;
+  std::vector<IndexEntry> index_;
+};
+
+} /* namespace io_routines */
+
+#endif /* IO_ROUTINES_SERIES_ARCHIVE_H_ */
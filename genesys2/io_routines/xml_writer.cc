@@ -34,23 +34,33 @@
 
 namespace io_routines {
 
-XmlWriter::XmlWriter(const std::string& filename, const char& indent_identifier) :
+XmlWriter::XmlWriter(const std::string& filename, const char& indent_identifier, std::size_t buffer_limit) :
     filename_(filename+".xml"),
+    buffer_limit_(buffer_limit),
+    file_writer_(new AsyncFileWriter(filename_)),
     indent_identifier_(indent_identifier),
-    fileIsOpen_(false),
+    fileIsOpen_(true),
     current_indent_(0),
     openTagCount_(0),
     openElementCount_(0),
     SubElementCount(0),
     curElementOpen_(false),
     openTags_{},
-    openElements_{}
+    openElements_{},
+    openElementCodes_{},
+    series_archive_()
     {
       std::cout << "XML-Writer opening - Writing Prolog with version:"<<XmlWriter::versionMajor<<"."<<XmlWriter::versionMinor<<"\n";
       stream_mem_ << "<?xml version='"<<XmlWriter::versionMajor<<"."<<XmlWriter::versionMinor<<"' encoding='UTF-8' ?>\n";
 }
 
 XmlWriter::~XmlWriter() {
+  if (fileIsOpen_) { // keep what has been written so far, e.g. if the analysis is aborted
+    writeToDisk();
+    file_writer_->close();
+    if (series_archive_)
+      series_archive_->close();
+  }
 }
 
 void XmlWriter::close() {
@@ -60,7 +70,12 @@ void XmlWriter::close() {
     std::cout << openTags_.back() << " still open!" << std::endl;
     std::terminate();
   }
+  std::cout << "\tFUNC-ID: XmlWriter::close() finishing file " << filename_ << std::endl;
   writeToDisk();
+  file_writer_->close();
+  if (series_archive_)
+    series_archive_->close();
+  fileIsOpen_ = false;
   // Dialogue Routine (cbu)
   //  bool checker = false;
   //  do {
@@ -85,12 +100,19 @@ void XmlWriter::addComment(const std::string& comment) {
   stream_mem_ << "\n";
   stream_mem_ << "<!--" << comment << "-->\n";
   stream_mem_ << "\n";
+  flushIfFull();
 }
 
 void XmlWriter::writeToDisk() {
-  std::cout << "\tFUNC-ID: XmlWriter::writeToDisk() into file " << filename_ << std::endl;
-  std::ofstream output(filename_);
-  output << stream_mem_.str(); //convert to filestream
+  //std::cout << "\tFUNC-ID: XmlWriter::writeToDisk() into file " << filename_ << std::endl;
+  file_writer_->write(stream_mem_.str());
+  stream_mem_.str(std::string());
+  stream_mem_.clear();
+}
+
+void XmlWriter::flushIfFull() {
+  if (static_cast<std::size_t>(stream_mem_.tellp()) >= buffer_limit_)
+    writeToDisk();
 }
 
 void XmlWriter::printToConsole(){
@@ -111,6 +133,7 @@ void XmlWriter::addTag(const std::string& tag) {
   openTags_.push_back(tag);
   ++current_indent_ ;
   openTagCount_=openTags_.size();
+  flushIfFull();
 }
 
 
@@ -124,7 +147,13 @@ void XmlWriter::addData(const std::string& data) {
     stream_mem_ << ">";
     curElementOpen_ = false;
   }
-  stream_mem_ << data;
+  if (data.size() >= buffer_limit_) { // e.g. hourly series, bypass the buffer
+    writeToDisk();
+    file_writer_->write(data);
+  } else {
+    stream_mem_ << data;
+    flushIfFull();
+  }
 }
 
 void XmlWriter::addAttr(const std::string& name, const std::string& value) {
@@ -135,6 +164,8 @@ void XmlWriter::addAttr(const std::string& name, const std::string& value) {
   }
   if (curElementOpen_) {
     stream_mem_  << " " << name << "=\"" << value << "\"";
+    if (name == "code")
+      openElementCodes_.back() = value;
   } else {
     std::cerr << "ERROR: cannot write XmlWriter::addAttr to closed Element!" << std::endl;
     std::terminate();
@@ -156,6 +187,7 @@ void XmlWriter::addElement(const std::string elementTag) {
     stream_mem_ << indent_identifier_;
   }
   openElements_.push_back(elementTag);
+  openElementCodes_.push_back(std::string());
   openElementCount_++;
   stream_mem_ << "<" << elementTag;
   curElementOpen_ = true;
@@ -176,7 +208,9 @@ void XmlWriter::closeElement() {
       }
       stream_mem_ << "</" << openElements_.back() << ">\n";
       openElements_.pop_back();
+      openElementCodes_.pop_back();
       openElementCount_ = openElements_.size();
+      flushIfFull();
     } else {
       std::cout << "***WARNING current Element still open!" << std::endl;
     }
@@ -200,6 +234,7 @@ void XmlWriter::addSubElement(const std::string subElement) {
     }
   }
   openElements_.push_back(subElement);
+  openElementCodes_.push_back(std::string());
   openElementCount_++;
   stream_mem_ << "<" << subElement;
   curElementOpen_ = true;
@@ -213,8 +248,10 @@ void XmlWriter::closeSubElement() {
   //Write close-Statement in same line
   stream_mem_  << "</" << openElements_.back() << ">\n";
   openElements_.pop_back();
+  openElementCodes_.pop_back();
   openElementCount_ = openElements_.size();
   SubElementCount--;
+  flushIfFull();
 }
 
 void XmlWriter::closeTag() {
@@ -228,6 +265,7 @@ void XmlWriter::closeTag() {
     stream_mem_ << "</" << openTags_.back() << ">\n";
     openTags_.pop_back();
     openTagCount_ = openTags_.size();
+    flushIfFull();
 }
 
 void XmlWriter::addTBD(const aux::TimeSeriesConstAddable& dataObj) {
@@ -237,4 +275,38 @@ void XmlWriter::addTBD(const aux::TimeSeriesConstAddable& dataObj) {
   addData(std::get<2>(data_str));
 }
 
+void XmlWriter::addSeries(const aux::TimeSeries& dataObj) {
+  if (!series_archive_) {
+    auto data_str = dataObj.toXml();
+    addAttr("start", std::get<0>(data_str));
+    addAttr("interval", std::get<1>(data_str));
+    addData(std::get<2>(data_str));
+    return;
+  }
+  auto data_bin = dataObj.toBinary();
+  auto index = series_archive_->add(seriesKey(), std::get<0>(data_bin), std::get<1>(data_bin),
+                                    std::get<2>(data_bin), std::get<3>(data_bin));
+  addAttr("start", std::get<0>(data_bin));
+  addAttr("interval", std::get<1>(data_bin));
+  addAttr("archive", series_archive_->filename());
+  addAttr("index", std::to_string(index));
+  addData("");
+}
+
+void XmlWriter::openSeriesArchive(const std::string& filename, bool compress) {
+  std::cout << "XML-Writer writing dynamic series to " << filename << (compress ? " (compressed)" : "") << std::endl;
+  series_archive_.reset(new SeriesArchive(filename, compress));
+}
+
+std::string XmlWriter::seriesKey() const {
+  //e.g. region[DE]/converter[PV1]/data[used_capacity]
+  std::string key;
+  for (std::vector<std::string>::size_type i = 0; i < openElements_.size(); ++i) {
+    if (!key.empty())
+      key += "/";
+    key += openElements_[i] + "[" + openElementCodes_[i] + "]";
+  }
+  return key;
+}
+
 } /* namespace io_routines */
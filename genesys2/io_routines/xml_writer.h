@@ -32,13 +32,17 @@
 #ifndef IO_ROUTINES_XML_WRITER_H_
 #define IO_ROUTINES_XML_WRITER_H_
 
+#include <cstddef>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
 #include <vector>
 #include <auxiliaries/time_series_const_addable.h>
+#include <io_routines/async_file_writer.h>
+#include <io_routines/series_archive.h>
 
 
 namespace io_routines {
@@ -46,7 +50,17 @@ namespace io_routines {
 class XmlWriter {
  public:
   XmlWriter() = delete;
-  XmlWriter(const std::string& filename, const char& indent_identifier = '\t');
+  /**
+   * @brief Streams the document to filename.xml, buffering at most buffer_limit bytes in memory
+   *
+   * Full buffers are handed to a background thread, so the output of large dynamic models does not
+   * have to fit into memory.
+   */
+  XmlWriter(const std::string& filename,
+            const char& indent_identifier = '\t',
+            std::size_t buffer_limit = 4 << 20);
+  XmlWriter(const XmlWriter&) = delete;
+  XmlWriter& operator=(const XmlWriter&) = delete;
 
   virtual ~XmlWriter();
   void close();
@@ -61,17 +75,26 @@ class XmlWriter {
   void addAttr(const std::string& name, const std::string& value);
   void addData(const std::string& data);//needs to be templated
   void addTBD(const aux::TimeSeriesConstAddable& dataObj);
+  /**
+   * @brief Writes a dynamic series: into the series archive if one is opened, referenced by its index, else like addTBD
+   */
+  void addSeries(const aux::TimeSeries& dataObj);
+  void openSeriesArchive(const std::string& filename, bool compress = false);
 
   void addComment(const std::string& comment);
 
-  void printToConsole();
+  void printToConsole(); ///< prints the buffered part, which is not yet handed to the file
   // XML version constants
   enum {versionMajor = 1, versionMinor = 0};
 
  private:
   void writeToDisk();
+  void flushIfFull();
+  std::string seriesKey() const;
   std::ostringstream stream_mem_;
   std::string filename_;
+  std::size_t buffer_limit_;
+  std::unique_ptr<AsyncFileWriter> file_writer_;
   char indent_identifier_;
   bool fileIsOpen_;
   int current_indent_;
@@ -81,6 +104,8 @@ class XmlWriter {
   bool curElementOpen_;
   std::vector<std::string> openTags_;
   std::vector<std::string> openElements_;
+  std::vector<std::string> openElementCodes_; ///< code attribute of each open element, used as key in the series archive
+  std::unique_ptr<SeriesArchive> series_archive_;
 };
 
 } /* namespace io_routines */
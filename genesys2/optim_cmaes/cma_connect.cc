@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <fstream>
 #include <limits>
+#include <set>
 #include <sstream>
 #include <typeinfo>
 #include <unordered_map>
@@ -41,10 +42,13 @@
 #include <time.h>
 #include <sys/time.h>
 
+#include <omp.h>
+
 #include <cmd_parameters.h>
 #include <auxiliaries/functions.h>
-#include <dynamic_model_hsm/hsm_operation.h>
+#include <builder/model_builder.h>
 #include <io_routines/csv_output_line.h>
+#include <optim_cmaes/mpi_evaluator.h>
 
 namespace optim_cmaes {
 
@@ -53,7 +57,8 @@ CMA_connect::CMA_connect(const std::string& filename,
     : file_(filename),
       installation_list_(file_),
       model_(model),
-      problem_dimensionality_(installation_list_.optim_variables().size()) {
+      problem_dimensionality_(installation_list_.optim_variables().size()),
+      mpi_evaluator_(nullptr) {
 	my_fitness_function_ = std::bind(&optim_cmaes::CMA_connect::MyFitnessFunction, this,
 	                                 std::placeholders::_1,std::placeholders::_2);
   my_progress_function_ = std::bind(&optim_cmaes::CMA_connect::MyProgressFunction, this,
@@ -66,6 +71,9 @@ void CMA_connect::RunOptimiser() {
 
   //std::cout << "CMA_connect::RunOptimiser()" << std::endl;
   SplitVariableVectors();
+  //with MPI the models live on the worker ranks only
+  InitOperationPool(mpi_evaluator_ ? 0 : static_cast<std::vector<InstallationList>::size_type>(omp_get_max_threads()));
+  InitFitnessCache();
   libcmaes::GenoPheno<libcmaes::pwqBoundStrategy, libcmaes::linScalingStrategy> gp(&lbounds_.front(),
                                                                                    &ubounds_.front(),
                                                                                    problem_dimensionality_);
@@ -79,7 +87,7 @@ void CMA_connect::RunOptimiser() {
             genesys::ProgramSettings::cma_lambda(), seed, gp);
   cmaparams.set_algo(sepaCMAES);
   ///=======================MULTI-THREADING ON/OFF=================================
-  if (genesys::CmdParameters::availableThreads() > 1) {
+  if ((genesys::CmdParameters::availableThreads() > 1) || mpi_evaluator_) {
     cmaparams.set_mt_feval(true); //enables multi-threading
   } else {
     cmaparams.set_mt_feval(false); //disables multi-threading
@@ -101,6 +109,7 @@ void CMA_connect::RunOptimiser() {
   libcmaes::Candidate best_candidate(cma_solution.get_best_seen_candidate().get_fvalue(),
                                      cma_solution.get_best_seen_candidate().get_x_pheno_dvec(cmaparams));
   writeCandidate(best_candidate.get_x());
+  SaveFitnessCache();
   //DEBUG
   //  Eigen::VectorXd bestparameters = gp.pheno(cma_solution.get_best_seen_candidate().get_x_dvec());
   //  libcmaes::Candidate test_cand(cma_solution.get_best_seen_candidate().get_fvalue(), bestparameters);
@@ -110,6 +119,29 @@ void CMA_connect::RunOptimiser() {
   std::cout << "Optimisation CPU time was: " << aux::pretty_time_string(1000*(cpu_time1-cpu_time0))<< std::endl;
 }
 
+#ifdef GENESYS_USE_MPI
+void CMA_connect::RunOptimiser(MpiEvaluator& evaluator) {
+  if (evaluator.workers() == 0) {
+    RunOptimiser();
+    return;
+  }
+  if (!evaluator.root()) {
+    //a worker evaluates one candidate at a time, the threads of the rank are used inside the HSM
+    InitOperationPool(1);
+    evaluator.Serve([this](const std::vector<double>& x) {return EvaluateCandidate(x);});
+    return;
+  }
+  //rank 0 only dispatches, one optimiser thread per worker rank keeps all workers busy
+  auto max_threads = omp_get_max_threads();
+  omp_set_num_threads(evaluator.workers());
+  mpi_evaluator_ = &evaluator;
+  RunOptimiser();
+  mpi_evaluator_ = nullptr;
+  evaluator.Stop();
+  omp_set_num_threads(max_threads);
+}
+#endif
+
 double CMA_connect::MyFitnessFunction(const double *x, const int N) {
   //std::cout << "FUNC-ID: CMA_connect::MyFitnessFunction()" << std::endl;
   if (static_cast<int>(problem_dimensionality_) != N) {
@@ -118,48 +150,68 @@ double CMA_connect::MyFitnessFunction(const double *x, const int N) {
     std::vector<double> current_x;
     for (std::vector<double>::size_type i = 0; static_cast<int>(i) < N; ++i)
       current_x.push_back(x[i]);
-    InstallationList tmp_inst_list(installation_list_);
-    tmp_inst_list.WriteValues(current_x);
-    sm::StaticModel my_model(model_, tmp_inst_list.installations());
-    if (genesys::ProgramSettings::get_operation_algorithm().compare("old_hierarchy_hsm") == 0) {
-      std::cout<<"DEBUG CBU: new default setting ist hsm_total_cost_min"<<std::endl;
-      std::cerr<<"use new operation_algorithm !" << std::endl;
-      std::cout << "FUNC-ID: MyFitnessFunction\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<<std::endl;
-      std::terminate();
-      //std::cout << "HSM-Operation Algorithm active!" << std::endl;
-      dm_hsm::HSMOperation hsm_operation(my_model);
-      //CalculateFitness returns map with all results of toplevel (fitness, lcoe capex, opex etc)
-      //analyse
-      //bool analyse = false;
-      //return hsm_operation.CalculateFitness(analyse).find("fitness")->second;
-    } else if (genesys::ProgramSettings::get_operation_algorithm().compare("hsm_total_cost_min") == 0) {
-      //std::cout << "HSM-by_total_cost_minimisation" << std::endl;
-      dm_hsm::HSMOperation hsm_operation(my_model);
-      //CalculateFitnessMinCost returns map with all results of toplevel (fitness, lcoe capex, opex etc)
-      //analyse
-      bool analyse = false;
-      return hsm_operation.CalculateFitnessMinCost(analyse).find("fitness")->second;
-    } else if (genesys::ProgramSettings::get_operation_algorithm().compare("hsm_lcoe_min") == 0) {
-      dm_hsm::HSMOperation hsm_operation(my_model);
-      bool analyse = false;
-      return hsm_operation.CalculateFitnessMinLCOE(analyse).find("fitness")->second; // returns map with all results of toplevel (fitness, lcoe capex, opex etc)
-    } else if (genesys::ProgramSettings::get_operation_algorithm().compare("something_else") == 0) {
-          std::cout << "HSM-new_algo Algorithm active!" << std::endl;
-    } else {
-      std::cout << "FUNC-ID: MyFitnessFunction\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<<std::endl;
-      std::cerr << "CMA_connect::MyFitnessFunction() : could not identify method to calculate fitness" << std::endl;
-      std::terminate();
-    }
+    FitnessCache::Result cached_result;
+    if (fitness_cache_ && fitness_cache_->Find(current_x, cached_result))
+      return cached_result.find("fitness")->second;
+#ifdef GENESYS_USE_MPI
+    if (mpi_evaluator_)
+      return CacheResult(current_x, mpi_evaluator_->Evaluate(current_x));
+#endif
+    return CacheResult(current_x, EvaluateCandidate(current_x));
   }
   return 0.0; // dummy return
 }
 
+FitnessCache::Result CMA_connect::EvaluateCandidate(const std::vector<double>& x) {
+  auto thread_num = static_cast<std::vector<InstallationList>::size_type>(omp_get_thread_num());
+  if (thread_num >= thread_operations_.size()) {
+    std::cerr << "ERROR in CMA_connect::EvaluateCandidate() : no model available for thread " << thread_num << std::endl;
+    std::terminate();
+  }
+  InstallationList& tmp_inst_list = thread_installation_lists_[thread_num];
+  tmp_inst_list.WriteValues(x);
+  dm_hsm::HSMOperation& hsm_operation = *thread_operations_[thread_num];
+  hsm_operation.resetParametrisedOperation(tmp_inst_list.installations());
+  if (genesys::ProgramSettings::get_operation_algorithm().compare("old_hierarchy_hsm") == 0) {
+    std::cout<<"DEBUG CBU: new default setting ist hsm_total_cost_min"<<std::endl;
+    std::cerr<<"use new operation_algorithm !" << std::endl;
+    std::cout << "FUNC-ID: MyFitnessFunction\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<<std::endl;
+    std::terminate();
+    //std::cout << "HSM-Operation Algorithm active!" << std::endl;
+    //CalculateFitness returns map with all results of toplevel (fitness, lcoe capex, opex etc)
+    //analyse
+    //bool analyse = false;
+    //return hsm_operation.CalculateFitness(analyse).find("fitness")->second;
+  } else if (genesys::ProgramSettings::get_operation_algorithm().compare("hsm_total_cost_min") == 0) {
+    //std::cout << "HSM-by_total_cost_minimisation" << std::endl;
+    //CalculateFitnessMinCost returns map with all results of toplevel (fitness, lcoe capex, opex etc)
+    //analyse
+    bool analyse = false;
+    return hsm_operation.CalculateFitnessMinCost(analyse);
+  } else if (genesys::ProgramSettings::get_operation_algorithm().compare("hsm_lcoe_min") == 0) {
+    bool analyse = false;
+    return hsm_operation.CalculateFitnessMinLCOE(analyse); // returns map with all results of toplevel (fitness, lcoe capex, opex etc)
+  } else if (genesys::ProgramSettings::get_operation_algorithm().compare("something_else") == 0) {
+        std::cout << "HSM-new_algo Algorithm active!" << std::endl;
+  } else {
+    std::cout << "FUNC-ID: MyFitnessFunction\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<<std::endl;
+    std::cerr << "CMA_connect::MyFitnessFunction() : could not identify method to calculate fitness" << std::endl;
+    std::terminate();
+  }
+  return {{"fitness", 0.0}}; // dummy return
+}
+
 int CMA_connect::MyProgressFunction(const libcmaes::CMAParameters<libcmaes::GenoPheno<libcmaes::pwqBoundStrategy,
                                                                   libcmaes::linScalingStrategy> >& cmaparams,
                                     const libcmaes::CMASolutions& cmasols) {
   std::cout << "generation " << cmasols.niter() << " done, took " << cmasols.elapsed_last_iter()
             << "ms, best fitness=" << cmasols.best_candidate().get_fvalue() << ", sigma=" << cmasols.sigma() << std::endl;
   std::cout << "\tbest fitness sofar= " << cmasols.get_best_seen_candidate().get_fvalue() << std::endl;
+  if (fitness_cache_) {
+    std::cout << "\tfitness cache: " << fitness_cache_->hits() << " hits of " << fitness_cache_->lookups()
+              << " evaluations (" << 100. * fitness_cache_->hit_rate() << "%), "
+              << fitness_cache_->size() << " results stored" << std::endl;
+  }
 
   //write result every nth iteration but not after the first=0
   if (!cmasols.niter() == 0){
@@ -168,6 +220,7 @@ int CMA_connect::MyProgressFunction(const libcmaes::CMAParameters<libcmaes::Geno
 	  	  libcmaes::Candidate best_candidate(cmasols.get_best_seen_candidate().get_fvalue(),
 	  			                                 cmasols.get_best_seen_candidate().get_x_pheno_dvec(cmaparams));
 	  	    writeCandidate(best_candidate.get_x(), cmasols.niter());
+	  	    SaveFitnessCache();
 	 }
   }
   return 0;
@@ -182,6 +235,50 @@ void CMA_connect::SplitVariableVectors() {
   }
 }// END CMA_connect::SplitVariableVector()
 
+void CMA_connect::InitOperationPool(std::vector<InstallationList>::size_type num_models) {
+  //std::cout << "FUNC-ID: CMA_connect::InitOperationPool()" << std::endl;
+  //build the dynamic models once per thread - each fitness evaluation only resets and reparametrises its model
+  thread_installation_lists_.clear();
+  thread_operations_.clear();
+  for (std::vector<InstallationList>::size_type i = 0; i < num_models; ++i) {
+    thread_installation_lists_.push_back(installation_list_);
+    sm::StaticModel init_model(model_, thread_installation_lists_.back().installations());
+    thread_operations_.emplace_back(new dm_hsm::HSMOperation(init_model));
+  }
+}
+
+void CMA_connect::InitFitnessCache() {
+  //std::cout << "FUNC-ID: CMA_connect::InitFitnessCache()" << std::endl;
+  fitness_cache_.reset();
+  if (!genesys::ProgramSettings::cma_fitness_cache())
+    return;
+  // results are only reusable for the same scenario files, installation list and evaluation settings
+  std::uint64_t model_fingerprint = genesys::ProgramSettings::evaluation_fingerprint();
+  std::set<std::string> input_files(builder::ModelBuilder::input_files());
+  input_files.insert(file_.filename());
+  for (const auto& filename : input_files) {
+    model_fingerprint = (model_fingerprint ^ std::hash<std::string>()(filename)) * 1099511628211ULL;
+    model_fingerprint = (model_fingerprint ^ io_routines::CsvInput::Fingerprint(filename)) * 1099511628211ULL;
+  }
+  fitness_cache_.reset(new FitnessCache(lbounds_, ubounds_,
+                                        genesys::ProgramSettings::cma_fitness_cache_resolution(),
+                                        genesys::ProgramSettings::get_operation_algorithm(),
+                                        model_fingerprint));
+  if (!genesys::ProgramSettings::cma_fitness_cache_file().empty())
+    fitness_cache_->Load(genesys::ProgramSettings::cma_fitness_cache_file());
+}
+
+void CMA_connect::SaveFitnessCache() const {
+  if (fitness_cache_ && !genesys::ProgramSettings::cma_fitness_cache_file().empty())
+    fitness_cache_->Save(genesys::ProgramSettings::cma_fitness_cache_file());
+}
+
+double CMA_connect::CacheResult(const std::vector<double>& x, const FitnessCache::Result& result) {
+  if (fitness_cache_)
+    fitness_cache_->Insert(x, result);
+  return result.find("fitness")->second;
+}
+
 void CMA_connect::writeCandidate(std::vector<double> x_opt, int niter) {
 	//reset input file cursor and empty previous output lines
 	file_.reset_cursor_start();
@@ -41,13 +41,17 @@
 
 #include <program_settings.h>
 #include <abstract_model/abstract_model.h>
+#include <dynamic_model_hsm/hsm_operation.h>
 #include <io_routines/csv_input.h>
 #include <io_routines/csv_output.h>
+#include <optim_cmaes/fitness_cache.h>
 #include <optim_cmaes/installation_list.h>
 #include <optim_cmaes/variable.h>
 
 namespace optim_cmaes {
 
+class MpiEvaluator;
+
 class CMA_connect {
 public:
 	CMA_connect(const std::string& filename,
@@ -59,6 +63,14 @@ public:
   CMA_connect& operator =(CMA_connect&&) = delete;
 
 	void RunOptimiser();
+#ifdef GENESYS_USE_MPI
+  /**
+   * @brief Runs the optimiser on rank 0 and evaluates its candidates on the model replicas of all other ranks
+   *
+   * Worker ranks return once rank 0 finished the optimisation. Without worker ranks RunOptimiser() is used.
+   */
+  void RunOptimiser(MpiEvaluator& evaluator);
+#endif
 
   const InstallationList& installation_list() const {return installation_list_;}
 
@@ -69,6 +81,11 @@ private:
                                                        libcmaes::linScalingStrategy> >& cmaparams,
                          const libcmaes::CMASolutions& cmasols);
   void SplitVariableVectors();
+  FitnessCache::Result EvaluateCandidate(const std::vector<double>& x);
+  void InitOperationPool(std::vector<InstallationList>::size_type num_models);
+  void InitFitnessCache();
+  void SaveFitnessCache() const;
+  double CacheResult(const std::vector<double>& x, const FitnessCache::Result& result);
 
   void writeCandidate(std::vector<double> x_opt, int niter = 0); // intentionally copying the argument
   //void writeParameters(const double fitness, const std::string add_filename, const Eigen::VectorXd x_Vec);
@@ -86,6 +103,13 @@ private:
   std::vector<double> ubounds_;
   std::vector<double> init_x0_;
   io_routines::CsvOutput output_file_;
+  //one model per worker thread, reset and reparametrised for each fitness evaluation
+  std::vector<InstallationList> thread_installation_lists_;
+  std::vector<std::unique_ptr<dm_hsm::HSMOperation> > thread_operations_;
+  //results of evaluated candidates, nullptr if the cache is switched off
+  std::unique_ptr<FitnessCache> fitness_cache_;
+  //evaluates the candidates on other MPI ranks instead of the thread models, nullptr for local evaluation
+  MpiEvaluator* mpi_evaluator_;
 
   //std::vector<io_routines::CsvOutputLine> result_lines;
 };
@@ -0,0 +1,188 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// fitness_cache.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <optim_cmaes/fitness_cache.h>
+
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+namespace optim_cmaes {
+
+FitnessCache::FitnessCache(const std::vector<double>& lbounds,
+                           const std::vector<double>& ubounds,
+                           double resolution,
+                           const std::string& algorithm,
+                           std::uint64_t model_fingerprint)
+    : lbounds_(lbounds),
+      steps_(),
+      resolution_(resolution),
+      algorithm_(algorithm),
+      model_fingerprint_(model_fingerprint),
+      entries_(),
+      lookups_(0),
+      hits_(0) {
+  if (lbounds.size() != ubounds.size())
+    IssueError("FitnessCache", "number of lower and upper bounds differs");
+  if (!(resolution > 0.))
+    IssueError("FitnessCache", "resolution has to be positive, got " + std::to_string(resolution));
+  for (std::vector<double>::size_type i = 0; i < lbounds.size(); ++i) {
+    double range = ubounds[i] - lbounds[i];
+    steps_.push_back((range > 0. ? range : 1.) * resolution);
+  }
+}
+
+bool FitnessCache::Find(const std::vector<double>& x, Result& result) {
+  Key key(Quantise(x));
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++lookups_;
+  auto it = entries_.find(key);
+  if (it == entries_.end())
+    return false;
+  ++hits_;
+  result = it->second;
+  return true;
+}
+
+void FitnessCache::Insert(const std::vector<double>& x, const Result& result) {
+  Key key(Quantise(x));
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.emplace(std::move(key), result);
+}
+
+void FitnessCache::Load(const std::string& filename) {
+  std::ifstream filestream(filename.c_str(), std::ifstream::in);
+  if (!filestream.is_open()) {
+    std::cout << "INFO: no fitness cache found in " << filename << ", starting empty" << std::endl;
+    return;
+  }
+  std::string line;
+  if (!std::getline(filestream, line) || line != Fingerprint()) {
+    std::cout << "INFO: fitness cache " << filename
+              << " was written for different bounds, operation algorithm, input files or settings, ignoring it" << std::endl;
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  while (std::getline(filestream, line)) {
+    std::istringstream linestream(line);
+    Key key(lbounds_.size());
+    for (auto& k : key)
+      linestream >> k;
+    std::size_t num_values = 0;
+    linestream >> num_values;
+    Result result;
+    std::string name;
+    double value;
+    for (std::size_t i = 0; i < num_values && (linestream >> name >> value); ++i)
+      result.emplace(name, value);
+    if (linestream.fail() || result.size() != num_values)
+      IssueError("Load", "corrupt entry in file " + filename + ": " + line);
+    entries_.emplace(std::move(key), std::move(result));
+  }
+  std::cout << "INFO: loaded " << entries_.size() << " fitness evaluations from " << filename << std::endl;
+}
+
+void FitnessCache::Save(const std::string& filename) const {
+  std::ofstream filestream(filename.c_str(), std::ofstream::out | std::ofstream::trunc);
+  if (!filestream.is_open())
+    IssueError("Save", "cannot write to file " + filename);
+  filestream.precision(std::numeric_limits<double>::max_digits10);
+  filestream << Fingerprint() << "\n";
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& it : entries_) {
+    for (const auto k : it.first)
+      filestream << k << " ";
+    filestream << it.second.size();
+    for (const auto& value : it.second)
+      filestream << " " << value.first << " " << std::scientific << value.second;
+    filestream << "\n";
+  }
+}
+
+std::size_t FitnessCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::size_t FitnessCache::lookups() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lookups_;
+}
+
+std::size_t FitnessCache::hits() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+double FitnessCache::hit_rate() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return (lookups_ > 0) ? static_cast<double>(hits_) / static_cast<double>(lookups_) : 0.;
+}
+
+std::size_t FitnessCache::KeyHash::operator()(const Key& key) const {
+  std::size_t seed = key.size();
+  for (const auto k : key)
+    seed ^= std::hash<std::int64_t>()(k) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  return seed;
+}
+
+FitnessCache::Key FitnessCache::Quantise(const std::vector<double>& x) const {
+  if (x.size() != lbounds_.size())
+    IssueError("Quantise", "expected " + std::to_string(lbounds_.size()) + " variables, got "
+               + std::to_string(x.size()));
+  Key key;
+  key.reserve(x.size());
+  for (std::vector<double>::size_type i = 0; i < x.size(); ++i)
+    key.push_back(static_cast<std::int64_t>(std::llround((x[i] - lbounds_[i]) / steps_[i])));
+  return key;
+}
+
+std::string FitnessCache::Fingerprint() const {
+  std::ostringstream fingerprint;
+  fingerprint.precision(std::numeric_limits<double>::max_digits10);
+  fingerprint << "#genesys_fitness_cache " << algorithm_ << " " << std::hex << model_fingerprint_ << std::dec
+              << " " << resolution_ << " " << lbounds_.size();
+  for (std::vector<double>::size_type i = 0; i < lbounds_.size(); ++i)
+    fingerprint << " " << lbounds_[i] << " " << steps_[i];
+  return fingerprint.str();
+}
+
+void FitnessCache::IssueError(std::string calling_function_name,
+                              std::string error_message) const {
+  std::cerr << "ERROR in optim_cmaes::FitnessCache::" << calling_function_name << " :" << std::endl
+      << error_message << std::endl;
+  std::terminate();
+}
+
+} /* namespace optim_cmaes */
@@ -0,0 +1,106 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// fitness_cache.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef OPTIM_CMAES_FITNESS_CACHE_H_
+#define OPTIM_CMAES_FITNESS_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace optim_cmaes {
+
+/**
+ * @brief Memoises the result map of a fitness evaluation, keyed on the quantised phenotype vector
+ *
+ * Each variable is quantised on a grid of resolution * (ubound - lbound), so candidates clamped onto the
+ * same bound or re-sampled by a restarted optimiser share one key. Lookups are thread safe.
+ * The model fingerprint identifies the scenario inputs and evaluation settings the results belong to.
+ */
+class FitnessCache {
+ public:
+  typedef std::unordered_map<std::string, double> Result;
+
+  FitnessCache() = delete;
+  ~FitnessCache() = default;
+  FitnessCache(const FitnessCache&) = delete;
+  FitnessCache& operator=(const FitnessCache&) = delete;
+  FitnessCache(const std::vector<double>& lbounds,
+               const std::vector<double>& ubounds,
+               double resolution,
+               const std::string& algorithm,
+               std::uint64_t model_fingerprint);
+
+  bool Find(const std::vector<double>& x, Result& result);
+  void Insert(const std::vector<double>& x, const Result& result);
+
+  /** \name Persistence across runs, the file is only valid for unchanged bounds, operation algorithm and model fingerprint.*/
+  ///@{
+  void Load(const std::string& filename);
+  void Save(const std::string& filename) const;
+  ///@}
+
+  /** \name Statistics.*/
+  ///@{
+  std::size_t size() const;
+  std::size_t lookups() const;
+  std::size_t hits() const;
+  double hit_rate() const;
+  ///@}
+
+ private:
+  typedef std::vector<std::int64_t> Key;
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  Key Quantise(const std::vector<double>& x) const;
+  std::string Fingerprint() const;
+  void IssueError(std::string calling_function_name,
+                  std::string error_message) const;
+
+  std::vector<double> lbounds_;
+  std::vector<double> steps_;
+  double resolution_;
+  std::string algorithm_;
+  std::uint64_t model_fingerprint_;
+  std::unordered_map<Key, Result, KeyHash> entries_;
+  std::size_t lookups_;
+  std::size_t hits_;
+  mutable std::mutex mutex_;
+};
+
+} /* namespace optim_cmaes */
+
+#endif /* OPTIM_CMAES_FITNESS_CACHE_H_ */
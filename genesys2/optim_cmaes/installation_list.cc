@@ -135,14 +135,29 @@ InstallationList::InstallationList(const io_routines::CsvInput& input_file)
   } while (file_.next_line());
   for (auto&& i : variables_)
     i.WriteValue(i.init_point());
+  BuildInstallationSlots();
   //DEBUG Print();
 }
 
+InstallationList::InstallationList(const InstallationList& other)
+    : file_(other.file_),
+      variables_(other.variables_),
+      optim_variables_(other.optim_variables_),
+      installations_(other.installations_) {
+  //the slots point into installations_, therefore they are rebuilt instead of copied
+  BuildInstallationSlots();
+}
+
 void InstallationList::WriteValues(const std::vector<double>& values, bool finished_optim) {
   if (values.size() == optim_variables_.size()) {
     auto value_it = values.cbegin();
     for (auto&& i : optim_variables_)
       i.WriteValue(*value_it++);
+    for (auto& i : variable_slots_) {
+      auto installation_return = i.first->get(InstallationValues(*i.first));
+      std::get<0>(*i.second) = std::move(installation_return.first);
+      std::get<1>(*i.second) = installation_return.second;
+    }
   } else {
     IssueError("WriteValues", "size mismatch for values and optim_variables");
   }
@@ -191,37 +206,34 @@ void InstallationList::writeOptimiserResultStats() {
   stat_xml.close();
 }
 
-std::unordered_map<std::string,
-                   std::unordered_map<std::string,
-                                      std::tuple<std::unique_ptr<aux::TimeBasedData>,
-                                                 aux::SimulationClock::time_point,
-                                                 aux::SimulationClock::time_point,
-                                                 aux::SimulationClock::duration> > >
-InstallationList::installations() const {
-  std::unordered_map<std::string,
-                     std::unordered_map<std::string,
-                                        std::tuple<std::unique_ptr<aux::TimeBasedData>,
-                                                   aux::SimulationClock::time_point,
-                                                   aux::SimulationClock::time_point,
-                                                   aux::SimulationClock::duration> > > return_map;
+void InstallationList::BuildInstallationSlots() {
+  //every installation gets its slot once, only the slots depending on optim variables are rewritten later on
+  installation_slots_.clear();
+  variable_slots_.clear();
   for (const auto& i : installations_) {
-    std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
-                                               aux::SimulationClock::time_point,
-                                               aux::SimulationClock::time_point,
-                                               aux::SimulationClock::duration> > sub_map;
+    auto& sub_map = installation_slots_[i.first];
     for (const auto& j : i.second) {
-      std::vector<double> tmp_var_vec;
-      for (const auto& k : j.second.var_index())
-        tmp_var_vec.push_back(k.first == 0 ? variables_[k.second].value() : optim_variables_[k.second].value());
-      auto installation_return = j.second.get(tmp_var_vec);
-      sub_map.emplace(j.first,
-                      std::move(std::tuple_cat(std::move(installation_return),
-                                               std::make_pair(genesys::ProgramSettings::simulation_end(),
-                                                              genesys::ProgramSettings::installation_interval()))));
+      auto installation_return = j.second.get(InstallationValues(j.second));
+      auto slot_pos = sub_map.emplace(j.first,
+                                      std::tuple_cat(std::move(installation_return),
+                                                     std::make_pair(genesys::ProgramSettings::simulation_end(),
+                                                                    genesys::ProgramSettings::installation_interval()))).first;
+      for (const auto& k : j.second.var_index()) {
+        if (k.first == 1) {
+          variable_slots_.emplace_back(&j.second, &slot_pos->second);
+          break;
+        }
+      }
     }
-    return_map.emplace(i.first, std::move(sub_map));
   }
-  return return_map;
+}
+
+std::vector<double> InstallationList::InstallationValues(const Installation& installation) const {
+  std::vector<double> values;
+  values.reserve(installation.var_index().size());
+  for (const auto& k : installation.var_index())
+    values.push_back(k.first == 0 ? variables_[k.second].value() : optim_variables_[k.second].value());
+  return values;
 }
 
 std::string InstallationList::GetKeyValue(std::string key) {
@@ -322,11 +334,7 @@ void InstallationList::Print() {
     std::cout << i.first << "----------------"<< std::endl;
     for (auto& j : i.second) { //Tech Code
       std::cout <<"\t|---" << j.first << std::endl;
-      std::vector<double> tmp_var_vec; //Variables*OptimVariables  Temporary Data Structure
-      for (const auto& k : j.second.var_index()) {
-        tmp_var_vec.push_back(k.first == 0 ? variables_[k.second].value() : optim_variables_[k.second].value());
-      }
-      auto installation_return = j.second.get(tmp_var_vec); //TBD Content
+      auto installation_return = j.second.get(InstallationValues(j.second)); //TBD Content
       std::cout << "\tTBD:" << installation_return.first->PrintToString() << "\n";
     }
   }
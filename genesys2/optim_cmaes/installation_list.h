@@ -49,17 +49,28 @@ class InstallationList {
   InstallationList() = delete;
   ~InstallationList() = default;
   InstallationList(const io_routines::CsvInput& input_file);
+  InstallationList(const InstallationList& other);
+  InstallationList& operator=(const InstallationList&) = delete;
 
   void WriteValues(const std::vector<double>& values, bool finished_optim = false);
   const std::vector<Variable>& optim_variables() const {return optim_variables_;}
-  std::unordered_map<std::string,
-                     std::unordered_map<std::string,
-                                        std::tuple<std::unique_ptr<aux::TimeBasedData>,
-                                                   aux::SimulationClock::time_point,
-                                                   aux::SimulationClock::time_point,
-                                                   aux::SimulationClock::duration> > > installations() const;
+  /**
+   * @brief Installations for the current variable values.
+   *
+   * The map is built once; WriteValues only rewrites the slots of installations depending on optimisation variables.
+   */
+  const std::unordered_map<std::string,
+                           std::unordered_map<std::string,
+                                              std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                         aux::SimulationClock::time_point,
+                                                         aux::SimulationClock::time_point,
+                                                         aux::SimulationClock::duration> > >& installations() const {
+    return installation_slots_;
+  }
   void Print();
  private:
+  void BuildInstallationSlots();
+  std::vector<double> InstallationValues(const Installation& installation) const;
   std::string GetKeyValue(std::string key);
   //void ParseAndInsertOptimVar();
   void ParseAndInsertOptimVar( std::string mounting_code, std::string tech_code, aux::SimulationClock::time_point tp);
@@ -77,6 +88,18 @@ class InstallationList {
   std::vector<Variable> variables_; //0 index
   std::vector<Variable> optim_variables_; //1 index
   std::unordered_map<std::string, std::unordered_map<std::string, Installation> > installations_;
+  std::unordered_map<std::string,
+                     std::unordered_map<std::string,
+                                        std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                                   aux::SimulationClock::time_point,
+                                                   aux::SimulationClock::time_point,
+                                                   aux::SimulationClock::duration> > > installation_slots_;
+  //installations with at least one optim variable and their slot in installation_slots_
+  std::vector<std::pair<const Installation*,
+                        std::tuple<std::unique_ptr<aux::TimeBasedData>,
+                                   aux::SimulationClock::time_point,
+                                   aux::SimulationClock::time_point,
+                                   aux::SimulationClock::duration>*> > variable_slots_;
 };
 
 } /* namespace optim_cmaes */
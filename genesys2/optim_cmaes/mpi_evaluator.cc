@@ -0,0 +1,188 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// mpi_evaluator.cc
+//
+// This file is part of the genesys-framework v.2
+
+#include <optim_cmaes/mpi_evaluator.h>
+
+#ifdef GENESYS_USE_MPI
+
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <thread>
+
+#include <mpi.h>
+
+namespace optim_cmaes {
+
+namespace {
+const int kTagCandidate = 1;
+const int kTagResult = 2;
+const int kTagStop = 3;
+}
+
+MpiEvaluator::MpiEvaluator()
+    : rank_(0),
+      size_(1),
+      stopped_(false) {
+  //the threads of the optimiser on rank 0 dispatch concurrently, their MPI calls are guarded by mpi_mutex_
+  int provided(MPI_THREAD_SINGLE);
+  MPI_Init_thread(nullptr, nullptr, MPI_THREAD_SERIALIZED, &provided);
+  if (provided < MPI_THREAD_SERIALIZED)
+    IssueError("MpiEvaluator", "MPI library does not provide MPI_THREAD_SERIALIZED");
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+  MPI_Comm_size(MPI_COMM_WORLD, &size_);
+  for (int i = size_ - 1; i > 0; --i)
+    idle_workers_.push_back(i);
+}
+
+MpiEvaluator::~MpiEvaluator() {
+  if (root())
+    Stop();
+  MPI_Finalize();
+}
+
+FitnessCache::Result MpiEvaluator::Evaluate(const std::vector<double>& x) {
+  if (!root() || (workers() == 0))
+    IssueError("Evaluate", "candidates can only be evaluated by rank 0 with at least one worker rank");
+  auto worker = AcquireWorker();
+  {
+    std::lock_guard<std::mutex> lock(mpi_mutex_);
+    MPI_Send(const_cast<double*>(x.data()), static_cast<int>(x.size()), MPI_DOUBLE, worker, kTagCandidate,
+             MPI_COMM_WORLD);
+  }
+  //poll instead of a blocking receive, which would hold mpi_mutex_ for the whole evaluation
+  std::vector<char> buffer;
+  bool received(false);
+  while (!received) {
+    {
+      std::lock_guard<std::mutex> lock(mpi_mutex_);
+      int flag(0);
+      MPI_Status status;
+      MPI_Iprobe(worker, kTagResult, MPI_COMM_WORLD, &flag, &status);
+      if (flag) {
+        int count(0);
+        MPI_Get_count(&status, MPI_CHAR, &count);
+        buffer.resize(count);
+        MPI_Recv(buffer.data(), count, MPI_CHAR, worker, kTagResult, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        received = true;
+      }
+    }
+    if (!received)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ReleaseWorker(worker);
+  return Deserialise(buffer);
+}
+
+void MpiEvaluator::Stop() {
+  std::lock_guard<std::mutex> lock(mpi_mutex_);
+  if (stopped_)
+    return;
+  for (int i = 1; i < size_; ++i)
+    MPI_Send(nullptr, 0, MPI_DOUBLE, i, kTagStop, MPI_COMM_WORLD);
+  stopped_ = true;
+}
+
+void MpiEvaluator::Serve(const std::function<FitnessCache::Result(const std::vector<double>&)>& evaluate) {
+  if (root())
+    IssueError("Serve", "rank 0 runs the optimiser and cannot serve evaluations");
+  std::vector<double> x;
+  while (true) {
+    MPI_Status status;
+    MPI_Probe(0, MPI_ANY_TAG, MPI_COMM_WORLD, &status);
+    if (status.MPI_TAG == kTagStop) {
+      MPI_Recv(nullptr, 0, MPI_DOUBLE, 0, kTagStop, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      break;
+    }
+    int count(0);
+    MPI_Get_count(&status, MPI_DOUBLE, &count);
+    x.resize(count);
+    MPI_Recv(x.data(), count, MPI_DOUBLE, 0, kTagCandidate, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    auto buffer = Serialise(evaluate(x));
+    MPI_Send(buffer.data(), static_cast<int>(buffer.size()), MPI_CHAR, 0, kTagResult, MPI_COMM_WORLD);
+  }
+}
+
+int MpiEvaluator::AcquireWorker() {
+  std::unique_lock<std::mutex> lock(worker_mutex_);
+  worker_available_.wait(lock, [this]() {return !idle_workers_.empty();});
+  auto worker = idle_workers_.back();
+  idle_workers_.pop_back();
+  return worker;
+}
+
+void MpiEvaluator::ReleaseWorker(int worker) {
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    idle_workers_.push_back(worker);
+  }
+  worker_available_.notify_one();
+}
+
+std::vector<char> MpiEvaluator::Serialise(const FitnessCache::Result& result) {
+  //each entry is stored as its zero terminated key followed by the bytes of the value
+  std::vector<char> buffer;
+  for (const auto& it : result) {
+    buffer.insert(buffer.end(), it.first.begin(), it.first.end());
+    buffer.push_back('\0');
+    auto value_pos = buffer.size();
+    buffer.resize(value_pos + sizeof(double));
+    std::memcpy(&buffer[value_pos], &it.second, sizeof(double));
+  }
+  return buffer;
+}
+
+FitnessCache::Result MpiEvaluator::Deserialise(const std::vector<char>& buffer) {
+  FitnessCache::Result result;
+  std::vector<char>::size_type pos(0);
+  while (pos < buffer.size()) {
+    std::string key(&buffer[pos]);
+    pos += key.size() + 1;
+    double value(0.);
+    std::memcpy(&value, &buffer[pos], sizeof(double));
+    pos += sizeof(double);
+    result.emplace(std::move(key), value);
+  }
+  return result;
+}
+
+void MpiEvaluator::IssueError(std::string calling_function_name,
+                              std::string error_message) const {
+  std::cerr << "ERROR in optim_cmaes::MpiEvaluator::" << calling_function_name << " (rank " << rank_ << ") :"
+            << std::endl << error_message << std::endl;
+  MPI_Abort(MPI_COMM_WORLD, 1);
+  std::terminate();
+}
+
+} /* namespace optim_cmaes */
+
+#endif /* GENESYS_USE_MPI */
@@ -0,0 +1,104 @@
+// ==================================================================
+//
+//  GENESYS2 is an optimisation tool and model of the European electricity supply system.
+//
+//  Copyright (C) 2015, 2016, 2017.  Robin Beer, Christian Bussar, Zhuang Cai, Kevin
+//  Jacque, Luiz Moraes Jr., Philipp Stöcker
+//
+//  This program is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public License
+//  as published by the Free Software Foundation; either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+//  02110-1301 USA.
+//
+//  Project host: RWTH Aachen University, Aachen, Germany
+//  Website: http://www.genesys.rwth-aachen.de
+//
+// ==================================================================
+//
+// mpi_evaluator.h
+//
+// This file is part of the genesys-framework v.2
+
+#ifndef OPTIM_CMAES_MPI_EVALUATOR_H_
+#define OPTIM_CMAES_MPI_EVALUATOR_H_
+
+#ifdef GENESYS_USE_MPI
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <optim_cmaes/fitness_cache.h>
+
+namespace optim_cmaes {
+
+/**
+ * @brief Distributes fitness evaluations of the optimiser over the ranks of MPI_COMM_WORLD
+ * @details Rank 0 runs the optimiser and hands each candidate to an idle worker rank, all other ranks evaluate the
+ *          candidates on their own model until they are stopped. Evaluate may be called by several threads of rank 0
+ *          at once, the MPI calls are serialised internally. Only compiled with -DGENESYS_USE_MPI.
+ */
+class MpiEvaluator {
+ public:
+  MpiEvaluator(); ///< Initialises MPI, the object has to outlive all other MPI use of the process
+  ~MpiEvaluator(); ///< Finalises MPI
+  MpiEvaluator(const MpiEvaluator&) = delete;
+  MpiEvaluator(MpiEvaluator&&) = delete;
+  MpiEvaluator& operator=(const MpiEvaluator&) = delete;
+  MpiEvaluator& operator=(MpiEvaluator&&) = delete;
+
+  bool root() const {return rank_ == 0;}
+  int rank() const {return rank_;}
+  int workers() const {return size_ - 1;}
+
+  /**
+   * @brief Evaluates the candidate on the next idle worker rank and blocks until its result arrived (rank 0 only)
+   */
+  FitnessCache::Result Evaluate(const std::vector<double>& x);
+
+  /**
+   * @brief Releases all worker ranks from Serve (rank 0 only)
+   */
+  void Stop();
+
+  /**
+   * @brief Evaluates the candidates received from rank 0 until Stop is called there (worker ranks only)
+   *
+   * @param[in] evaluate fitness evaluation of one candidate on the model of this rank
+   */
+  void Serve(const std::function<FitnessCache::Result(const std::vector<double>&)>& evaluate);
+
+ private:
+  int AcquireWorker();
+  void ReleaseWorker(int worker);
+  static std::vector<char> Serialise(const FitnessCache::Result& result);
+  static FitnessCache::Result Deserialise(const std::vector<char>& buffer);
+  void IssueError(std::string calling_function_name,
+                  std::string error_message) const;
+
+  int rank_;
+  int size_;
+  bool stopped_;
+  std::vector<int> idle_workers_;
+  std::mutex mpi_mutex_;
+  std::mutex worker_mutex_;
+  std::condition_variable worker_available_;
+};
+
+} /* namespace optim_cmaes */
+
+#endif /* GENESYS_USE_MPI */
+
+#endif /* OPTIM_CMAES_MPI_EVALUATOR_H_ */
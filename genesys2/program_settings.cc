@@ -56,20 +56,32 @@ double ProgramSettings::cma_ftarget_ = 1e4;
 int ProgramSettings::cma_writeFullResult_after_ngenerations_ = 500;
 int ProgramSettings::cma_weight_target_year_ = 3;
 int ProgramSettings::cma_weight_target_duration_years_ = 1;
+bool ProgramSettings::cma_fitness_cache_ = false;
+double ProgramSettings::cma_fitness_cache_resolution_ = 1e-9; /*relative to the range of the variable*/
+std::string ProgramSettings::cma_fitness_cache_file_ = "";
 aux::SimulationClock::duration
 ProgramSettings::installation_interval_ = aux::SimulationClock::duration_from_string("1a");
 std::string ProgramSettings::operation_algorithm_ = "old_hierarchy_hsm";
 aux::SimulationClock::duration
 ProgramSettings::operation_sequence_duration_ = aux::SimulationClock::duration_from_string("1a");
+bool ProgramSettings::parallel_sequences_ = false;
+double ProgramSettings::parallel_sequences_tolerance_ = 1e-3; /*GWh*/
 int ProgramSettings::future_lookahead_time_ = 0;
 double ProgramSettings::interest_rate_ = 0.06;
 aux::SimulationClock::duration ProgramSettings::energy2power_ratio_ = aux::SimulationClock::duration_from_string("1h");
 aux::SimulationClock::duration ProgramSettings::simulation_step_length_ = aux::SimulationClock::duration_from_string("1h");
+aux::SimulationClock::Calendar ProgramSettings::calendar_ = aux::SimulationClock::Calendar(simulation_start_, simulation_end_,
+                                                                                          simulation_step_length_);
 //aux::SimulationClock::time_point ProgramSettings::result_analysis_start_ = aux::SimulationClock::time_point_from_string("2016-01-01_00:00");
 int ProgramSettings::gridbalance_hop_level_ = 1;
+bool ProgramSettings::parallel_grid_balance_ = false;
+bool ProgramSettings::bake_lookup_tables_ = false;
 bool ProgramSettings::consider_transmission_loss_ = false;
 bool ProgramSettings::analysis_hsm_output_detail_ = false;
+bool ProgramSettings::analysis_hsm_binary_series_ = false;
+bool ProgramSettings::analysis_hsm_compress_series_ = false;
 bool ProgramSettings::use_global_file_ = false;
+std::string ProgramSettings::scenario_cache_file_ = ""; /*empty: input files are parsed on every run*/
 bool ProgramSettings::use_randomisation_ = false;
 bool ProgramSettings::deterministic_cmaes_ = false;
 double ProgramSettings::max_co2_emission_annual_ = 0; /*mio t/a*/
@@ -135,6 +147,7 @@ ProgramSettings::ProgramSettings(const std::string& filename) {
     }
     filestream.close();
   }
+  calendar_ = aux::SimulationClock::Calendar(simulation_start_, simulation_end_, simulation_step_length_);
   PrintAll();
 }
 
@@ -200,17 +213,25 @@ void ProgramSettings::PrintAll() {
 			<< "\tcma_writeFullResult_after_ngenerations_ = " << cma_writeFullResult_after_ngenerations_ << "\n"
             << "\tinstallation_interval_ = " << aux::SimulationClock::duration_to_string(installation_interval_) << "\n"
             << "\tcma_weight_target_year_ = " << cma_weight_target_year_ << "x\n"
+            << "\tcma_fitness_cache_ = " << cma_fitness_cache_ << "\n"
+            << "\tcma_fitness_cache_resolution_ = " << cma_fitness_cache_resolution_ << "\n"
+            << "\tcma_fitness_cache_file_ = " << cma_fitness_cache_file_ << "\n"
         //<< "result_analysis_start_ = " << aux::SimulationClock::time_point_to_string(result_analysis_start_) << "\n"
 		<< "use_global_file_ = " << use_global_file_ << "\n"
+        << "scenario_cache_file_ = " << scenario_cache_file_ << "\n"
 
         << "----------operation algorithm settings--------------" << "\n"
         << "operation_algorithm_ = " << operation_algorithm_ << "\n"
         << "operation_sequence_duration_ = " << aux::SimulationClock::duration_to_string(operation_sequence_duration_) << "\n"
+            << "\tparallel_sequences_ = " << parallel_sequences_ << "\n"
+            << "\tparallel_sequences_tolerance_ = " << parallel_sequences_tolerance_ << " GWh\n"
         << "future_lookahead_time_ = " << future_lookahead_time_ << "\n"
         << "interest_rate_ = " << interest_rate_ *100<< " %\n"
         << "energy2power_ratio_ = " << aux::SimulationClock::duration_to_string(energy2power_ratio_) << "\n"
         << "simulation_step_length_ = " << aux::SimulationClock::duration_to_string(simulation_step_length_) << "\n"
         << "gridbalance_hop_level_ = " << gridbalance_hop_level_ << " \n"
+            << "\tparallel_grid_balance_ = " << parallel_grid_balance_ << "\n"
+            << "\tbake_lookup_tables_ = " << bake_lookup_tables_ << "\n"
             << "\tgrid_exchange_ratio = " << grid_exchange_ratio_ << " * residual-load\n"
             << "\tconsider_transmission_loss_ = " << consider_transmission_loss_ << "\n"
             << "\tmax_co2_emission_annual_ = " << max_co2_emission_annual_ << "\n"
@@ -224,11 +245,51 @@ void ProgramSettings::PrintAll() {
         //<< "penalty_energy_cut_ = " << penalty_energy_cut_ << "\n"
         << "----------analysis_hsm settings--------------" << "\n"
         << "analysis_hsm_output_detail_ = " << analysis_hsm_output_detail_ << "\n"
+            << "\tanalysis_hsm_output_format = " << (analysis_hsm_binary_series_ ? "binary" : "xml") << "\n"
+            << "\tanalysis_hsm_output_compression = " << analysis_hsm_compress_series_ << "\n"
         << "----------PRINTING MODULES----------" << std::endl;
         aux::print_map_elements(genesys_modules_);
         std::cout << "======ProgramSettings::PrintAll()===============" << "\n"<< std::endl;
 }
 
+std::uint64_t ProgramSettings::evaluation_fingerprint() {
+  std::ostringstream settings;
+  settings.precision(17);
+  settings << aux::SimulationClock::time_point_to_string(simulation_start_) << ";"
+           << aux::SimulationClock::time_point_to_string(simulation_end_) << ";"
+           << aux::SimulationClock::duration_to_string(simulation_step_length_) << ";"
+           << aux::SimulationClock::duration_to_string(installation_interval_) << ";"
+           << interest_rate_ << ";"
+           << operation_algorithm_ << ";"
+           << aux::SimulationClock::duration_to_string(operation_sequence_duration_) << ";"
+           << future_lookahead_time_ << ";"
+           << parallel_sequences_ << ";" << parallel_sequences_tolerance_ << ";"
+           << gridbalance_hop_level_ << ";" << parallel_grid_balance_ << ";"
+           << bake_lookup_tables_ << ";"
+           << aux::SimulationClock::duration_to_string(energy2power_ratio_) << ";"
+           << approx_const_epsilon_ << ";"
+           << use_global_file_ << ";"
+           << use_randomisation_ << ";"
+           << grid_exchange_ratio_ << ";"
+           << consider_transmission_loss_ << ";"
+           << max_co2_emission_annual_ << ";"
+           << penalty_unsupplied_load_ << ";" << penalty_self_supply_quota_ << ";"
+           << penalty_SQ_lower_limit_ << ";" << penalty_SQ_upper_limit_ << ";"
+           << penalty_co2_exceed_emission_ << ";" << penalty_energy_cut_ << ";";
+  // unordered maps, so sort by key to get a stable text
+  for (const auto& it : std::map<std::string, bool>(genesys_modules_.begin(), genesys_modules_.end()))
+    settings << it.first << "=" << it.second << ";";
+  for (const auto& it : std::map<std::string, double>(penalties_.begin(), penalties_.end()))
+    settings << it.first << "=" << it.second << ";";
+
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const char c : settings.str()) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
 //Inserting the Values from DAT-File to the correct Setting-Name in STD::STRING format!
 void ProgramSettings::InsertSetting (std::string setting_name, std::string setting_value){
   //std::cout << "FUNC-ID: C'tor InsertSetting\n\tFROM\t" << __FILE__ << "\n\tLINE\t"<<(__LINE__-1)<< "\n"<<std::endl;
@@ -297,6 +358,19 @@ void ProgramSettings::InsertSetting (std::string setting_name, std::string setti
     cma_weight_target_year_ = std::stoi(setting_value);
   } else if (setting_name == "cma_weight_target_duration_years") {
 	cma_weight_target_duration_years_ = std::stoi(setting_value);
+  } else if (setting_name == "cma_fitness_cache") {
+    if (setting_value == "yes") {
+      cma_fitness_cache_ = true;
+    } else if (setting_value == "no") {
+      cma_fitness_cache_ = false;
+    } else {
+      std::cerr << "ERROR in Input file, expected value for variable cma_fitness_cache is yes/no, got " << setting_value << std::endl;
+      std::terminate();
+    }
+  } else if (setting_name == "cma_fitness_cache_resolution") {
+    cma_fitness_cache_resolution_ = std::stod(setting_value);
+  } else if (setting_name == "cma_fitness_cache_file") {
+    cma_fitness_cache_file_ = setting_value;
   } else if (setting_name == "installation_interval") {
     installation_interval_ = aux::SimulationClock::duration_from_string(setting_value);
   //end optimisation related settings ==============================================================================================
@@ -308,6 +382,17 @@ void ProgramSettings::InsertSetting (std::string setting_name, std::string setti
     operation_algorithm_ = setting_value;
   } else if (setting_name == "operation_sequence_duration") {
     operation_sequence_duration_ = aux::SimulationClock::duration_from_string(setting_value);
+  } else if (setting_name == "parallel_sequences") {
+    if (setting_value == "yes") {
+      parallel_sequences_ = true;
+    } else if (setting_value == "no") {
+      parallel_sequences_ = false;
+    } else {
+      std::cerr << "ERROR in Input file, expected value for variable parallel_sequences is yes/no, got " << setting_value << std::endl;
+      std::terminate();
+    }
+  } else if (setting_name == "parallel_sequences_tolerance") {
+    parallel_sequences_tolerance_ = std::stod(setting_value);
   } else if (setting_name == "interest_rate") {
     interest_rate_ = std::stod(setting_value);
   } else if (setting_name == "energy2power_ratio") {
@@ -318,6 +403,24 @@ void ProgramSettings::InsertSetting (std::string setting_name, std::string setti
     future_lookahead_time_ = std::stoi(setting_value);
   } else if (setting_name == "gridbalance_hop_level") {
     gridbalance_hop_level_ = std::stoi(setting_value);
+  } else if (setting_name == "parallel_grid_balance") {
+    if (setting_value == "yes") {
+      parallel_grid_balance_ = true;
+    } else if (setting_value == "no") {
+      parallel_grid_balance_ = false;
+    } else {
+      std::cerr << "ERROR in Input file, expected value for variable parallel_grid_balance is yes/no, got " << setting_value << std::endl;
+      std::terminate();
+    }
+  } else if (setting_name == "bake_lookup_tables") {
+    if (setting_value == "yes") {
+      bake_lookup_tables_ = true;
+    } else if (setting_value == "no") {
+      bake_lookup_tables_ = false;
+    } else {
+      std::cerr << "ERROR in Input file, expected value for variable bake_lookup_tables is yes/no, got " << setting_value << std::endl;
+      std::terminate();
+    }
   }  else if (setting_name == "consider_dsm") {
     if (setting_value == "yes") {
       genesys_modules_["dsm"] = true;
@@ -399,6 +502,24 @@ void ProgramSettings::InsertSetting (std::string setting_name, std::string setti
           std::cerr << "ERROR in Input file, expected value for variable 'analysis_hsm_output_detail' is yes/no, got " << setting_value << std::endl;
           std::terminate();
      }
+  } else if (setting_name == "analysis_hsm_output_format") {
+     if (setting_value == "binary") {
+       analysis_hsm_binary_series_ = true;
+     } else if (setting_value == "xml") {
+       analysis_hsm_binary_series_ = false;
+     } else {
+          std::cerr << "ERROR in Input file, expected value for variable 'analysis_hsm_output_format' is xml/binary, got " << setting_value << std::endl;
+          std::terminate();
+     }
+  } else if (setting_name == "analysis_hsm_output_compression") {
+     if (setting_value == "yes") {
+       analysis_hsm_compress_series_ = true;
+     } else if (setting_value == "no") {
+       analysis_hsm_compress_series_ = false;
+     } else {
+          std::cerr << "ERROR in Input file, expected value for variable 'analysis_hsm_output_compression' is yes/no, got " << setting_value << std::endl;
+          std::terminate();
+     }
   } else if (setting_name == "use_global_file") {
 	  if(setting_value == "yes") {
 		  use_global_file_ = true;
@@ -408,6 +529,8 @@ void ProgramSettings::InsertSetting (std::string setting_name, std::string setti
 		  std::cerr << "ERROR in Input file, expected value for variable 'use_global_file' is yes/no, got " << setting_value << std::endl;
 		  std::terminate();
 	  }
+  } else if (setting_name == "scenario_cache_file") {
+    scenario_cache_file_ = setting_value;
   //  } else if (setting_name == "max_co2_emission_annual") {
   //       max_co2_emission_annual_ = std::stod(setting_value);
   } else if (setting_name == "grid_exchange_ratio") { //percentage of RL that can be drawn via grid
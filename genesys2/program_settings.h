@@ -32,6 +32,7 @@
 #ifndef PROGRAM_SETTINGS_H_
 #define PROGRAM_SETTINGS_H_
 
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <iostream>
@@ -74,6 +75,9 @@ class ProgramSettings {
   static int get_cma_weight_target_year() {return cma_weight_target_year_;}
   static int get_cma_weight_target_duration_years() {return cma_weight_target_duration_years_;}
   static bool use_deterministic_cmaes() {return deterministic_cmaes_;}
+  static bool cma_fitness_cache() {return cma_fitness_cache_;}
+  static double cma_fitness_cache_resolution() {return cma_fitness_cache_resolution_;}
+  static std::string cma_fitness_cache_file() {return cma_fitness_cache_file_;}
   ///@}
 
   /** \name Control variables for operation strategy*/
@@ -82,20 +86,34 @@ class ProgramSettings {
   static std::string get_operation_algorithm() {return operation_algorithm_;}
   static aux::SimulationClock::duration get_operation_sequence_duration() {return operation_sequence_duration_;}
   static int operation_get_LookAheadTime() {return future_lookahead_time_;}
+  static bool parallel_sequences() {return parallel_sequences_;}
+  static double parallel_sequences_tolerance() {return parallel_sequences_tolerance_;}
   static double interest_rate() {return interest_rate_;}
   static aux::SimulationClock::duration energy2power_ratio() {return energy2power_ratio_;}
   static aux::SimulationClock::duration simulation_step_length() {return simulation_step_length_;}
+  static const aux::SimulationClock::Calendar& calendar() {return calendar_;} ///< years of the simulation window
   //static double penalty_unsupplied_load() {return penalty_unsupplied_load_;}
   //static double penalty_self_supply_quota() {return penalty_self_supply_quota_;}
   //static double SQ_lower_limit_() {return penalty_SQ_lower_limit_;}
   //static double SQ_upper_limit_() {return penalty_SQ_upper_limit_;}
   static int gridbalance_hop_level() { return gridbalance_hop_level_;}
+  static bool parallel_grid_balance() { return parallel_grid_balance_;}
+  static bool bake_lookup_tables() { return bake_lookup_tables_;}
   static bool analysis_hsm_output_detail() { return analysis_hsm_output_detail_;}
+  static bool analysis_hsm_binary_series() { return analysis_hsm_binary_series_;}
+  static bool analysis_hsm_compress_series() { return analysis_hsm_compress_series_;}
   static bool use_global_file() { return use_global_file_;}
+  static std::string scenario_cache_file() { return scenario_cache_file_;}
   static bool use_randomisation() { return use_randomisation_ ; }
   static double grid_exchange_ratio() {return grid_exchange_ratio_;} //percentage of RL that can be drawn via grid
   ///@}
 
+  /** @brief Hash of all settings that change the fitness of an installation list.
+   *
+   * Output, optimiser and caching settings are not included.
+   */
+  static std::uint64_t evaluation_fingerprint();
+
   void PrintAll();
 
  private:
@@ -118,15 +136,23 @@ class ProgramSettings {
   static aux::SimulationClock::duration installation_interval_;
   static int cma_weight_target_year_;
   static int cma_weight_target_duration_years_;
+  static bool cma_fitness_cache_;
+  static double cma_fitness_cache_resolution_;
+  static std::string cma_fitness_cache_file_;
   //settings relevant for operation simulation
   //deprecated cbu static aux::SimulationClock::time_point result_analysis_start_;
   static std::string operation_algorithm_;
   static aux::SimulationClock::duration operation_sequence_duration_;
+  static bool parallel_sequences_;
+  static double parallel_sequences_tolerance_;
   static int future_lookahead_time_;
   static double interest_rate_;
   static aux::SimulationClock::duration energy2power_ratio_;
   static aux::SimulationClock::duration simulation_step_length_;
+  static aux::SimulationClock::Calendar calendar_; // built from simulation_start_, simulation_end_ and simulation_step_length_
   static int gridbalance_hop_level_;
+  static bool parallel_grid_balance_;
+  static bool bake_lookup_tables_;
   static double approx_const_epsilon_;
 
   static std::unordered_map<std::string, bool > genesys_modules_;
@@ -139,7 +165,10 @@ class ProgramSettings {
   static bool consider_transmission_loss_;
 
   static bool analysis_hsm_output_detail_;
+  static bool analysis_hsm_binary_series_;
+  static bool analysis_hsm_compress_series_;
   static bool use_global_file_;
+  static std::string scenario_cache_file_;
   static bool use_randomisation_;
   static bool deterministic_cmaes_;
 
@@ -35,11 +35,9 @@ namespace sm {
 
 Global::Global(const Global& other)
     : am::Global(other) {
-  if (!other.storage_ptrs_.empty()) {
-    for (const auto &it : other.storage_ptrs_)
-      storage_ptrs_.emplace(it.first, std::shared_ptr<SysComponentActive>(
-          new SysComponentActive(*it.second)));
-  }
+  storage_ptrs_ = other.storage_ptrs_;
+  for (auto& it : storage_ptrs_)
+    it.second = std::shared_ptr<SysComponentActive>(new SysComponentActive(*it.second));
 }
 
 Global::Global(const am::Global& origin,
@@ -35,10 +35,9 @@ namespace sm {
 
 Link::Link(const Link& other)
     : am::Link(other) {
-  if (!other.converter_ptrs_.empty()) {
-    for (const auto &it : other.converter_ptrs_)
-      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>( new Converter(*it.second)));
-  }
+  converter_ptrs_ = other.converter_ptrs_;
+  for (auto& it : converter_ptrs_)
+    it.second = std::shared_ptr<Converter>(new Converter(*it.second));
 }
 
 Link::Link(const am::Link& origin,
@@ -31,45 +31,42 @@
 
 #include <static_model/region.h>
 
+#include <string>
+#include <unordered_set>
+
 namespace sm {
 
 Region::Region(const sm::Region& other)
     : am::Region(other) {
-  if (!other.converter_ptrs_.empty()) {
-    for (const auto &it : other.converter_ptrs_)
-      converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(
-          new Converter(*it.second)));
-  }
-  if (!other.multi_converter_ptrs_.empty()) {
-      for (const auto &it : other.multi_converter_ptrs_)
-        multi_converter_ptrs_.emplace(it.first, std::shared_ptr<MultiConverter>(
-            new MultiConverter(*it.second)));
-  }
-  if (!other.storage_ptrs_.empty()) {
-    for (const auto &it : other.storage_ptrs_)
-      storage_ptrs_.emplace(it.first, std::shared_ptr<SysComponentActive>(
-          new SysComponentActive(*it.second)));
-  }
+  converter_ptrs_ = other.converter_ptrs_;
+  for (auto& it : converter_ptrs_)
+    it.second = std::shared_ptr<Converter>(new Converter(*it.second));
+  multi_converter_ptrs_ = other.multi_converter_ptrs_;
+  for (auto& it : multi_converter_ptrs_)
+    it.second = std::shared_ptr<MultiConverter>(new MultiConverter(*it.second));
+  storage_ptrs_ = other.storage_ptrs_;
+  for (auto& it : storage_ptrs_)
+    it.second = std::shared_ptr<SysComponentActive>(new SysComponentActive(*it.second));
 }
 
 Region::Region(const am::Region& origin,
-               std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
+               const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
                                                                 aux::SimulationClock::time_point,
                                                                 aux::SimulationClock::time_point,
                                                                 aux::SimulationClock::duration> >& installations)
     : am::Region(origin) {
+  std::unordered_set<std::string> applied_installations; //each entry is applied once, as by erasing it
   //if parent class has a component installation create for each from origin with additional installations
   if (!am::Region::converter_ptrs().empty()) {
     for (const auto& it : am::Region::converter_ptrs()) {
       auto converter_pos = installations.find(it.first);
-      if (converter_pos != installations.end()) {
+      if (converter_pos != installations.end() && applied_installations.insert(it.first).second) {
         //        std::cout << " found installation for " << it.second->code() << std::endl;
         //        std::cout << "\t " << converter_pos->first << std::endl;
         converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(
             new Converter(*(it.second), std::move((*std::get<0>(converter_pos->second)).clone()),
                                    std::get<1>(converter_pos->second), std::get<2>(converter_pos->second),
                                    std::get<3>(converter_pos->second))));
-        installations.erase(it.first);
       } else {
         //in case no additional installations, create new from origin
         converter_ptrs_.emplace(it.first, std::shared_ptr<Converter>(
@@ -80,12 +77,11 @@ Region::Region(const am::Region& origin,
   if (!am::Region::multi_converter_ptrs().empty()) {
     for (const auto& it : am::Region::multi_converter_ptrs()) {
       auto multi_conv_pos = installations.find(it.first);
-      if (multi_conv_pos != installations.end()) {
+      if (multi_conv_pos != installations.end() && applied_installations.insert(it.first).second) {
         multi_converter_ptrs_.emplace(it.first, std::shared_ptr<MultiConverter>(
             new MultiConverter(*(it.second), std::move((*std::get<0>(multi_conv_pos->second)).clone()),
                                    std::get<1>(multi_conv_pos->second), std::get<2>(multi_conv_pos->second),
                                    std::get<3>(multi_conv_pos->second))));
-        installations.erase(it.first);
       } else {
         multi_converter_ptrs_.emplace(it.first, std::shared_ptr<MultiConverter>(
             new MultiConverter(*(it.second))));
@@ -96,21 +92,22 @@ Region::Region(const am::Region& origin,
     //std::cout << am::Region::storage_ptrs().size() << "size storage ptrs" << std::endl;
     for (const auto& it : am::Region::storage_ptrs()) {
       auto storage_pos = installations.find(it.first);
-      if (storage_pos != installations.end()) {
+      if (storage_pos != installations.end() && applied_installations.insert(it.first).second) {
         storage_ptrs_.emplace(it.first, std::shared_ptr<SysComponentActive>(
             new SysComponentActive(*(it.second), std::move((*std::get<0>(storage_pos->second)).clone()),
                                    std::get<1>(storage_pos->second), std::get<2>(storage_pos->second),
                                    std::get<3>(storage_pos->second))));
-        installations.erase(it.first);
       } else {
         storage_ptrs_.emplace(it.first, std::shared_ptr<SysComponentActive>(
             new SysComponentActive(*(it.second))));
       }
     }
   }
-  if (installations.size() > 0) {
+  if (applied_installations.size() != installations.size()) {
       std::cerr << "ERROR: could not apply all installations due to faulty parametrisation in " << code() << std::endl;
       for (auto& it : installations){
+        if (applied_installations.count(it.first) > 0)
+          continue;
         std::cout << "\t" << code()<< "." << it.first <<" needs to be removed" << std::endl;
       }
       std::cerr << "ERROR in sm::Region c'tor : installation list contained invalid entries" << std::endl;
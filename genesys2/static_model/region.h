@@ -54,7 +54,7 @@ class Region : public am::Region {
   Region& operator=(Region&&) = delete;
   Region(const am::Region& origin);
   Region(const am::Region& origin,
-         std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
+         const std::unordered_map<std::string, std::tuple<std::unique_ptr<aux::TimeBasedData>,
                                                           aux::SimulationClock::time_point,
                                                           aux::SimulationClock::time_point,
                                                           aux::SimulationClock::duration> >& installations);
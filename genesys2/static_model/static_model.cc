@@ -31,43 +31,44 @@
 
 #include <static_model/static_model.h>
 
+#include <string>
+#include <unordered_set>
+
 namespace sm {
 
 StaticModel::StaticModel(const StaticModel& other)
     : AbstractModel(other) {
-  if (!other.regions_.empty()) {
-    for (const auto& it : other.regions_)
-      regions_.emplace(it.first, std::shared_ptr<Region>(new Region(*it.second)));
-  }
-  if (!other.links_.empty()) {
-    for (const auto& it : other.links_)
-      links_.emplace(it.first, std::shared_ptr<Link>(new Link(*it.second)));
-  }
-  if (!other.global_.empty()) {
-	  //DEBUG std::cout << "\t***DEBUG StaticModel::StaticModel CopyC'Tor: found global in other model! " << std::endl;
-      for (const auto& it : other.global_)
-         global_.emplace(it.first, std::shared_ptr<Global>(new Global(*it.second)));
-    }
+  //keep the map order of other, the dynamic model and thereby the balance order of a copy follow it
+  regions_ = other.regions_;
+  for (auto& it : regions_)
+    it.second = std::shared_ptr<Region>(new Region(*it.second));
+  links_ = other.links_;
+  for (auto& it : links_)
+    it.second = std::shared_ptr<Link>(new Link(*it.second));
+  global_ = other.global_;
+  for (auto& it : global_)
+    it.second = std::shared_ptr<Global>(new Global(*it.second));
 }
 
 StaticModel::StaticModel(const am::AbstractModel& origin,
-                         std::unordered_map<std::string,
+                         const std::unordered_map<std::string,
                                                   std::unordered_map<std::string,
                                                                      std::tuple<std::unique_ptr<aux::TimeBasedData>,
                                                                      aux::SimulationClock::time_point,
                                                                      aux::SimulationClock::time_point,
                                                                      aux::SimulationClock::duration>
                                                                      >
-                                                  > installations)
+                                                  >& installations)
     : AbstractModel(origin) {
+  //the installations are only referenced, entries without a matching region, link or global are invalid
+  std::unordered_set<std::string> applied_installations; //each entry is applied once, as by erasing it
   if (!AbstractModel::regions().empty()) {
     for (const auto& it : AbstractModel::regions()) {
       auto region_pos = installations.find(it.first);
-      if (region_pos != installations.end()) {
+      if (region_pos != installations.end() && applied_installations.insert(it.first).second) {
         //std::cout << " found installation for " << it.second->code() << std::endl;
         //std::cout << "\t " << region_pos->first << std::endl;
         regions_.emplace(it.first, std::shared_ptr<Region>(new Region(*(it.second), region_pos->second)));
-        installations.erase(it.first);
       } else {
         //std::cout << " found no installation for " << it.second->code() << std::endl;
         regions_.emplace(it.first, std::shared_ptr<Region>(new Region(*(it.second))));
@@ -77,9 +78,8 @@ StaticModel::StaticModel(const am::AbstractModel& origin,
   if (!AbstractModel::links().empty()) {
     for (const auto& it : AbstractModel::links()) {
       auto link_pos = installations.find(it.first);
-    	if (link_pos != installations.end()){
+    	if (link_pos != installations.end() && applied_installations.insert(it.first).second){
     	  links_.emplace(it.first, std::shared_ptr<Link>(new Link(*(it.second), link_pos->second, regions())));
-    	  installations.erase(it.first);
       } else {
     		links_.emplace(it.first, std::shared_ptr<Link>(new Link(*(it.second), regions())));
     	}
@@ -89,17 +89,18 @@ StaticModel::StaticModel(const am::AbstractModel& origin,
     //DEBUGstd::cout << "\t***DEBUG StaticModel::StaticModel C'Tor: found global in abstract model! " << std::endl;
     for (const auto& it : AbstractModel::global()) {
       auto glob_pos = installations.find(it.first);
-      if (glob_pos != installations.end()) {
+      if (glob_pos != installations.end() && applied_installations.insert(it.first).second) {
         global_.emplace(it.first, std::shared_ptr<Global>(new Global(*(it.second), glob_pos->second)));
-        installations.erase(it.first);
       } else {
         global_.emplace(it.first, std::shared_ptr<Global>(new Global(*(it.second))));
       }
     }
   }
-  if (installations.size() > 0) {
+  if (applied_installations.size() != installations.size()) {
     std::cerr << "ERROR: could not apply all installations due to faulty parametrisation" << std::endl;
     for (auto& it : installations){
+      if (applied_installations.count(it.first) > 0)
+        continue;
       std::cout << "\t" << it.first << std::endl;
       for (auto&& tt : it.second) {
         std::cout << "\t" << tt.first <<" needs to be removed" << std::endl;
@@ -52,14 +52,14 @@ class StaticModel : public am::AbstractModel {
   StaticModel& operator=(const StaticModel&) = delete;
   StaticModel& operator=(StaticModel&&) = delete;
   StaticModel(const am::AbstractModel& origin,
-              std::unordered_map<std::string,
+              const std::unordered_map<std::string,
                                        std::unordered_map<std::string,
                                                           std::tuple<std::unique_ptr<aux::TimeBasedData>,
                                                                      aux::SimulationClock::time_point,
                                                                      aux::SimulationClock::time_point,
                                                                      aux::SimulationClock::duration>
                                                           >
-                                       > installations);
+                                       >& installations);
 
  protected:
   const std::unordered_map<std::string, std::shared_ptr<Region> >& regions() const {return regions_;}